@@ -53,12 +53,19 @@
 			"cc/modules/objdetect/objdetect.cc",
 			"cc/modules/objdetect/CascadeClassifier.cc",
 			"cc/modules/objdetect/HOGDescriptor.cc",
+			"cc/modules/objdetect/HOGFeaturePyramid.cc",
 			"cc/modules/objdetect/DetectionROI.cc",
 			"cc/modules/machinelearning/machinelearning.cc",
 			"cc/modules/machinelearning/ParamGrid.cc",
 			"cc/modules/machinelearning/StatModel.cc",
 			"cc/modules/machinelearning/SVM.cc",
 			"cc/modules/machinelearning/TrainData.cc",
+			"cc/modules/machinelearning/RTrees.cc",
+			"cc/modules/machinelearning/Boost.cc",
+			"cc/modules/machinelearning/KNearest.cc",
+			"cc/modules/machinelearning/LogisticRegression.cc",
+			"cc/modules/machinelearning/NormalBayesClassifier.cc",
+			"cc/modules/machinelearning/ANN_MLP.cc",
 			"cc/modules/dnn/dnn.cc",
 			"cc/modules/dnn/Net.cc",
 			"cc/modules/face/face.cc",
@@ -66,6 +73,7 @@
 			"cc/modules/face/EigenFaceRecognizer.cc",
 			"cc/modules/face/FisherFaceRecognizer.cc",
 			"cc/modules/face/LBPHFaceRecognizer.cc",
+			"cc/modules/face/FaceGallery.cc",
 			"cc/modules/face/Facemark.cc",
 			"cc/modules/face/FacemarkAAM.cc",
 			"cc/modules/face/FacemarkAAMData.cc",
@@ -95,9 +103,14 @@
 			"cc/modules/features2d/KeyPointMatch.cc",
 			"cc/modules/features2d/DescriptorMatch.cc",
 			"cc/modules/features2d/BFMatcher.cc",
+			"cc/modules/features2d/DescriptorIndex.cc",
+			"cc/modules/features2d/BOWKMeansTrainer.cc",
+			"cc/modules/features2d/BOWImgDescriptorExtractor.cc",
+			"cc/modules/features2d/BOWIndex.cc",
 			"cc/modules/features2d/FeatureDetector.cc",
 			"cc/modules/features2d/descriptorMatching.cc",
 			"cc/modules/features2d/descriptorMatchingKnn.cc",
+			"cc/modules/features2d/descriptorMatchingRadius.cc",
 			"cc/modules/features2d/detectors/AGASTDetector.cc",
 			"cc/modules/features2d/detectors/AKAZEDetector.cc",
 			"cc/modules/features2d/detectors/BRISKDetector.cc",
@@ -0,0 +1,132 @@
+#include "NativeNodeUtils.h"
+#include "CatchCvExceptionWorker.h"
+#include <opencv2/core.hpp>
+#include <functional>
+
+#ifndef __FF_ALGORITHMBUFFERBINDINGS_H__
+#define __FF_ALGORITHMBUFFERBINDINGS_H__
+
+// serialization of algorithms from and to in memory FileStorages, shared by the ml and face models
+namespace AlgorithmBufferBindings {
+
+  // extension selecting the FileStorage format, empty for unknown formats
+  static inline std::string getFormatExtension(std::string format) {
+    if (format == "xml") {
+      return ".xml";
+    }
+    if (format == "yaml" || format == "yml") {
+      return ".yml";
+    }
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 1
+    if (format == "json") {
+      return ".json";
+    }
+#endif
+    return "";
+  }
+
+  /* writes the model in the same layout as Algorithm::save, wrapped in a node named by getDefaultName,
+     models which are saved in a different layout override writeAlgorithm */
+  struct SaveToBufferWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::Algorithm> algorithm;
+
+    SaveToBufferWorker(cv::Ptr<cv::Algorithm> algorithm) {
+      this->algorithm = algorithm;
+    }
+
+    std::string format = "xml";
+
+    std::string data;
+
+    std::string executeCatchCvExceptionWorker() {
+      std::string ext = getFormatExtension(format);
+      if (ext.empty()) {
+        return "unknown format: " + format;
+      }
+      cv::FileStorage fs(ext, cv::FileStorage::WRITE | cv::FileStorage::MEMORY);
+      writeAlgorithm(fs);
+      data = fs.releaseAndGetString();
+      return "";
+    }
+
+    virtual void writeAlgorithm(cv::FileStorage& fs) {
+      fs << algorithm->getDefaultName() << "{";
+      algorithm->write(fs);
+      fs << "}";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Nan::CopyBuffer(data.data(), (uint32_t)data.size()).ToLocalChecked();
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::StringConverter::optArg(0, &format, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 0);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return FF::StringConverter::optProp(&format, "format", opts);
+    }
+  };
+
+  /* reads a model written by SaveToBufferWorker into a newly created algorithm and hands it to
+     setAlgorithm on the main thread, such that the wrapped model is only replaced if reading succeeds,
+     the wrapping object is kept alive until then. The model is read from the node named by getDefaultName
+     or from the root, if it has been written without the named node */
+  template<class TAlgorithm>
+  struct LoadFromBufferWorker : public CatchCvExceptionWorker {
+  public:
+    Nan::Global<v8::Object> jsSelf;
+    cv::Ptr<TAlgorithm> algorithm;
+    std::function<void(cv::Ptr<TAlgorithm>)> setAlgorithm;
+
+    LoadFromBufferWorker(v8::Local<v8::Object> jsSelf, cv::Ptr<TAlgorithm> algorithm, std::function<void(cv::Ptr<TAlgorithm>)> setAlgorithm) {
+      this->jsSelf.Reset(jsSelf);
+      this->algorithm = algorithm;
+      this->setAlgorithm = setAlgorithm;
+    }
+
+    // copied, since the buffer may be modified or collected while reading asynchronously
+    std::string data;
+
+    std::string executeCatchCvExceptionWorker() {
+      cv::FileStorage fs(data, cv::FileStorage::READ | cv::FileStorage::MEMORY);
+      if (fs.getFirstTopLevelNode().empty()) {
+        return "failed to read model from buffer";
+      }
+      readAlgorithm(fs);
+      if (algorithm->empty()) {
+        return "failed to read model from buffer, the model is empty";
+      }
+      return "";
+    }
+
+    virtual void readAlgorithm(cv::FileStorage& fs) {
+      cv::FileNode node = fs[algorithm->getDefaultName()];
+      algorithm->read(node.empty() ? fs.root() : node);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      setAlgorithm(algorithm);
+      return Nan::Undefined();
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!FF::hasArg(info, 0) || !node::Buffer::HasInstance(info[0])) {
+        Nan::ThrowError("expected arg 0 to be a Buffer");
+        return true;
+      }
+      v8::Local<v8::Object> jsBuf = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      data = std::string(node::Buffer::Data(jsBuf), node::Buffer::Length(jsBuf));
+      return false;
+    }
+  };
+
+}
+
+#endif
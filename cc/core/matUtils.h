@@ -63,6 +63,25 @@
     Nan::Set(rowArray, r, colArray);                                           \
   }
 
+/* half precision mats are only available with OpenCV 4 */
+#ifdef CV_16F
+#define FF_MAT_TYPED_OPERATOR_CASES_16F(mat, arg, ITERATOR, OPERATOR) \
+	case CV_16FC1:\
+		ITERATOR(mat, arg, OPERATOR##Val<cv::float16_t>)\
+			break;\
+	case CV_16FC2:\
+		ITERATOR(mat, arg, OPERATOR##Vec2<cv::float16_t>)\
+			break;\
+	case CV_16FC3:\
+		ITERATOR(mat, arg, OPERATOR##Vec3<cv::float16_t>)\
+			break;\
+	case CV_16FC4:\
+		ITERATOR(mat, arg, OPERATOR##Vec4<cv::float16_t>)\
+			break;
+#else
+#define FF_MAT_TYPED_OPERATOR_CASES_16F(mat, arg, ITERATOR, OPERATOR)
+#endif
+
 #define FF_MAT_APPLY_TYPED_OPERATOR(mat, arg, type, ITERATOR, OPERATOR) {	\
 	switch (type) {																													\
 	case CV_8UC1:																														\
@@ -149,6 +168,7 @@
 	case CV_64FC4:\
 		ITERATOR(mat, arg, OPERATOR##Vec4<double>)\
 			break;\
+	FF_MAT_TYPED_OPERATOR_CASES_16F(mat, arg, ITERATOR, OPERATOR)\
 	default:\
 		return tryCatch.throwError("invalid matType: " + std::to_string(type));\
 		break;\
@@ -162,6 +182,18 @@
 	}
 
 namespace FF {
+	/* identity for all native types, half precision values have to be widened before passing them to Nan::New */
+	template<typename type>
+	static inline type asJsNumber(type val) {
+		return val;
+	}
+
+#ifdef CV_16F
+	static inline float asJsNumber(cv::float16_t val) {
+		return (float)val;
+	}
+#endif
+
 	template<typename type>
 	static inline void matPutVal(cv::Mat mat, v8::Local<v8::Value> value, int r, int c) {
 		mat.at<type>(r, c) = (type)value->ToNumber(Nan::GetCurrentContext()).ToLocalChecked()->Value();
@@ -234,97 +266,97 @@ namespace FF {
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVal(cv::Mat mat, int r, int c) {
-		return Nan::New(mat.at<type>(r, c));
+		return Nan::New(asJsNumber(mat.at<type>(r, c)));
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVal(cv::Mat mat, int r, int c, int z) {
-		return Nan::New(mat.at<type>(r, c, z));
+		return Nan::New(asJsNumber(mat.at<type>(r, c, z)));
 	}
 
   template<typename type>
 	static inline v8::Local<v8::Value> matGetVal(cv::Mat mat, const int* idx) {
-		return Nan::New(mat.at<type>(idx));
+		return Nan::New(asJsNumber(mat.at<type>(idx)));
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec2(cv::Mat mat, int r, int c) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(2);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 2> >(r, c)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 2> >(r, c)[1]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(r, c)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(r, c)[1])));
 		return vec;
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec2(cv::Mat mat, int r, int c, int z) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(2);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 2> >(r, c, z)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 2> >(r, c, z)[1]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(r, c, z)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(r, c, z)[1])));
 		return vec;
 	}
 
   template<typename type>
 	static inline v8::Local<v8::Value> matGetVec2(cv::Mat mat, const int* idx) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(2);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 2> >(idx)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 2> >(idx)[1]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(idx)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 2> >(idx)[1])));
 		return vec;
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec3(cv::Mat mat, int r, int c) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(3);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 3> >(r, c)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 3> >(r, c)[1]));
-		Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 3> >(r, c)[2]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c)[1])));
+		Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c)[2])));
 		return vec;
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec3(cv::Mat mat, int r, int c, int z) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(3);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 3> >(r, c, z)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 3> >(r, c, z)[1]));
-		Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 3> >(r, c, z)[2]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c, z)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c, z)[1])));
+		Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(r, c, z)[2])));
 		return vec;
 	}
 
   template<typename type>
 	static inline v8::Local<v8::Value> matGetVec3(cv::Mat mat, const int* idx) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(3);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 3> >(idx)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 3> >(idx)[1]));
-		Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 3> >(idx)[2]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(idx)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(idx)[1])));
+		Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 3> >(idx)[2])));
 		return vec;
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec4(cv::Mat mat, int r, int c) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(4);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 4> >(r, c)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 4> >(r, c)[1]));
-		Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 4> >(r, c)[2]));
-		Nan::Set(vec, 3, Nan::New(mat.at< cv::Vec<type, 4> >(r, c)[3]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c)[1])));
+		Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c)[2])));
+		Nan::Set(vec, 3, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c)[3])));
 		return vec;
 	}
 
 	template<typename type>
 	static inline v8::Local<v8::Value> matGetVec4(cv::Mat mat, int r, int c, int z) {
 		v8::Local<v8::Array> vec = Nan::New<v8::Array>(4);
-		Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 4> >(r, c, z)[0]));
-		Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 4> >(r, c, z)[1]));
-		Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 4> >(r, c, z)[2]));
-		Nan::Set(vec, 3, Nan::New(mat.at< cv::Vec<type, 4> >(r, c, z)[3]));
+		Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c, z)[0])));
+		Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c, z)[1])));
+		Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c, z)[2])));
+		Nan::Set(vec, 3, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(r, c, z)[3])));
 		return vec;
 	}
 
   template<typename type>
   static inline v8::Local<v8::Value> matGetVec4(cv::Mat mat, const int* idx) {
     v8::Local<v8::Array> vec = Nan::New<v8::Array>(4);
-    Nan::Set(vec, 0, Nan::New(mat.at< cv::Vec<type, 4> >(idx)[0]));
-    Nan::Set(vec, 1, Nan::New(mat.at< cv::Vec<type, 4> >(idx)[1]));
-    Nan::Set(vec, 2, Nan::New(mat.at< cv::Vec<type, 4> >(idx)[2]));
-    Nan::Set(vec, 3, Nan::New(mat.at< cv::Vec<type, 4> >(idx)[3]));
+    Nan::Set(vec, 0, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(idx)[0])));
+    Nan::Set(vec, 1, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(idx)[1])));
+    Nan::Set(vec, 2, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(idx)[2])));
+    Nan::Set(vec, 3, Nan::New(asJsNumber(mat.at< cv::Vec<type, 4> >(idx)[3])));
     return vec;
   }
 }
@@ -0,0 +1,119 @@
+#include "NativeNodeUtils.h"
+#include <string>
+#include <vector>
+#include <cstring>
+
+#ifndef __FF_TYPEDARRAYUTILS_H__
+#define __FF_TYPEDARRAYUTILS_H__
+
+namespace FF {
+
+	template<typename T>
+	struct TypedArrayTraits {};
+
+	template<>
+	struct TypedArrayTraits<float> {
+		typedef v8::Float32Array ArrayType;
+		static const char* getTypeName() { return "Float32Array"; }
+		static bool isType(v8::Local<v8::Value> val) { return val->IsFloat32Array(); }
+	};
+
+	template<>
+	struct TypedArrayTraits<double> {
+		typedef v8::Float64Array ArrayType;
+		static const char* getTypeName() { return "Float64Array"; }
+		static bool isType(v8::Local<v8::Value> val) { return val->IsFloat64Array(); }
+	};
+
+	template<>
+	struct TypedArrayTraits<int> {
+		typedef v8::Int32Array ArrayType;
+		static const char* getTypeName() { return "Int32Array"; }
+		static bool isType(v8::Local<v8::Value> val) { return val->IsInt32Array(); }
+	};
+
+	template<>
+	struct TypedArrayTraits<unsigned char> {
+		typedef v8::Uint8Array ArrayType;
+		static const char* getTypeName() { return "Uint8Array"; }
+		static bool isType(v8::Local<v8::Value> val) { return val->IsUint8Array(); }
+	};
+
+	/* converts between std::vector<T> and the matching JS typed array, mirrors the arg/optArg/optProp/wrap
+	   interface of the FF converters, unwrappers return true and throw if the value has the wrong type */
+	template<typename T>
+	class TypedArrayConverter {
+	public:
+		typedef TypedArrayTraits<T> Traits;
+
+		static bool isTypedArray(v8::Local<v8::Value> val) {
+			return Traits::isType(val);
+		}
+
+		static void unwrapUnchecked(std::vector<T>* vec, v8::Local<v8::Value> val) {
+			Nan::TypedArrayContents<T> contents(val);
+			vec->resize(contents.length());
+			if (contents.length() > 0) {
+				memcpy(vec->data(), *contents, contents.length() * sizeof(T));
+			}
+		}
+
+		static bool arg(int argN, std::vector<T>* vec, Nan::NAN_METHOD_ARGS_TYPE info) {
+			if (!isTypedArray(info[argN])) {
+				Nan::ThrowError(Nan::New(
+					std::string("expected argument ") + std::to_string(argN) + " to be of type " + Traits::getTypeName()
+				).ToLocalChecked());
+				return true;
+			}
+			unwrapUnchecked(vec, info[argN]);
+			return false;
+		}
+
+		static bool optArg(int argN, std::vector<T>* vec, Nan::NAN_METHOD_ARGS_TYPE info) {
+			if (argN >= info.Length() || info[argN]->IsUndefined() || info[argN]->IsFunction()) {
+				return false;
+			}
+			return arg(argN, vec, info);
+		}
+
+		static bool prop(std::vector<T>* vec, const char* propName, v8::Local<v8::Object> opts) {
+			v8::Local<v8::Value> val = Nan::Get(opts, Nan::New(propName).ToLocalChecked()).ToLocalChecked();
+			if (!isTypedArray(val)) {
+				Nan::ThrowError(Nan::New(
+					std::string("expected property ") + propName + " to be of type " + Traits::getTypeName()
+				).ToLocalChecked());
+				return true;
+			}
+			unwrapUnchecked(vec, val);
+			return false;
+		}
+
+		static bool optProp(std::vector<T>* vec, const char* propName, v8::Local<v8::Object> opts) {
+			if (!Nan::HasOwnProperty(opts, Nan::New(propName).ToLocalChecked()).FromJust()) {
+				return false;
+			}
+			return prop(vec, propName, opts);
+		}
+
+		static v8::Local<v8::Value> wrap(const T* data, size_t length) {
+			v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), length * sizeof(T));
+			v8::Local<typename Traits::ArrayType> arr = Traits::ArrayType::New(buffer, 0, length);
+			if (length > 0) {
+				Nan::TypedArrayContents<T> contents(arr);
+				memcpy(*contents, data, length * sizeof(T));
+			}
+			return arr;
+		}
+
+		static v8::Local<v8::Value> wrap(const std::vector<T>& vec) {
+			return wrap(vec.data(), vec.size());
+		}
+	};
+
+	typedef TypedArrayConverter<float> Float32TypedArrayConverter;
+	typedef TypedArrayConverter<double> Float64TypedArrayConverter;
+	typedef TypedArrayConverter<int> Int32TypedArrayConverter;
+	typedef TypedArrayConverter<unsigned char> Uint8TypedArrayConverter;
+}
+
+#endif
@@ -109,6 +109,47 @@ void CvTypes::Init(v8::Local<v8::Object> target) {
 	FF_SET_JS_PROP(mlConstants, VAR_NUMERICAL, Nan::New<v8::Integer>(ml::VariableTypes::VAR_NUMERICAL));
 	FF_SET_JS_PROP(mlConstants, VAR_ORDERED, Nan::New<v8::Integer>(ml::VariableTypes::VAR_ORDERED));
 	Nan::Set(mlConstants, FF::newString("SVM"), svmConstants);
+
+	v8::Local<v8::Object> dtreesConstants = Nan::New<v8::Object>();
+	FF_SET_JS_PROP(dtreesConstants, PREDICT_AUTO, Nan::New<v8::Integer>(ml::DTrees::Flags::PREDICT_AUTO));
+	FF_SET_JS_PROP(dtreesConstants, PREDICT_SUM, Nan::New<v8::Integer>(ml::DTrees::Flags::PREDICT_SUM));
+	FF_SET_JS_PROP(dtreesConstants, PREDICT_MAX_VOTE, Nan::New<v8::Integer>(ml::DTrees::Flags::PREDICT_MAX_VOTE));
+	Nan::Set(mlConstants, FF::newString("DTrees"), dtreesConstants);
+
+	v8::Local<v8::Object> boostConstants = Nan::New<v8::Object>();
+	FF_SET_JS_PROP(boostConstants, DISCRETE, Nan::New<v8::Integer>(ml::Boost::Types::DISCRETE));
+	FF_SET_JS_PROP(boostConstants, REAL, Nan::New<v8::Integer>(ml::Boost::Types::REAL));
+	FF_SET_JS_PROP(boostConstants, LOGIT, Nan::New<v8::Integer>(ml::Boost::Types::LOGIT));
+	FF_SET_JS_PROP(boostConstants, GENTLE, Nan::New<v8::Integer>(ml::Boost::Types::GENTLE));
+	Nan::Set(mlConstants, FF::newString("Boost"), boostConstants);
+
+	v8::Local<v8::Object> knearestConstants = Nan::New<v8::Object>();
+	FF_SET_JS_PROP(knearestConstants, BRUTE_FORCE, Nan::New<v8::Integer>(ml::KNearest::Types::BRUTE_FORCE));
+	FF_SET_JS_PROP(knearestConstants, KDTREE, Nan::New<v8::Integer>(ml::KNearest::Types::KDTREE));
+	Nan::Set(mlConstants, FF::newString("KNearest"), knearestConstants);
+
+	v8::Local<v8::Object> logisticRegressionConstants = Nan::New<v8::Object>();
+	FF_SET_JS_PROP(logisticRegressionConstants, REG_DISABLE, Nan::New<v8::Integer>(ml::LogisticRegression::RegKinds::REG_DISABLE));
+	FF_SET_JS_PROP(logisticRegressionConstants, REG_L1, Nan::New<v8::Integer>(ml::LogisticRegression::RegKinds::REG_L1));
+	FF_SET_JS_PROP(logisticRegressionConstants, REG_L2, Nan::New<v8::Integer>(ml::LogisticRegression::RegKinds::REG_L2));
+	FF_SET_JS_PROP(logisticRegressionConstants, BATCH, Nan::New<v8::Integer>(ml::LogisticRegression::Methods::BATCH));
+	FF_SET_JS_PROP(logisticRegressionConstants, MINI_BATCH, Nan::New<v8::Integer>(ml::LogisticRegression::Methods::MINI_BATCH));
+	Nan::Set(mlConstants, FF::newString("LogisticRegression"), logisticRegressionConstants);
+
+	v8::Local<v8::Object> annMlpConstants = Nan::New<v8::Object>();
+	FF_SET_JS_PROP(annMlpConstants, BACKPROP, Nan::New<v8::Integer>(ml::ANN_MLP::TrainingMethods::BACKPROP));
+	FF_SET_JS_PROP(annMlpConstants, RPROP, Nan::New<v8::Integer>(ml::ANN_MLP::TrainingMethods::RPROP));
+	FF_SET_JS_PROP(annMlpConstants, IDENTITY, Nan::New<v8::Integer>(ml::ANN_MLP::ActivationFunctions::IDENTITY));
+	FF_SET_JS_PROP(annMlpConstants, SIGMOID_SYM, Nan::New<v8::Integer>(ml::ANN_MLP::ActivationFunctions::SIGMOID_SYM));
+	FF_SET_JS_PROP(annMlpConstants, GAUSSIAN, Nan::New<v8::Integer>(ml::ANN_MLP::ActivationFunctions::GAUSSIAN));
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 3
+	FF_SET_JS_PROP(annMlpConstants, RELU, Nan::New<v8::Integer>(ml::ANN_MLP::ActivationFunctions::RELU));
+	FF_SET_JS_PROP(annMlpConstants, LEAKYRELU, Nan::New<v8::Integer>(ml::ANN_MLP::ActivationFunctions::LEAKYRELU));
+#endif
+	FF_SET_JS_PROP(annMlpConstants, UPDATE_WEIGHTS, Nan::New<v8::Integer>(ml::ANN_MLP::TrainFlags::UPDATE_WEIGHTS));
+	FF_SET_JS_PROP(annMlpConstants, NO_INPUT_SCALE, Nan::New<v8::Integer>(ml::ANN_MLP::TrainFlags::NO_INPUT_SCALE));
+	FF_SET_JS_PROP(annMlpConstants, NO_OUTPUT_SCALE, Nan::New<v8::Integer>(ml::ANN_MLP::TrainFlags::NO_OUTPUT_SCALE));
+	Nan::Set(mlConstants, FF::newString("ANN_MLP"), annMlpConstants);
 	Nan::Set(target,FF::newString("ml"), mlConstants);
 
 	v8::Local<v8::Object> statModelCostants = Nan::New<v8::Object>();
@@ -50,6 +50,14 @@ static void initMatTypes(v8::Local<v8::Object> module) {
 	FF_MAT_TYPE(CV_64FC2);
 	FF_MAT_TYPE(CV_64FC3);
 	FF_MAT_TYPE(CV_64FC4);
+
+#ifdef CV_16F
+	FF_MAT_TYPE(CV_16F);
+	FF_MAT_TYPE(CV_16FC1);
+	FF_MAT_TYPE(CV_16FC2);
+	FF_MAT_TYPE(CV_16FC3);
+	FF_MAT_TYPE(CV_16FC4);
+#endif
 }
 
 #endif
@@ -0,0 +1,20 @@
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#ifndef __FF_FILEUTILS_H__
+#define __FF_FILEUTILS_H__
+
+/* moves tmpPath over path, on posix systems the rename is atomic and processes which have mapped the
+   previous file keep their pages, instead of the file being truncated under them */
+static inline void replaceFile(const std::string& tmpPath, const std::string& path) {
+#ifdef WIN
+	std::remove(path.c_str());
+#endif
+	if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+		std::remove(tmpPath.c_str());
+		throw std::runtime_error("failed to replace file: " + path);
+	}
+}
+
+#endif
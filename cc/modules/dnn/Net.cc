@@ -24,6 +24,10 @@ NAN_MODULE_INIT(Net::Init) {
   Nan::SetPrototypeMethod(ctor, "getLayerNamesAsync", GetLayerNamesAsync);
   Nan::SetPrototypeMethod(ctor, "getUnconnectedOutLayers", GetUnconnectedOutLayers);
   Nan::SetPrototypeMethod(ctor, "getUnconnectedOutLayersAsync", GetUnconnectedOutLayersAsync);
+  Nan::SetPrototypeMethod(ctor, "warmup", Warmup);
+  Nan::SetPrototypeMethod(ctor, "warmupAsync", WarmupAsync);
+  Nan::SetPrototypeMethod(ctor, "clone", Clone);
+  Nan::SetPrototypeMethod(ctor, "cloneAsync", CloneAsync);
 
   Nan::Set(target,Nan::New("Net").ToLocalChecked(), FF::getFunction(ctor));
 };
@@ -96,4 +100,32 @@ NAN_METHOD(Net::GetUnconnectedOutLayersAsync) {
       info);
 }
 
+NAN_METHOD(Net::Warmup) {
+  FF::SyncBindingBase(
+      std::make_shared<NetBindings::WarmupWorker>(Net::unwrapSelf(info)),
+      "Net::Warmup",
+      info);
+}
+
+NAN_METHOD(Net::WarmupAsync) {
+  FF::AsyncBindingBase(
+      std::make_shared<NetBindings::WarmupWorker>(Net::unwrapSelf(info)),
+      "Net::WarmupAsync",
+      info);
+}
+
+NAN_METHOD(Net::Clone) {
+  FF::SyncBindingBase(
+      std::make_shared<NetBindings::CloneWorker>(Net::unwrapThis(info)->source),
+      "Net::Clone",
+      info);
+}
+
+NAN_METHOD(Net::CloneAsync) {
+  FF::AsyncBindingBase(
+      std::make_shared<NetBindings::CloneWorker>(Net::unwrapThis(info)->source),
+      "Net::CloneAsync",
+      info);
+}
+
 #endif
@@ -2,10 +2,72 @@
 #include "opencv2/dnn.hpp"
 #include "CatchCvExceptionWorker.h"
 #include "Mat.h"
+#include <fstream>
+#include <iterator>
+#include <mutex>
 
 #ifndef __FF_NET_H__
 #define __FF_NET_H__
 
+// the model files a net has been read from, the file contents are read once on the first clone
+// and kept in memory, such that further replicas of the net are parsed without touching the disk again
+class NetSource {
+public:
+	std::string framework;
+	std::string modelFile;
+	std::string configFile;
+
+	NetSource(std::string framework, std::string modelFile, std::string configFile) {
+		this->framework = framework;
+		this->modelFile = modelFile;
+		this->configFile = configFile;
+	}
+
+	// reading from buffers requires OpenCV 3.4.2, older versions read the files again
+	cv::dnn::Net readNet() {
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 4 || (CV_VERSION_MINOR > 3 && CV_VERSION_REVISION > 1)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!isLoaded) {
+				readFile(modelFile, &model);
+				readFile(configFile, &config);
+				isLoaded = true;
+			}
+		}
+		return cv::dnn::readNet(framework, model, config);
+#else
+		if (framework == "caffe") {
+			return cv::dnn::readNetFromCaffe(configFile, modelFile);
+		}
+#if CV_VERSION_MINOR > 3
+		if (framework == "darknet") {
+			return cv::dnn::readNetFromDarknet(configFile, modelFile);
+		}
+		return cv::dnn::readNetFromTensorflow(modelFile, configFile);
+#else
+		return cv::dnn::readNetFromTensorflow(modelFile);
+#endif
+#endif
+	}
+
+private:
+	std::mutex mutex;
+	bool isLoaded = false;
+	std::vector<uchar> model;
+	std::vector<uchar> config;
+
+	static void readFile(const std::string& file, std::vector<uchar>* buf) {
+		if (file.empty()) {
+			return;
+		}
+		std::ifstream stream(file.c_str(), std::ios::binary);
+		if (!stream) {
+			throw std::runtime_error("failed to read file: " + file);
+		}
+		buf->assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+	}
+};
+
 class Net : public FF::ObjectWrap<Net, cv::dnn::Net> {
 public:
 	static Nan::Persistent<v8::FunctionTemplate> constructor;
@@ -14,6 +76,14 @@ public:
 		return "Net";
 	}
 
+	std::shared_ptr<NetSource> source;
+
+	static v8::Local<v8::Value> wrapWithSource(cv::dnn::Net net, std::shared_ptr<NetSource> source) {
+		v8::Local<v8::Value> jsNet = Net::Converter::wrap(net);
+		Nan::ObjectWrap::Unwrap<Net>(jsNet.As<v8::Object>())->source = source;
+		return jsNet;
+	}
+
 	static NAN_MODULE_INIT(Init);
 
 	static NAN_METHOD(New);
@@ -25,6 +95,10 @@ public:
   static NAN_METHOD(GetLayerNamesAsync);
   static NAN_METHOD(GetUnconnectedOutLayers);
   static NAN_METHOD(GetUnconnectedOutLayersAsync);
+  static NAN_METHOD(Warmup);
+  static NAN_METHOD(WarmupAsync);
+  static NAN_METHOD(Clone);
+  static NAN_METHOD(CloneAsync);
 };
 
 #endif
\ No newline at end of file
@@ -17,6 +17,12 @@ namespace NetBindings {
 
 
     std::string executeCatchCvExceptionWorker() {
+#ifdef CV_16F
+      // the dnn backends consume CV_32F inputs, half precision blobs are widened here
+      if (blob.depth() == CV_16F) {
+        blob.convertTo(blob, CV_32F);
+      }
+#endif
       self.setInput(blob, name);
       return "";
     }
@@ -121,6 +127,94 @@ namespace NetBindings {
     }
   };
 
+  // runs a forward pass on zero filled inputs of the given shapes, such that the one time
+  // allocation and initialization of the layers does not happen on the first actual forward,
+  // cv::dnn::Net does not expose its current inputs, thus the zero filled inputs stay set and
+  // callers have to call setInput before the next forward
+  struct WarmupWorker : public CatchCvExceptionWorker {
+  public:
+    cv::dnn::Net self;
+    WarmupWorker(cv::dnn::Net self) {
+      this->self = self;
+    }
+
+    std::vector<std::vector<int>> inputShapes;
+    std::vector<std::string> inputNames;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (inputNames.size() > 0 && inputNames.size() != inputShapes.size()) {
+        return "expected one input name per input shape";
+      }
+      for (size_t i = 0; i < inputShapes.size(); i++) {
+        std::vector<int>& shape = inputShapes[i];
+        cv::Mat blob((int)shape.size(), shape.data(), CV_32F, cv::Scalar(0));
+        self.setInput(blob, inputNames.size() > 0 ? inputNames[i] : "");
+      }
+
+      std::vector<cv::String> layerNames = self.getLayerNames();
+      std::vector<cv::String> outNames;
+      for (int layerId : self.getUnconnectedOutLayers()) {
+        outNames.push_back(layerNames[layerId - 1]);
+      }
+      std::vector<cv::Mat> outputBlobs;
+      self.forward(outputBlobs, outNames);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!info[0]->IsArray()) {
+        Nan::ThrowError("expected argument 0 to be an array of input shapes");
+        return true;
+      }
+      v8::Local<v8::Array> jsShapes = v8::Local<v8::Array>::Cast(info[0]);
+      // a single shape may be passed as a flat array
+      if (jsShapes->Length() > 0 && Nan::Get(jsShapes, 0).ToLocalChecked()->IsNumber()) {
+        inputShapes.resize(1);
+        return FF::IntArrayConverter::arg(0, &inputShapes[0], info);
+      }
+      inputShapes.resize(jsShapes->Length());
+      for (uint i = 0; i < jsShapes->Length(); i++) {
+        if (FF::IntArrayConverter::unwrapTo(&inputShapes[i], Nan::Get(jsShapes, i).ToLocalChecked())) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::StringArrayConverter::optArg(1, &inputNames, info)
+      );
+    }
+  };
+
+  // creates an independent replica of a net read from model files, the model is parsed from the
+  // in memory copy of the files held by the shared NetSource
+  struct CloneWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<NetSource> source;
+    CloneWorker(std::shared_ptr<NetSource> source) {
+      this->source = source;
+    }
+
+    cv::dnn::Net net;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (!source) {
+        return "net has not been read from a model file and can not be cloned";
+      }
+      net = source->readNet();
+      if (net.empty()) {
+        return "failed to clone net from: " + source->modelFile;
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Net::wrapWithSource(net, source);
+    }
+  };
+
 }
 
 #endif
@@ -19,10 +19,25 @@ NAN_MODULE_INIT(Dnn::Init) {
   Nan::SetMethod(target, "blobFromImageAsync", BlobFromImageAsync);
   Nan::SetMethod(target, "blobFromImages", BlobFromImages);
   Nan::SetMethod(target, "blobFromImagesAsync", BlobFromImagesAsync);
+  Nan::SetMethod(target, "blobFromImageLetterbox", BlobFromImageLetterbox);
+  Nan::SetMethod(target, "blobFromImageLetterboxAsync", BlobFromImageLetterboxAsync);
+  Nan::SetMethod(target, "blobFromImagesLetterbox", BlobFromImagesLetterbox);
+  Nan::SetMethod(target, "blobFromImagesLetterboxAsync", BlobFromImagesLetterboxAsync);
+  Nan::SetMethod(target, "decodeDetections", DecodeDetections);
+  Nan::SetMethod(target, "decodeDetectionsAsync", DecodeDetectionsAsync);
+  Nan::SetMethod(target, "decodeDetectionsBatch", DecodeDetectionsBatch);
+  Nan::SetMethod(target, "decodeDetectionsBatchAsync", DecodeDetectionsBatchAsync);
 #if CV_VERSION_MINOR > 3
   Nan::SetMethod(target, "readNetFromDarknet", ReadNetFromDarknet);
   Nan::SetMethod(target, "readNetFromDarknetAsync", ReadNetFromDarknetAsync);
   Nan::SetMethod(target, "NMSBoxes", NMSBoxes);
+  Nan::SetMethod(target, "NMSBoxesAsync", NMSBoxesAsync);
+  Nan::SetMethod(target, "NMSBoxesBatched", NMSBoxesBatched);
+  Nan::SetMethod(target, "NMSBoxesBatchedAsync", NMSBoxesBatchedAsync);
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 4 || CV_VERSION_REVISION > 1
+  Nan::SetMethod(target, "NMSBoxesRotated", NMSBoxesRotated);
+  Nan::SetMethod(target, "NMSBoxesRotatedAsync", NMSBoxesRotatedAsync);
+#endif
 #endif
 };
 
@@ -91,6 +106,70 @@ NAN_METHOD(Dnn::BlobFromImagesAsync) {
   );
 }
 
+NAN_METHOD(Dnn::BlobFromImageLetterbox) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::BlobFromImageLetterboxWorker>(true),
+    "BlobFromImageLetterbox",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::BlobFromImageLetterboxAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::BlobFromImageLetterboxWorker>(true),
+    "BlobFromImageLetterboxAsync",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::BlobFromImagesLetterbox) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::BlobFromImageLetterboxWorker>(false),
+    "BlobFromImagesLetterbox",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::BlobFromImagesLetterboxAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::BlobFromImageLetterboxWorker>(false),
+    "BlobFromImagesLetterboxAsync",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::DecodeDetections) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::DecodeDetectionsWorker>(false),
+    "DecodeDetections",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::DecodeDetectionsAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::DecodeDetectionsWorker>(false),
+    "DecodeDetectionsAsync",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::DecodeDetectionsBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::DecodeDetectionsWorker>(true),
+    "DecodeDetectionsBatch",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::DecodeDetectionsBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::DecodeDetectionsWorker>(true),
+    "DecodeDetectionsBatchAsync",
+    info
+  );
+}
+
 #if CV_VERSION_MINOR > 3
 NAN_METHOD(Dnn::ReadNetFromDarknet) {
   FF::SyncBindingBase(
@@ -113,6 +192,48 @@ NAN_METHOD(Dnn::NMSBoxes) {
     info
   );
 }
+
+NAN_METHOD(Dnn::NMSBoxesAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::NMSBoxes>(),
+    "NMSBoxesAsync",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::NMSBoxesBatched) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::NMSBoxesBatched>(),
+    "NMSBoxesBatched",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::NMSBoxesBatchedAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::NMSBoxesBatched>(),
+    "NMSBoxesBatchedAsync",
+    info
+  );
+}
+
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 4 || CV_VERSION_REVISION > 1
+NAN_METHOD(Dnn::NMSBoxesRotated) {
+  FF::SyncBindingBase(
+    std::make_shared<DnnBindings::NMSBoxesRotated>(),
+    "NMSBoxesRotated",
+    info
+  );
+}
+
+NAN_METHOD(Dnn::NMSBoxesRotatedAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DnnBindings::NMSBoxesRotated>(),
+    "NMSBoxesRotatedAsync",
+    info
+  );
+}
+#endif
 #endif
 
 #endif
@@ -1,5 +1,6 @@
 #include "NativeNodeUtils.h"
 #include "opencv2/dnn.hpp"
+#include "opencv2/imgproc.hpp"
 #include "CatchCvExceptionWorker.h"
 #include "Net.h"
 #include "Mat.h"
@@ -19,10 +20,25 @@ public:
   static NAN_METHOD(BlobFromImageAsync);
   static NAN_METHOD(BlobFromImages);
   static NAN_METHOD(BlobFromImagesAsync);
+  static NAN_METHOD(BlobFromImageLetterbox);
+  static NAN_METHOD(BlobFromImageLetterboxAsync);
+  static NAN_METHOD(BlobFromImagesLetterbox);
+  static NAN_METHOD(BlobFromImagesLetterboxAsync);
+  static NAN_METHOD(DecodeDetections);
+  static NAN_METHOD(DecodeDetectionsAsync);
+  static NAN_METHOD(DecodeDetectionsBatch);
+  static NAN_METHOD(DecodeDetectionsBatchAsync);
 #if CV_VERSION_MINOR > 3
   static NAN_METHOD(ReadNetFromDarknet);
   static NAN_METHOD(ReadNetFromDarknetAsync);
   static NAN_METHOD(NMSBoxes);
+  static NAN_METHOD(NMSBoxesAsync);
+  static NAN_METHOD(NMSBoxesBatched);
+  static NAN_METHOD(NMSBoxesBatchedAsync);
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 4 || CV_VERSION_REVISION > 1
+  static NAN_METHOD(NMSBoxesRotated);
+  static NAN_METHOD(NMSBoxesRotatedAsync);
+#endif
 #endif
 };
 
@@ -1,4 +1,8 @@
 #include "dnn.h"
+#include "dnnUtils.h"
+#include "typedArrayUtils.h"
+#include "RotatedRect.h"
+#include "parallelUtils.h"
 
 #ifndef __FF_DNNBINDINGS_H_
 #define __FF_DNNBINDINGS_H_
@@ -12,17 +16,19 @@ namespace DnnBindings {
     std::string darknetModelFile = "";
 
     cv::dnn::Net net;
+    std::shared_ptr<NetSource> source;
 
     std::string executeCatchCvExceptionWorker() {
       net = cv::dnn::readNetFromDarknet(cfgFile, darknetModelFile);
       if (net.empty()) {
         return std::string("failed to cfgFile: " + cfgFile + ", darknetModelFile: " + darknetModelFile).data();
       }
+      source = std::make_shared<NetSource>("darknet", darknetModelFile, cfgFile);
       return "";
     }
 
     v8::Local<v8::Value> getReturnValue() {
-      return Net::Converter::wrap(net);
+      return Net::wrapWithSource(net, source);
     }
 
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
@@ -43,6 +49,7 @@ namespace DnnBindings {
     std::string configFile = "";
 
     cv::dnn::Net net;
+    std::shared_ptr<NetSource> source;
 
     std::string executeCatchCvExceptionWorker() {
 #if CV_VERSION_MINOR > 3
@@ -53,11 +60,12 @@ namespace DnnBindings {
       if (net.empty()) {
         return std::string("failed to load net: " + modelFile + "failed to load config: " + configFile).data();
       }
+      source = std::make_shared<NetSource>("tensorflow", modelFile, configFile);
       return "";
     }
 
     v8::Local<v8::Value> getReturnValue() {
-      return Net::Converter::wrap(net);
+      return Net::wrapWithSource(net, source);
     }
 
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
@@ -79,17 +87,19 @@ namespace DnnBindings {
     std::string modelFile = "";
 
     cv::dnn::Net net;
+    std::shared_ptr<NetSource> source;
 
     std::string executeCatchCvExceptionWorker() {
       net = cv::dnn::readNetFromCaffe(prototxt, modelFile);
       if (net.empty()) {
         return std::string("failed to prototxt: " + prototxt + ", modelFile: " + modelFile).data();
       }
+      source = std::make_shared<NetSource>("caffe", modelFile, prototxt);
       return "";
     }
 
     v8::Local<v8::Value> getReturnValue() {
-      return Net::Converter::wrap(net);
+      return Net::wrapWithSource(net, source);
     }
 
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
@@ -123,14 +133,26 @@ namespace DnnBindings {
     cv::Mat returnValue;
 
     std::string executeCatchCvExceptionWorker() {
-#if CV_VERSION_MINOR > 3 && CV_VERSION_REVISION > 2
+#if CV_VERSION_MAJOR > 3 || (CV_VERSION_MINOR > 3 && CV_VERSION_REVISION > 2)
+#ifdef CV_16F
+      // blobFromImage only produces CV_8U or CV_32F blobs, half precision blobs are converted afterwards
+      int blobDepth = ddepth == CV_16F ? CV_32F : ddepth;
+#else
+      int blobDepth = ddepth;
+#endif
       if (isSingleImage) {
-        returnValue = cv::dnn::blobFromImage(image, scalefactor, size, mean, swapRB, crop, ddepth);
+        returnValue = cv::dnn::blobFromImage(image, scalefactor, size, mean, swapRB, crop, blobDepth);
       }
       else {
-        returnValue = cv::dnn::blobFromImages(images, scalefactor, size, mean, swapRB, crop, ddepth);
+        returnValue = cv::dnn::blobFromImages(images, scalefactor, size, mean, swapRB, crop, blobDepth);
+      }
+      if (blobDepth != ddepth) {
+        returnValue.convertTo(returnValue, ddepth);
       }
 #else
+      if (ddepth != CV_32F) {
+        return "ddepth requires OpenCV 3.4.3 or newer, only CV_32F blobs are supported";
+      }
       if (isSingleImage) {
         returnValue = cv::dnn::blobFromImage(image, scalefactor, size, mean, swapRB);
       }
@@ -180,35 +202,543 @@ namespace DnnBindings {
     }
   };
 
+  // letterboxes every image into the blob: resize with preserved aspect ratio, pad with padValue,
+  // apply (pixel - mean) * scalefactor / std and write straight into the NCHW or NHWC output
+  struct BlobFromImageLetterboxWorker : public CatchCvExceptionWorker {
+  public:
+    bool isSingleImage;
+    BlobFromImageLetterboxWorker(bool isSingleImage = true) {
+      this->isSingleImage = isSingleImage;
+    }
+
+    cv::Mat image;
+    std::vector<cv::Mat> images;
+    cv::Size2d size;
+    double scalefactor = 1.0;
+    cv::Vec3d mean = cv::Vec3d();
+    cv::Vec3d std = cv::Vec3d(1.0, 1.0, 1.0);
+    bool swapRB = true;
+    double padValue = 0.0;
+    std::string layout = "NCHW";
+    int interpolation = cv::INTER_LINEAR;
+    int ddepth = CV_32F;
+
+    cv::Mat blob;
+    std::vector<double> scales;
+    std::vector<int> padsLeft;
+    std::vector<int> padsTop;
+
+    template<typename TDst, typename TSrc>
+    static void writeRow(TDst* dst, const TSrc* src, int numPixels, int cn, const int* channelMap,
+      const float* alpha, const float* beta, size_t pixelStep, size_t channelStep) {
+      for (int x = 0; x < numPixels; x++) {
+        for (int c = 0; c < cn; c++) {
+          dst[x * pixelStep + c * channelStep] = (TDst)((float)src[x * cn + channelMap[c]] * alpha[c] + beta[c]);
+        }
+      }
+    }
+
+    template<typename TDst>
+    static void fillRow(TDst* dst, int numPixels, int cn, const float* padVals,
+      size_t pixelStep, size_t channelStep) {
+      for (int x = 0; x < numPixels; x++) {
+        for (int c = 0; c < cn; c++) {
+          dst[x * pixelStep + c * channelStep] = (TDst)padVals[c];
+        }
+      }
+    }
+
+    template<typename TDst>
+    void writeImage(int n, const cv::Mat& resized, int padLeft, int padTop, const int* channelMap,
+      const float* alpha, const float* beta, const float* padVals) {
+      const int dstW = (int)size.width;
+      const int dstH = (int)size.height;
+      const int newW = resized.cols;
+      const int newH = resized.rows;
+      const int cn = resized.channels();
+      const bool isNHWC = layout == "NHWC";
+
+      TDst* base = blob.ptr<TDst>(n);
+      const size_t planeSize = (size_t)dstW * dstH;
+      const size_t pixelStep = isNHWC ? cn : 1;
+      const size_t channelStep = isNHWC ? 1 : planeSize;
+
+      for (int y = 0; y < dstH; y++) {
+        TDst* row = base + (size_t)y * dstW * pixelStep;
+        int srcY = y - padTop;
+        if (srcY < 0 || srcY >= newH) {
+          fillRow(row, dstW, cn, padVals, pixelStep, channelStep);
+          continue;
+        }
+        fillRow(row, padLeft, cn, padVals, pixelStep, channelStep);
+        TDst* content = row + padLeft * pixelStep;
+        if (resized.depth() == CV_8U) {
+          writeRow(content, resized.ptr<uchar>(srcY), newW, cn, channelMap, alpha, beta, pixelStep, channelStep);
+        }
+        else {
+          writeRow(content, resized.ptr<float>(srcY), newW, cn, channelMap, alpha, beta, pixelStep, channelStep);
+        }
+        fillRow(content + newW * pixelStep, dstW - padLeft - newW, cn, padVals, pixelStep, channelStep);
+      }
+    }
+
+    void letterbox(int n) {
+      const cv::Mat& img = images[n];
+      const int dstW = (int)size.width;
+      const int dstH = (int)size.height;
+      const int cn = img.channels();
+
+      double scale = std::min((double)dstW / img.cols, (double)dstH / img.rows);
+      int newW = std::max(1, std::min(dstW, (int)std::round(img.cols * scale)));
+      int newH = std::max(1, std::min(dstH, (int)std::round(img.rows * scale)));
+      int padLeft = (dstW - newW) / 2;
+      int padTop = (dstH - newH) / 2;
+      scales[n] = scale;
+      padsLeft[n] = padLeft;
+      padsTop[n] = padTop;
+
+      cv::Mat resized = img;
+      if (newW != img.cols || newH != img.rows) {
+        cv::resize(img, resized, cv::Size(newW, newH), 0, 0, interpolation);
+      }
+      if (resized.depth() != CV_8U && resized.depth() != CV_32F) {
+        resized.convertTo(resized, CV_32F);
+      }
+
+      int channelMap[4] = { 0, 1, 2, 3 };
+      if (swapRB && cn >= 3) {
+        std::swap(channelMap[0], channelMap[2]);
+      }
+      float alpha[4], beta[4], padVals[4];
+      for (int c = 0; c < cn; c++) {
+        double m = c < 3 ? mean[c] : 0.0;
+        double s = c < 3 && std[c] != 0 ? std[c] : 1.0;
+        alpha[c] = (float)(scalefactor / s);
+        beta[c] = (float)(-m * scalefactor / s);
+        padVals[c] = (float)((padValue - m) * scalefactor / s);
+      }
+
+#ifdef CV_16F
+      if (ddepth == CV_16F) {
+        writeImage<cv::float16_t>(n, resized, padLeft, padTop, channelMap, alpha, beta, padVals);
+        return;
+      }
+#endif
+      writeImage<float>(n, resized, padLeft, padTop, channelMap, alpha, beta, padVals);
+    }
+
+    std::string executeCatchCvExceptionWorker() {
+      if (isSingleImage) {
+        images = std::vector<cv::Mat>(1, image);
+      }
+      if (images.empty()) {
+        return "expected at least one image";
+      }
+      if (size.width < 1 || size.height < 1) {
+        return "expected size to be at least 1x1";
+      }
+      if (layout != "NCHW" && layout != "NHWC") {
+        return "expected layout to be one of 'NCHW' or 'NHWC', have: " + layout;
+      }
+#ifdef CV_16F
+      if (ddepth != CV_32F && ddepth != CV_16F) {
+        return "expected ddepth to be CV_32F or CV_16F";
+      }
+#else
+      if (ddepth != CV_32F) {
+        return "expected ddepth to be CV_32F";
+      }
+#endif
+      int cn = images[0].channels();
+      for (size_t i = 0; i < images.size(); i++) {
+        if (images[i].empty()) {
+          return "image " + std::to_string(i) + " is empty";
+        }
+        if (images[i].channels() != cn || cn > 4) {
+          return "expected all images to have the same number of channels (at most 4)";
+        }
+      }
+
+      int numImages = (int)images.size();
+      int dstW = (int)size.width;
+      int dstH = (int)size.height;
+      if (layout == "NHWC") {
+        int sz[] = { numImages, dstH, dstW, cn };
+        blob.create(4, sz, ddepth);
+      }
+      else {
+        int sz[] = { numImages, cn, dstH, dstW };
+        blob.create(4, sz, ddepth);
+      }
+      scales = std::vector<double>(numImages);
+      padsLeft = std::vector<int>(numImages);
+      padsTop = std::vector<int>(numImages);
+
+      return ParallelUtils::forEachStripe(numImages, [&](int n) {
+        letterbox(n);
+      });
+    }
+
+    v8::Local<v8::Object> wrapScaleInfo(int n) {
+      v8::Local<v8::Object> scaleInfo = Nan::New<v8::Object>();
+      Nan::Set(scaleInfo, Nan::New("scale").ToLocalChecked(), FF::DoubleConverter::wrap(scales[n]));
+      Nan::Set(scaleInfo, Nan::New("padLeft").ToLocalChecked(), FF::IntConverter::wrap(padsLeft[n]));
+      Nan::Set(scaleInfo, Nan::New("padTop").ToLocalChecked(), FF::IntConverter::wrap(padsTop[n]));
+      return scaleInfo;
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("blob").ToLocalChecked(), Mat::Converter::wrap(blob));
+      if (isSingleImage) {
+        Nan::Set(ret, Nan::New("scaleInfo").ToLocalChecked(), wrapScaleInfo(0));
+      }
+      else {
+        v8::Local<v8::Array> scaleInfos = Nan::New<v8::Array>(scales.size());
+        for (int n = 0; n < (int)scales.size(); n++) {
+          Nan::Set(scaleInfos, n, wrapScaleInfo(n));
+        }
+        Nan::Set(ret, Nan::New("scaleInfo").ToLocalChecked(), scaleInfos);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        ((isSingleImage && Mat::Converter::arg(0, &image, info)) ||
+        (!isSingleImage && Mat::ArrayConverter::arg(0, &images, info))) ||
+        Size::Converter::arg(1, &size, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(2, &scalefactor, info) ||
+        Vec3::Converter::optArg(3, &mean, info) ||
+        Vec3::Converter::optArg(4, &std, info) ||
+        FF::BoolConverter::optArg(5, &swapRB, info) ||
+        FF::DoubleConverter::optArg(6, &padValue, info) ||
+        FF::StringConverter::optArg(7, &layout, info) ||
+        FF::IntConverter::optArg(8, &interpolation, info) ||
+        FF::IntConverter::optArg(9, &ddepth, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 2);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[2]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&scalefactor, "scalefactor", opts) ||
+        Vec3::Converter::optProp(&mean, "mean", opts) ||
+        Vec3::Converter::optProp(&std, "std", opts) ||
+        FF::BoolConverter::optProp(&swapRB, "swapRB", opts) ||
+        FF::DoubleConverter::optProp(&padValue, "padValue", opts) ||
+        FF::StringConverter::optProp(&layout, "layout", opts) ||
+        FF::IntConverter::optProp(&interpolation, "interpolation", opts) ||
+        FF::IntConverter::optProp(&ddepth, "ddepth", opts)
+      );
+    }
+  };
+
+  // decodes raw yolo or ssd output blobs into packed boxes, scores and class ids and applies nms,
+  // the batch variant decodes the outputs of a batched forward pass per image in parallel
+  struct DecodeDetectionsWorker : public CatchCvExceptionWorker {
+  public:
+    bool isBatch;
+    DecodeDetectionsWorker(bool isBatch = false) {
+      this->isBatch = isBatch;
+    }
+
+    std::vector<cv::Mat> outputs;
+    DnnUtils::DecodeParams params;
+    int batchSize = 0;
+
+    std::vector<DnnUtils::Detections> results;
+
+    int inferBatchSize() {
+      if (batchSize > 0) {
+        return batchSize;
+      }
+      if (params.scaleInfos.size() > 0) {
+        return (int)params.scaleInfos.size();
+      }
+      int numImages = 1;
+      for (const cv::Mat& out : outputs) {
+        if (params.format == "ssd") {
+          const float* data = out.ptr<float>();
+          for (size_t r = 0; r < out.total() / 7; r++) {
+            numImages = std::max(numImages, (int)data[r * 7] + 1);
+          }
+        }
+        else if (out.dims == 3) {
+          numImages = std::max(numImages, out.size[0]);
+        }
+      }
+      return numImages;
+    }
+
+    std::string executeCatchCvExceptionWorker() {
+      std::string err = DnnUtils::validateDecodeParams(params);
+      if (!err.empty()) {
+        return err;
+      }
+      for (const cv::Mat& out : outputs) {
+        if (out.depth() != CV_32F || !out.isContinuous()) {
+          return "expected outputs to be continuous CV_32F Mats";
+        }
+      }
+
+      int numImages = isBatch ? inferBatchSize() : 1;
+      if (params.format == "yolo") {
+        err = DnnUtils::validateYoloOutputs(outputs, numImages);
+        if (!err.empty()) {
+          return err;
+        }
+      }
+      results = std::vector<DnnUtils::Detections>(numImages);
+      return ParallelUtils::forEachStripe(numImages, [&](int n) {
+        results[n] = DnnUtils::decodeDetections(outputs, n, numImages, params);
+      });
+    }
+
+    static v8::Local<v8::Object> wrapDetections(const DnnUtils::Detections& dets) {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("boxes").ToLocalChecked(), FF::Float32TypedArrayConverter::wrap(dets.boxes));
+      Nan::Set(ret, Nan::New("scores").ToLocalChecked(), FF::Float32TypedArrayConverter::wrap(dets.scores));
+      Nan::Set(ret, Nan::New("classIds").ToLocalChecked(), FF::Int32TypedArrayConverter::wrap(dets.classIds));
+      return ret;
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      if (!isBatch) {
+        return wrapDetections(results[0]);
+      }
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(results.size());
+      for (int n = 0; n < (int)results.size(); n++) {
+        Nan::Set(ret, n, wrapDetections(results[n]));
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (info[0]->IsArray()) {
+        return Mat::ArrayConverter::arg(0, &outputs, info);
+      }
+      outputs = std::vector<cv::Mat>(1);
+      return Mat::Converter::arg(0, &outputs[0], info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::StringConverter::optArg(1, &params.format, info) ||
+        FF::FloatConverter::optArg(2, &params.confThreshold, info) ||
+        FF::FloatConverter::optArg(3, &params.nmsThreshold, info) ||
+        FF::BoolConverter::optArg(4, &params.classAware, info) ||
+        FF::IntConverter::optArg(5, &params.topK, info) ||
+        Size::Converter::optArg(6, &params.inputSize, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      v8::Local<v8::String> scaleInfoKey = Nan::New("inputScaleInfo").ToLocalChecked();
+      return (
+        FF::StringConverter::optProp(&params.format, "format", opts) ||
+        FF::FloatConverter::optProp(&params.confThreshold, "confThreshold", opts) ||
+        FF::FloatConverter::optProp(&params.nmsThreshold, "nmsThreshold", opts) ||
+        FF::BoolConverter::optProp(&params.classAware, "classAware", opts) ||
+        FF::IntConverter::optProp(&params.topK, "topK", opts) ||
+        Size::Converter::optProp(&params.inputSize, "inputSize", opts) ||
+        FF::IntConverter::optProp(&batchSize, "batchSize", opts) ||
+        (Nan::HasOwnProperty(opts, scaleInfoKey).FromJust() &&
+          DnnUtils::unwrapScaleInfos(&params.scaleInfos, Nan::Get(opts, scaleInfoKey).ToLocalChecked()))
+      );
+    }
+  };
+
 #if CV_VERSION_MINOR > 3
+  // scores and class ids can be passed as typed arrays or as plain js arrays
+  static inline bool unwrapFloatsArg(int argN, std::vector<float>* vec, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (FF::Float32TypedArrayConverter::isTypedArray(info[argN])) {
+      return FF::Float32TypedArrayConverter::arg(argN, vec, info);
+    }
+    return FF::FloatArrayConverter::arg(argN, vec, info);
+  }
+
+  static inline bool unwrapIntsArg(int argN, std::vector<int>* vec, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (FF::Int32TypedArrayConverter::isTypedArray(info[argN])) {
+      return FF::Int32TypedArrayConverter::arg(argN, vec, info);
+    }
+    return FF::IntArrayConverter::arg(argN, vec, info);
+  }
+
+  // boxes are either an array of Rects or a Float32Array of packed [x, y, width, height] rows,
+  // packed input skips wrapping every box and returns the kept indices as an Int32Array
   struct NMSBoxes : public CatchCvExceptionWorker {
   public:
     std::vector<cv::Rect> bboxes;
+    std::vector<float> packedBoxes;
+    std::vector<float> scores;
+    float score_threshold;
+    float nms_threshold;
+    int topK = 0;
+    std::vector<int> indices;
+
+    bool isPacked = false;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (isPacked) {
+        if (packedBoxes.size() != 4 * scores.size()) {
+          return "expected 4 box values per score, have " + std::to_string(packedBoxes.size())
+            + " box values and " + std::to_string(scores.size()) + " scores";
+        }
+        indices = DnnUtils::nms(packedBoxes.data(), scores.data(), NULL, (int)scores.size(),
+          score_threshold, nms_threshold, false, topK);
+        return "";
+      }
+      if (bboxes.size() != scores.size()) {
+        return "expected one score per box";
+      }
+      // top_k of cv::dnn::NMSBoxes limits the candidates, topK limits the kept boxes as for packed boxes
+      cv::dnn::NMSBoxes(bboxes, scores, score_threshold, nms_threshold, indices);
+      if (topK > 0 && (int)indices.size() > topK) {
+        indices.resize(topK);
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      if (isPacked) {
+        return FF::Int32TypedArrayConverter::wrap(indices);
+      }
+      return FF::IntArrayConverter::wrap(indices);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      isPacked = FF::Float32TypedArrayConverter::isTypedArray(info[0]);
+      return (
+        (isPacked && FF::Float32TypedArrayConverter::arg(0, &packedBoxes, info)) ||
+        (!isPacked && Rect::ArrayWithCastConverter<cv::Rect>::arg(0, &bboxes, info)) ||
+        unwrapFloatsArg(1, &scores, info) ||
+        FF::FloatConverter::arg(2, &score_threshold, info) ||
+        FF::FloatConverter::arg(3, &nms_threshold, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::IntConverter::optArg(4, &topK, info)
+      );
+    }
+  };
+
+  // class aware nms over all classes in one call, boxes only suppress boxes of the same class
+  struct NMSBoxesBatched : public CatchCvExceptionWorker {
+  public:
+    std::vector<float> boxes;
+    std::vector<float> scores;
+    std::vector<int> classIds;
+    float score_threshold;
+    float nms_threshold;
+    int topK = 0;
+    std::vector<int> indices;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (boxes.size() != 4 * scores.size() || classIds.size() != scores.size()) {
+        return "expected 4 box values and one class id per score";
+      }
+      indices = DnnUtils::nms(boxes.data(), scores.data(), classIds.data(), (int)scores.size(),
+        score_threshold, nms_threshold, true, topK);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return FF::Int32TypedArrayConverter::wrap(indices);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::Float32TypedArrayConverter::arg(0, &boxes, info) ||
+        unwrapFloatsArg(1, &scores, info) ||
+        unwrapIntsArg(2, &classIds, info) ||
+        FF::FloatConverter::arg(3, &score_threshold, info) ||
+        FF::FloatConverter::arg(4, &nms_threshold, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::IntConverter::optArg(5, &topK, info)
+      );
+    }
+  };
+
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 4 || CV_VERSION_REVISION > 1
+  // boxes are either an array of RotatedRects or a Float32Array of packed [cx, cy, width, height, angle] rows
+  struct NMSBoxesRotated : public CatchCvExceptionWorker {
+  public:
+    std::vector<cv::RotatedRect> bboxes;
+    std::vector<float> packedBoxes;
     std::vector<float> scores;
     float score_threshold;
     float nms_threshold;
+    int topK = 0;
     std::vector<int> indices;
 
+    bool isPacked = false;
+
     std::string executeCatchCvExceptionWorker() {
-      cv::dnn::NMSBoxes(bboxes, scores, score_threshold,
-          nms_threshold, indices);
+      if (isPacked) {
+        if (packedBoxes.size() != 5 * scores.size()) {
+          return "expected 5 box values per score";
+        }
+        bboxes.reserve(scores.size());
+        for (size_t i = 0; i < scores.size(); i++) {
+          const float* b = &packedBoxes[5 * i];
+          bboxes.push_back(cv::RotatedRect(cv::Point2f(b[0], b[1]), cv::Size2f(b[2], b[3]), b[4]));
+        }
+      }
+      // top_k of cv::dnn::NMSBoxes limits the candidates, topK limits the kept boxes as for NMSBoxes
+      cv::dnn::NMSBoxes(bboxes, scores, score_threshold, nms_threshold, indices);
+      if (topK > 0 && (int)indices.size() > topK) {
+        indices.resize(topK);
+      }
       return "";
     }
 
     v8::Local<v8::Value> getReturnValue() {
+      if (isPacked) {
+        return FF::Int32TypedArrayConverter::wrap(indices);
+      }
       return FF::IntArrayConverter::wrap(indices);
     }
 
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      isPacked = FF::Float32TypedArrayConverter::isTypedArray(info[0]);
       return (
-        Rect::ArrayWithCastConverter<cv::Rect>::arg(0, &bboxes, info) ||
-        FF::FloatArrayConverter::arg(1, &scores, info) ||
+        (isPacked && FF::Float32TypedArrayConverter::arg(0, &packedBoxes, info)) ||
+        (!isPacked && RotatedRect::ArrayConverter::arg(0, &bboxes, info)) ||
+        unwrapFloatsArg(1, &scores, info) ||
         FF::FloatConverter::arg(2, &score_threshold, info) ||
         FF::FloatConverter::arg(3, &nms_threshold, info)
       );
     }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::IntConverter::optArg(4, &topK, info)
+      );
+    }
   };
 #endif
+#endif
 }
 
 #endif
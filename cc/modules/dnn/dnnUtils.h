@@ -0,0 +1,265 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+#ifndef __FF_DNNUTILS_H__
+#define __FF_DNNUTILS_H__
+
+namespace DnnUtils {
+
+  // scale and padding applied by blobFromImageLetterbox, used to map boxes back onto the source image
+  struct ScaleInfo {
+    double scale = 1.0;
+    double padLeft = 0.0;
+    double padTop = 0.0;
+  };
+
+  static inline bool unwrapScaleInfo(ScaleInfo* scaleInfo, v8::Local<v8::Value> val) {
+    if (!val->IsObject()) {
+      Nan::ThrowError("expected scaleInfo to be an object");
+      return true;
+    }
+    v8::Local<v8::Object> obj = val->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+    return (
+      FF::DoubleConverter::optProp(&scaleInfo->scale, "scale", obj) ||
+      FF::DoubleConverter::optProp(&scaleInfo->padLeft, "padLeft", obj) ||
+      FF::DoubleConverter::optProp(&scaleInfo->padTop, "padTop", obj)
+    );
+  }
+
+  static inline bool unwrapScaleInfos(std::vector<ScaleInfo>* scaleInfos, v8::Local<v8::Value> val) {
+    if (!val->IsArray()) {
+      scaleInfos->resize(1);
+      return unwrapScaleInfo(&scaleInfos->at(0), val);
+    }
+    v8::Local<v8::Array> arr = v8::Local<v8::Array>::Cast(val);
+    scaleInfos->resize(arr->Length());
+    for (uint i = 0; i < arr->Length(); i++) {
+      if (unwrapScaleInfo(&scaleInfos->at(i), Nan::Get(arr, i).ToLocalChecked())) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // candidate boxes in packed [x, y, width, height] layout
+  struct Detections {
+    std::vector<float> boxes;
+    std::vector<float> scores;
+    std::vector<int> classIds;
+
+    size_t size() const {
+      return scores.size();
+    }
+
+    void push(float x, float y, float w, float h, float score, int classId) {
+      boxes.push_back(x);
+      boxes.push_back(y);
+      boxes.push_back(w);
+      boxes.push_back(h);
+      scores.push_back(score);
+      classIds.push_back(classId);
+    }
+
+    Detections select(const std::vector<int>& indices) const {
+      Detections selected;
+      selected.boxes.reserve(indices.size() * 4);
+      selected.scores.reserve(indices.size());
+      selected.classIds.reserve(indices.size());
+      for (int idx : indices) {
+        selected.push(boxes[4 * idx], boxes[4 * idx + 1], boxes[4 * idx + 2], boxes[4 * idx + 3], scores[idx], classIds[idx]);
+      }
+      return selected;
+    }
+  };
+
+  // computed in double and rounded as the rect overlap of cv::dnn::NMSBoxes
+  static inline float iou(const float* a, const float* b) {
+    double x1 = std::max((double)a[0], (double)b[0]);
+    double y1 = std::max((double)a[1], (double)b[1]);
+    double x2 = std::min((double)a[0] + a[2], (double)b[0] + b[2]);
+    double y2 = std::min((double)a[1] + a[3], (double)b[1] + b[3]);
+    double areaSum = (double)a[2] * a[3] + (double)b[2] * b[3];
+    if (areaSum <= std::numeric_limits<float>::epsilon()) {
+      return 1.0f;
+    }
+    double inter = std::max(0.0, x2 - x1) * std::max(0.0, y2 - y1);
+    return 1.f - (float)(1.0 - inter / (areaSum - inter));
+  }
+
+  // greedy non maximum suppression over packed boxes as cv::dnn::NMSBoxes, boxes scoring above scoreThreshold
+  // are kept unless they overlap a kept box by more than nmsThreshold, if classAware is set boxes are only
+  // suppressed by boxes of the same class, returns kept indices sorted by score
+  static inline std::vector<int> nms(const float* boxes, const float* scores, const int* classIds, int numBoxes,
+    float scoreThreshold, float nmsThreshold, bool classAware, int topK = 0) {
+    std::vector<int> order;
+    order.reserve(numBoxes);
+    for (int i = 0; i < numBoxes; i++) {
+      if (scores[i] > scoreThreshold) {
+        order.push_back(i);
+      }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return scores[a] > scores[b]; });
+
+    std::vector<int> keep;
+    std::vector<bool> suppressed(order.size(), false);
+    for (size_t i = 0; i < order.size(); i++) {
+      if (suppressed[i]) {
+        continue;
+      }
+      int idx = order[i];
+      keep.push_back(idx);
+      if (topK > 0 && (int)keep.size() >= topK) {
+        break;
+      }
+      for (size_t j = i + 1; j < order.size(); j++) {
+        int other = order[j];
+        if (suppressed[j] || (classAware && classIds && classIds[idx] != classIds[other])) {
+          continue;
+        }
+        if (iou(&boxes[4 * idx], &boxes[4 * other]) > nmsThreshold) {
+          suppressed[j] = true;
+        }
+      }
+    }
+    return keep;
+  }
+
+  struct DecodeParams {
+    std::string format = "yolo";
+    float confThreshold = 0.5f;
+    float nmsThreshold = 0.4f;
+    bool classAware = true;
+    int topK = 0;
+    cv::Size2d inputSize = cv::Size2d();
+    std::vector<ScaleInfo> scaleInfos;
+  };
+
+  // darknet / opencv yolo output rows: [cx, cy, w, h, objectness, class scores...] with normalized coordinates,
+  // 3 dimensional outputs are indexed by image along the first axis, 2 dimensional outputs are split evenly
+  static inline void decodeYolo(const std::vector<cv::Mat>& outputs, int imgIdx, int numImages,
+    const DecodeParams& params, Detections* dets) {
+    for (const cv::Mat& out : outputs) {
+      const float* data;
+      int rows, cols;
+      if (out.dims == 3) {
+        rows = out.size[1];
+        cols = out.size[2];
+        data = out.ptr<float>(imgIdx);
+      }
+      else {
+        rows = out.rows / numImages;
+        cols = out.cols;
+        data = out.ptr<float>(imgIdx * rows);
+      }
+      if (cols <= 5) {
+        continue;
+      }
+      for (int r = 0; r < rows; r++) {
+        const float* row = data + (size_t)r * cols;
+        const float* classScores = row + 5;
+        int classId = (int)(std::max_element(classScores, row + cols) - classScores);
+        float score = classScores[classId];
+        if (score < params.confThreshold) {
+          continue;
+        }
+        dets->push(row[0] - row[2] / 2, row[1] - row[3] / 2, row[2], row[3], score, classId);
+      }
+    }
+  }
+
+  // ssd detection_out rows: [imageId, classId, confidence, left, top, right, bottom] with normalized coordinates
+  static inline void decodeSsd(const std::vector<cv::Mat>& outputs, int imgIdx, int numImages,
+    const DecodeParams& params, Detections* dets) {
+    for (const cv::Mat& out : outputs) {
+      const float* data = out.ptr<float>();
+      size_t numRows = out.total() / 7;
+      for (size_t r = 0; r < numRows; r++) {
+        const float* row = data + r * 7;
+        if (numImages > 1 && (int)row[0] != imgIdx) {
+          continue;
+        }
+        if (row[2] < params.confThreshold) {
+          continue;
+        }
+        dets->push(row[3], row[4], row[5] - row[3], row[6] - row[4], row[2], (int)row[1]);
+      }
+    }
+  }
+
+  static inline void toImageCoordinates(Detections* dets, const DecodeParams& params, int imgIdx) {
+    if (params.inputSize.width <= 0 || params.inputSize.height <= 0) {
+      return;
+    }
+    ScaleInfo scaleInfo;
+    if (params.scaleInfos.size() > 0) {
+      scaleInfo = params.scaleInfos[std::min(imgIdx, (int)params.scaleInfos.size() - 1)];
+    }
+    float sx = (float)(params.inputSize.width / scaleInfo.scale);
+    float sy = (float)(params.inputSize.height / scaleInfo.scale);
+    float ox = (float)(scaleInfo.padLeft / scaleInfo.scale);
+    float oy = (float)(scaleInfo.padTop / scaleInfo.scale);
+    for (size_t i = 0; i < dets->size(); i++) {
+      float* box = &dets->boxes[4 * i];
+      box[0] = box[0] * sx - ox;
+      box[1] = box[1] * sy - oy;
+      box[2] = box[2] * sx;
+      box[3] = box[3] * sy;
+    }
+  }
+
+  static inline std::string validateDecodeParams(const DecodeParams& params) {
+    if (params.format != "yolo" && params.format != "ssd") {
+      return "expected format to be one of 'yolo' or 'ssd', have: " + params.format;
+    }
+    if (params.scaleInfos.size() > 0 && (params.inputSize.width <= 0 || params.inputSize.height <= 0)) {
+      return "inputSize is required to apply inputScaleInfo";
+    }
+    return "";
+  }
+
+  // yolo outputs have to provide numImages entries along the first axis, or rows divisible by numImages
+  static inline std::string validateYoloOutputs(const std::vector<cv::Mat>& outputs, int numImages) {
+    for (const cv::Mat& out : outputs) {
+      if (out.dims == 3 && numImages > out.size[0]) {
+        return "expected outputs to have at least " + std::to_string(numImages) + " images, have: " + std::to_string(out.size[0]);
+      }
+      if (out.dims != 3 && out.rows % numImages != 0) {
+        return "expected output rows (" + std::to_string(out.rows) + ") to be divisible by the number of images ("
+          + std::to_string(numImages) + ")";
+      }
+    }
+    return "";
+  }
+
+  static inline Detections decodeDetections(const std::vector<cv::Mat>& outputs, int imgIdx, int numImages,
+    const DecodeParams& params) {
+    Detections candidates;
+    if (params.format == "ssd") {
+      decodeSsd(outputs, imgIdx, numImages, params, &candidates);
+    }
+    else {
+      decodeYolo(outputs, imgIdx, numImages, params, &candidates);
+    }
+    toImageCoordinates(&candidates, params, imgIdx);
+    if (params.nmsThreshold <= 0 || candidates.size() == 0) {
+      return candidates;
+    }
+    std::vector<int> keep = nms(
+      candidates.boxes.data(),
+      candidates.scores.data(),
+      candidates.classIds.data(),
+      (int)candidates.size(),
+      params.confThreshold,
+      params.nmsThreshold,
+      params.classAware,
+      params.topK
+    );
+    return candidates.select(keep);
+  }
+
+}
+
+#endif
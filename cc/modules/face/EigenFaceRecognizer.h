@@ -26,6 +26,18 @@ public:
 	cv::Ptr<cv::face::FaceRecognizer> getFaceRecognizer() {
 		return faceRecognizer;
 	}
+
+	cv::Ptr<cv::face::FaceRecognizer> createFaceRecognizer() {
+#if CV_VERSION_MINOR < 3
+		return cv::face::createEigenFaceRecognizer();
+#else
+		return cv::face::EigenFaceRecognizer::create();
+#endif
+	}
+
+	void setFaceRecognizer(cv::Ptr<cv::face::FaceRecognizer> faceRecognizer) {
+		this->faceRecognizer = faceRecognizer;
+	}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+#ifdef HAVE_FACE
+
+#include "FaceGallery.h"
+#include "FaceGalleryBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> FaceGallery::constructor;
+
+NAN_MODULE_INIT(FaceGallery::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(FaceGallery::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  instanceTemplate->SetInternalFieldCount(1);
+  ctor->SetClassName(Nan::New("FaceGallery").ToLocalChecked());
+
+  Nan::SetAccessor(instanceTemplate, Nan::New("dims").ToLocalChecked(), dims_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("metric").ToLocalChecked(), metric_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("numEmbeddings").ToLocalChecked(), numEmbeddings_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("numIds").ToLocalChecked(), numIds_getter);
+
+  Nan::SetPrototypeMethod(ctor, "add", Add);
+  Nan::SetPrototypeMethod(ctor, "remove", Remove);
+  Nan::SetPrototypeMethod(ctor, "clear", Clear);
+  Nan::SetPrototypeMethod(ctor, "query", Query);
+  Nan::SetPrototypeMethod(ctor, "queryAsync", QueryAsync);
+  Nan::SetPrototypeMethod(ctor, "save", Save);
+  Nan::SetPrototypeMethod(ctor, "saveAsync", SaveAsync);
+  Nan::SetPrototypeMethod(ctor, "load", Load);
+  Nan::SetPrototypeMethod(ctor, "loadAsync", LoadAsync);
+
+  Nan::Set(target, Nan::New("FaceGallery").ToLocalChecked(), FF::getFunction(ctor));
+};
+
+NAN_METHOD(FaceGallery::New) {
+  FF::TryCatch tryCatch("FaceGallery::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+  FaceGallery::NewWorker worker;
+
+  if (worker.applyUnwrappers(info)) {
+    return tryCatch.reThrow();
+  }
+  if (worker.dims < 1) {
+    return tryCatch.throwError("expected dims to be at least 1");
+  }
+  int metric = FaceGalleryState::getMetricCode(worker.metric);
+  if (metric < 0) {
+    return tryCatch.throwError("expected metric to be one of 'cosine' or 'l2', have: " + worker.metric);
+  }
+
+  FaceGallery* self = new FaceGallery();
+  self->self = std::make_shared<FaceGalleryState>(worker.dims, (FaceGalleryState::Metric)metric);
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(FaceGallery::Add) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceGalleryBindings::AddWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::Add",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::Remove) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceGalleryBindings::RemoveWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::Remove",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::Clear) {
+  FaceGallery::unwrapSelf(info)->clear();
+}
+
+NAN_METHOD(FaceGallery::Query) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceGalleryBindings::QueryWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::Query",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::QueryAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceGalleryBindings::QueryWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::QueryAsync",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::Save) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceGalleryBindings::SaveWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::Save",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::SaveAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceGalleryBindings::SaveWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::SaveAsync",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::Load) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceGalleryBindings::LoadWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::Load",
+    info
+  );
+}
+
+NAN_METHOD(FaceGallery::LoadAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceGalleryBindings::LoadWorker>(FaceGallery::unwrapSelf(info)),
+    "FaceGallery::LoadAsync",
+    info
+  );
+}
+
+#endif // HAVE_FACE
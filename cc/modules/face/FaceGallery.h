@@ -0,0 +1,64 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include "Mat.h"
+#include "CatchCvExceptionWorker.h"
+#include "FaceGalleryState.h"
+
+#ifndef __FF_FACEGALLERY_H__
+#define __FF_FACEGALLERY_H__
+
+class FaceGallery : public FF::ObjectWrap<FaceGallery, std::shared_ptr<FaceGalleryState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "FaceGallery";
+	}
+
+	FF_GETTER_CUSTOM(dims, FF::IntConverter, self->getDims());
+	FF_GETTER_CUSTOM(metric, FF::StringConverter, self->getMetric());
+	FF_GETTER_CUSTOM(numEmbeddings, FF::IntConverter, self->getNumEmbeddings());
+	FF_GETTER_CUSTOM(numIds, FF::IntConverter, self->getNumIds());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(Add);
+	static NAN_METHOD(Remove);
+	static NAN_METHOD(Clear);
+	static NAN_METHOD(Query);
+	static NAN_METHOD(QueryAsync);
+	static NAN_METHOD(Save);
+	static NAN_METHOD(SaveAsync);
+	static NAN_METHOD(Load);
+	static NAN_METHOD(LoadAsync);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		int dims;
+		std::string metric = "cosine";
+
+		bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::IntConverter::arg(0, &dims, info);
+		}
+
+		bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::StringConverter::optArg(1, &metric, info);
+		}
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 1);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return FF::StringConverter::optProp(&metric, "metric", opts);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			return "";
+		}
+	};
+};
+
+#endif
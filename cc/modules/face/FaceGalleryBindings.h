@@ -0,0 +1,154 @@
+#include "FaceGallery.h"
+
+#ifndef __FF_FACEGALLERYBINDINGS_H_
+#define __FF_FACEGALLERYBINDINGS_H_
+
+namespace FaceGalleryBindings {
+
+  // an id or an array of ids
+  static inline bool unwrapIds(int argN, std::vector<int>* ids, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (FF::hasArg(info, argN) && info[argN]->IsNumber()) {
+      ids->resize(1);
+      return FF::IntConverter::arg(argN, &(*ids)[0], info);
+    }
+    return FF::IntArrayConverter::arg(argN, ids, info);
+  }
+
+  struct AddWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<FaceGalleryState> self;
+    AddWorker(std::shared_ptr<FaceGalleryState> self) {
+      this->self = self;
+    }
+
+    std::vector<int> ids;
+    cv::Mat embeddings;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->add(ids, embeddings);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return unwrapIds(0, &ids, info)
+        || Mat::Converter::arg(1, &embeddings, info);
+    }
+  };
+
+  struct RemoveWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<FaceGalleryState> self;
+    RemoveWorker(std::shared_ptr<FaceGalleryState> self) {
+      this->self = self;
+    }
+
+    std::vector<int> ids;
+
+    int numRemoved = 0;
+
+    std::string executeCatchCvExceptionWorker() {
+      numRemoved = self->remove(ids);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return unwrapIds(0, &ids, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return FF::IntConverter::wrap(numRemoved);
+    }
+  };
+
+  // returns the topK matches for each row of queries
+  struct QueryWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<FaceGalleryState> self;
+    QueryWorker(std::shared_ptr<FaceGalleryState> self) {
+      this->self = self;
+    }
+
+    cv::Mat queries;
+    int topK = 10;
+
+    std::vector<std::vector<FaceGalleryMatch>> results;
+
+    std::string executeCatchCvExceptionWorker() {
+      results = self->query(queries, topK);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &queries, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::optArg(1, &topK, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return FF::IntConverter::optProp(&topK, "topK", opts);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(results.size());
+      for (size_t i = 0; i < results.size(); i++) {
+        v8::Local<v8::Array> jsMatches = Nan::New<v8::Array>(results[i].size());
+        for (size_t j = 0; j < results[i].size(); j++) {
+          v8::Local<v8::Object> jsMatch = Nan::New<v8::Object>();
+          Nan::Set(jsMatch, Nan::New("id").ToLocalChecked(), FF::IntConverter::wrap(results[i][j].id));
+          Nan::Set(jsMatch, Nan::New("distance").ToLocalChecked(), FF::FloatConverter::wrap(results[i][j].distance));
+          Nan::Set(jsMatches, j, jsMatch);
+        }
+        Nan::Set(ret, i, jsMatches);
+      }
+      return ret;
+    }
+  };
+
+  struct SaveWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<FaceGalleryState> self;
+    SaveWorker(std::shared_ptr<FaceGalleryState> self) {
+      this->self = self;
+    }
+
+    std::string path;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->save(path);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::StringConverter::arg(0, &path, info);
+    }
+  };
+
+  struct LoadWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<FaceGalleryState> self;
+    LoadWorker(std::shared_ptr<FaceGalleryState> self) {
+      this->self = self;
+    }
+
+    std::string path;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->load(path);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::StringConverter::arg(0, &path, info);
+    }
+  };
+
+}
+
+#endif
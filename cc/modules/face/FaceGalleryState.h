@@ -0,0 +1,365 @@
+#include <opencv2/core.hpp>
+#include "fileUtils.h"
+#include "parallelUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#ifndef __FF_FACEGALLERYSTATE_H__
+#define __FF_FACEGALLERYSTATE_H__
+
+struct FaceGalleryMatch {
+	int id;
+	float distance;
+};
+
+// the k nearest distinct ids, ties are resolved by the smaller id
+class FaceGalleryTopK {
+public:
+	std::vector<FaceGalleryMatch> matches;
+
+	FaceGalleryTopK(int k) {
+		this->k = k;
+	}
+
+	void push(int id, float distance) {
+		FaceGalleryMatch match = { id, distance };
+		if ((int)matches.size() == k && !isBetter(match, matches.back())) {
+			return;
+		}
+		for (size_t i = 0; i < matches.size(); i++) {
+			if (matches[i].id == id) {
+				if (!isBetter(match, matches[i])) {
+					return;
+				}
+				matches.erase(matches.begin() + i);
+				break;
+			}
+		}
+		matches.insert(std::upper_bound(matches.begin(), matches.end(), match, isBetter), match);
+		if ((int)matches.size() > k) {
+			matches.pop_back();
+		}
+	}
+
+private:
+	int k;
+
+	static bool isBetter(const FaceGalleryMatch& a, const FaceGalleryMatch& b) {
+		return a.distance != b.distance ? a.distance < b.distance : a.id < b.id;
+	}
+};
+
+// up to FaceGallerySegment::capacity embeddings stored contiguously, the rows [0, ids.size()) are used
+struct FaceGallerySegment {
+	enum { capacity = 4096 };
+
+	cv::Mat embeddings;
+	std::vector<int> ids;
+	// squared norms of the embeddings for the L2 metric
+	std::vector<float> sqNorms;
+
+	FaceGallerySegment(int dims) {
+		embeddings = cv::Mat(capacity, dims, CV_32F);
+	}
+
+	int getNumRows() const {
+		return (int)ids.size();
+	}
+
+	std::shared_ptr<FaceGallerySegment> clone() const {
+		std::shared_ptr<FaceGallerySegment> segment = std::make_shared<FaceGallerySegment>(*this);
+		segment->embeddings = embeddings.clone();
+		return segment;
+	}
+};
+
+/* embeddings of enrolled faces, e.g. EigenFaceRecognizer projections or DNN embeddings, each id may have
+   several embeddings. The embeddings are stored in segments of contiguous rows. A query takes a snapshot
+   of the segment pointers and runs without holding the lock. add and remove copy a segment before
+   modifying it while a query still references it, such that queries run concurrently with each other
+   and with add, remove and load. Removing an embedding moves the last one into its row. */
+class FaceGalleryState {
+public:
+	enum Metric { COSINE = 0, L2 = 1 };
+
+	FaceGalleryState(int dims, Metric metric) {
+		this->dims = dims;
+		this->metric = metric;
+	}
+
+	static int getMetricCode(std::string name) {
+		return name == "cosine" ? COSINE : (name == "l2" ? L2 : -1);
+	}
+
+	static std::string getMetricName(int code) {
+		return code == COSINE ? "cosine" : "l2";
+	}
+
+	int getDims() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return dims;
+	}
+
+	std::string getMetric() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return getMetricName(metric);
+	}
+
+	int getNumEmbeddings() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return numRows;
+	}
+
+	int getNumIds() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return (int)rowsOfId.size();
+	}
+
+	// one id per row of embeddings, or a single id for all rows
+	void add(const std::vector<int>& ids, const cv::Mat& embeddings) {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (embeddings.channels() != 1 || (embeddings.rows > 0 && embeddings.cols != dims)) {
+			throw std::runtime_error("FaceGallery::add - expected embeddings with " + std::to_string(dims) + " cols");
+		}
+		if (ids.size() != 1 && (int)ids.size() != embeddings.rows) {
+			throw std::runtime_error("FaceGallery::add - expected one id per embedding");
+		}
+		cv::Mat rows;
+		embeddings.convertTo(rows, CV_32F);
+		for (int r = 0; r < rows.rows; r++) {
+			cv::Mat row = rows.row(r);
+			double norm = cv::norm(row);
+			if (metric == COSINE && norm > 0) {
+				row *= 1.0 / norm;
+				norm = 1;
+			}
+			appendRow(ids.size() == 1 ? ids[0] : ids[r], rows.ptr<float>(r), (float)(norm * norm));
+		}
+	}
+
+	// returns the number of removed embeddings
+	int remove(const std::vector<int>& ids) {
+		std::lock_guard<std::mutex> lock(mutex);
+		int numRemoved = 0;
+		for (int id : ids) {
+			auto it = rowsOfId.find(id);
+			if (it == rowsOfId.end()) {
+				continue;
+			}
+			std::vector<int> rows = it->second;
+			std::sort(rows.begin(), rows.end());
+			// descending, such that the last row never belongs to id unless it is removed itself
+			for (int i = (int)rows.size() - 1; i >= 0; i--) {
+				removeRow(rows[i]);
+			}
+			rowsOfId.erase(id);
+			numRemoved += (int)rows.size();
+		}
+		return numRemoved;
+	}
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+		segments.clear();
+		rowsOfId.clear();
+		numRows = 0;
+	}
+
+	// topK nearest distinct ids for each query row, cosine distance is 1 - cosine similarity
+	std::vector<std::vector<FaceGalleryMatch>> query(const cv::Mat& queries, int topK) {
+		std::vector<std::shared_ptr<FaceGallerySegment>> snapshot;
+		int queryMetric;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (queries.channels() != 1 || (queries.rows > 0 && queries.cols != dims)) {
+				throw std::runtime_error("FaceGallery::query - expected queries with " + std::to_string(dims) + " cols");
+			}
+			snapshot = segments;
+			queryMetric = metric;
+		}
+		if (topK < 1) {
+			throw std::runtime_error("FaceGallery::query - expected topK to be at least 1");
+		}
+
+		cv::Mat q;
+		queries.convertTo(q, CV_32F);
+		std::vector<float> querySqNorms(q.rows);
+		for (int i = 0; i < q.rows; i++) {
+			cv::Mat row = q.row(i);
+			double norm = cv::norm(row);
+			if (queryMetric == COSINE && norm > 0) {
+				row *= 1.0 / norm;
+				norm = 1;
+			}
+			querySqNorms[i] = (float)(norm * norm);
+		}
+
+		// each segment is scored against all queries with a single matrix product
+		std::vector<std::vector<FaceGalleryTopK>> segmentResults(snapshot.size());
+		std::string err = ParallelUtils::forEachStripe((int)snapshot.size(), [&](int s) {
+			const FaceGallerySegment& segment = *snapshot[s];
+			segmentResults[s].assign(q.rows, FaceGalleryTopK(topK));
+			if (segment.getNumRows() == 0 || q.rows == 0) {
+				return;
+			}
+			cv::Mat dots;
+			cv::gemm(q, segment.embeddings.rowRange(0, segment.getNumRows()), 1, cv::noArray(), 0, dots, cv::GEMM_2_T);
+			for (int i = 0; i < q.rows; i++) {
+				const float* dot = dots.ptr<float>(i);
+				for (int r = 0; r < segment.getNumRows(); r++) {
+					float distance = queryMetric == COSINE
+						? 1 - dot[r]
+						: std::sqrt(std::max(querySqNorms[i] + segment.sqNorms[r] - 2 * dot[r], 0.0f));
+					segmentResults[s][i].push(segment.ids[r], distance);
+				}
+			}
+		});
+		if (!err.empty()) {
+			throw std::runtime_error("FaceGallery::query - " + err);
+		}
+
+		std::vector<std::vector<FaceGalleryMatch>> results(q.rows);
+		for (int i = 0; i < q.rows; i++) {
+			FaceGalleryTopK merged(topK);
+			for (const std::vector<FaceGalleryTopK>& segmentResult : segmentResults) {
+				for (const FaceGalleryMatch& match : segmentResult[i].matches) {
+					merged.push(match.id, match.distance);
+				}
+			}
+			results[i] = merged.matches;
+		}
+		return results;
+	}
+
+	/* file layout: magic, version, metric, dims, number of embeddings, the ids, then the embedding rows
+	   as float32, cosine galleries store the normalized embeddings. The file is written to <path>.tmp,
+	   which replaces path once complete, such that an interrupted save keeps the previous file */
+	void save(const std::string& path) {
+		std::vector<std::shared_ptr<FaceGallerySegment>> snapshot;
+		std::vector<int32_t> header;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			snapshot = segments;
+			header = { fileMagic, fileVersion, metric, dims, numRows };
+		}
+
+		std::string tmpPath = path + ".tmp";
+		std::ofstream stream(tmpPath.c_str(), std::ios::binary | std::ios::trunc);
+		if (!stream) {
+			throw std::runtime_error("failed to open file for writing: " + tmpPath);
+		}
+		stream.write((const char*)header.data(), header.size() * sizeof(int32_t));
+		for (const std::shared_ptr<FaceGallerySegment>& segment : snapshot) {
+			stream.write((const char*)segment->ids.data(), segment->ids.size() * sizeof(int32_t));
+		}
+		for (const std::shared_ptr<FaceGallerySegment>& segment : snapshot) {
+			stream.write((const char*)segment->embeddings.data, (size_t)segment->getNumRows() * header[3] * sizeof(float));
+		}
+		stream.close();
+		if (!stream) {
+			std::remove(tmpPath.c_str());
+			throw std::runtime_error("failed to write file: " + tmpPath);
+		}
+		replaceFile(tmpPath, path);
+	}
+
+	// replaces metric, dims and embeddings with the contents of the gallery file
+	void load(const std::string& path) {
+		std::ifstream stream(path.c_str(), std::ios::binary);
+		if (!stream) {
+			throw std::runtime_error("failed to open file: " + path);
+		}
+		int32_t header[5];
+		stream.read((char*)header, sizeof(header));
+		if (!stream || header[0] != fileMagic || header[1] != fileVersion) {
+			throw std::runtime_error("not a face gallery file or unsupported version: " + path);
+		}
+		int fileMetric = header[2], fileDims = header[3], fileRows = header[4];
+		if ((fileMetric != COSINE && fileMetric != L2) || fileDims < 1 || fileRows < 0) {
+			throw std::runtime_error("corrupt face gallery file: " + path);
+		}
+		std::vector<int32_t> ids(fileRows);
+		cv::Mat embeddings(fileRows, fileDims, CV_32F);
+		stream.read((char*)ids.data(), ids.size() * sizeof(int32_t));
+		stream.read((char*)embeddings.data, embeddings.total() * sizeof(float));
+		if (!stream) {
+			throw std::runtime_error("corrupt face gallery file: " + path);
+		}
+
+		FaceGalleryState loaded(fileDims, (Metric)fileMetric);
+		for (int r = 0; r < fileRows; r++) {
+			float norm = (float)cv::norm(embeddings.row(r));
+			loaded.appendRow(ids[r], embeddings.ptr<float>(r), norm * norm);
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		dims = loaded.dims;
+		metric = loaded.metric;
+		segments = loaded.segments;
+		rowsOfId = loaded.rowsOfId;
+		numRows = loaded.numRows;
+	}
+
+private:
+	enum { fileMagic = 0x47464646 /* "FFFG" */, fileVersion = 1 };
+
+	std::mutex mutex;
+	int dims;
+	int metric;
+	int numRows = 0;
+	std::vector<std::shared_ptr<FaceGallerySegment>> segments;
+	std::unordered_map<int, std::vector<int>> rowsOfId;
+
+	// copies the segment if a query still references it
+	FaceGallerySegment& getMutableSegment(int s) {
+		if (segments[s].use_count() > 1) {
+			segments[s] = segments[s]->clone();
+		}
+		return *segments[s];
+	}
+
+	void appendRow(int id, const float* embedding, float sqNorm) {
+		int s = numRows / FaceGallerySegment::capacity;
+		if (s == (int)segments.size()) {
+			segments.push_back(std::make_shared<FaceGallerySegment>(dims));
+		}
+		FaceGallerySegment& segment = getMutableSegment(s);
+		memcpy(segment.embeddings.ptr<float>(segment.getNumRows()), embedding, dims * sizeof(float));
+		segment.ids.push_back(id);
+		segment.sqNorms.push_back(sqNorm);
+		rowsOfId[id].push_back(numRows);
+		numRows++;
+	}
+
+	// moves the last row into row, the caller updates rowsOfId of the removed id
+	void removeRow(int row) {
+		int last = numRows - 1;
+		int lastSegmentIdx = last / FaceGallerySegment::capacity;
+		FaceGallerySegment& lastSegment = getMutableSegment(lastSegmentIdx);
+		int lastLocal = last % FaceGallerySegment::capacity;
+		if (row != last) {
+			FaceGallerySegment& segment = getMutableSegment(row / FaceGallerySegment::capacity);
+			int local = row % FaceGallerySegment::capacity;
+			int movedId = lastSegment.ids[lastLocal];
+			memcpy(segment.embeddings.ptr<float>(local), lastSegment.embeddings.ptr<float>(lastLocal), dims * sizeof(float));
+			segment.ids[local] = movedId;
+			segment.sqNorms[local] = lastSegment.sqNorms[lastLocal];
+			std::vector<int>& movedRows = rowsOfId[movedId];
+			*std::find(movedRows.begin(), movedRows.end(), last) = row;
+		}
+		lastSegment.ids.pop_back();
+		lastSegment.sqNorms.pop_back();
+		if (lastSegment.getNumRows() == 0) {
+			segments.pop_back();
+		}
+		numRows--;
+	}
+};
+
+#endif
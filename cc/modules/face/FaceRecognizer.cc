@@ -2,14 +2,21 @@
 
 #include "FaceRecognizer.h"
 #include "FaceRecognizerBindings.h"
+#include "AlgorithmBufferBindings.h"
 
 void FaceRecognizer::Init(v8::Local<v8::FunctionTemplate> ctor) {
   Nan::SetPrototypeMethod(ctor, "train", Train);
   Nan::SetPrototypeMethod(ctor, "trainAsync", TrainAsync);
   Nan::SetPrototypeMethod(ctor, "predict", Predict);
   Nan::SetPrototypeMethod(ctor, "predictAsync", PredictAsync);
+  Nan::SetPrototypeMethod(ctor, "predictBatch", PredictBatch);
+  Nan::SetPrototypeMethod(ctor, "predictBatchAsync", PredictBatchAsync);
   Nan::SetPrototypeMethod(ctor, "save", Save);
   Nan::SetPrototypeMethod(ctor, "load", Load);
+  Nan::SetPrototypeMethod(ctor, "saveToBuffer", SaveToBuffer);
+  Nan::SetPrototypeMethod(ctor, "saveToBufferAsync", SaveToBufferAsync);
+  Nan::SetPrototypeMethod(ctor, "loadFromBuffer", LoadFromBuffer);
+  Nan::SetPrototypeMethod(ctor, "loadFromBufferAsync", LoadFromBufferAsync);
 };
 
 NAN_METHOD(FaceRecognizer::Save) {
@@ -19,7 +26,9 @@ NAN_METHOD(FaceRecognizer::Save) {
 	if (FF::StringConverter::arg(0, &path, info)) {
 		return tryCatch.reThrow();
 	}
-	Nan::ObjectWrap::Unwrap<FaceRecognizer>(info.This())->save(path);
+	FaceRecognizer* self = Nan::ObjectWrap::Unwrap<FaceRecognizer>(info.This());
+	ReadWriteLock::SharedGuard guard(*self->lock);
+	self->save(path);
 }
 
 NAN_METHOD(FaceRecognizer::Load) {
@@ -29,12 +38,89 @@ NAN_METHOD(FaceRecognizer::Load) {
 	if (FF::StringConverter::arg(0, &path, info)) {
 		return tryCatch.reThrow();
 	}
-	Nan::ObjectWrap::Unwrap<FaceRecognizer>(info.This())->load(path);
+	// prior to 3.3 the recognizer is loaded in place
+	FaceRecognizer* self = Nan::ObjectWrap::Unwrap<FaceRecognizer>(info.This());
+	ReadWriteLock::ExclusiveGuard guard(*self->lock);
+	self->load(path);
+}
+
+// prior to 3.3 face recognizers are saved to and loaded from the top level of the FileStorage,
+// saving shares the lock of the recognizer, such that it is not written while being trained
+struct FaceRecognizerSaveToBufferWorker : public AlgorithmBufferBindings::SaveToBufferWorker {
+  std::shared_ptr<ReadWriteLock> lock;
+
+  FaceRecognizerSaveToBufferWorker(cv::Ptr<cv::face::FaceRecognizer> faceRecognizer, std::shared_ptr<ReadWriteLock> lock)
+    : AlgorithmBufferBindings::SaveToBufferWorker(faceRecognizer) {
+    this->lock = lock;
+  }
+
+  void writeAlgorithm(cv::FileStorage& fs) {
+    ReadWriteLock::SharedGuard guard(*lock);
+#if CV_VERSION_MAJOR <= 3 && CV_VERSION_MINOR < 3
+    algorithm.dynamicCast<cv::face::FaceRecognizer>()->save(fs);
+#else
+    AlgorithmBufferBindings::SaveToBufferWorker::writeAlgorithm(fs);
+#endif
+  }
+};
+
+#if CV_VERSION_MAJOR <= 3 && CV_VERSION_MINOR < 3
+struct FaceRecognizerLoadFromBufferWorker : public AlgorithmBufferBindings::LoadFromBufferWorker<cv::face::FaceRecognizer> {
+  FaceRecognizerLoadFromBufferWorker(v8::Local<v8::Object> jsSelf, cv::Ptr<cv::face::FaceRecognizer> faceRecognizer, std::function<void(cv::Ptr<cv::face::FaceRecognizer>)> setFaceRecognizer)
+    : AlgorithmBufferBindings::LoadFromBufferWorker<cv::face::FaceRecognizer>(jsSelf, faceRecognizer, setFaceRecognizer) {}
+
+  void readAlgorithm(cv::FileStorage& fs) {
+    algorithm->load(fs);
+  }
+};
+#else
+typedef AlgorithmBufferBindings::LoadFromBufferWorker<cv::face::FaceRecognizer> FaceRecognizerLoadFromBufferWorker;
+#endif
+
+NAN_METHOD(FaceRecognizer::SaveToBuffer) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceRecognizerSaveToBufferWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::SaveToBuffer",
+    info
+  );
+}
+
+NAN_METHOD(FaceRecognizer::SaveToBufferAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceRecognizerSaveToBufferWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::SaveToBufferAsync",
+    info
+  );
+}
+
+static std::shared_ptr<FaceRecognizerLoadFromBufferWorker> newLoadFromBufferWorker(Nan::NAN_METHOD_ARGS_TYPE info) {
+  FaceRecognizer* self = FaceRecognizer::unwrapThis(info);
+  return std::make_shared<FaceRecognizerLoadFromBufferWorker>(
+    info.This(),
+    self->createFaceRecognizer(),
+    [self](cv::Ptr<cv::face::FaceRecognizer> faceRecognizer) { self->setFaceRecognizer(faceRecognizer); }
+  );
+}
+
+NAN_METHOD(FaceRecognizer::LoadFromBuffer) {
+  FF::SyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "FaceRecognizer::LoadFromBuffer",
+    info
+  );
+}
+
+NAN_METHOD(FaceRecognizer::LoadFromBufferAsync) {
+  FF::AsyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "FaceRecognizer::LoadFromBufferAsync",
+    info
+  );
 }
 
 NAN_METHOD(FaceRecognizer::Train) {
   FF::SyncBindingBase(
-    std::make_shared<FaceRecognizerBindings::TrainWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer()),
+    std::make_shared<FaceRecognizerBindings::TrainWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
     "FaceRecognizer::Train",
     info
   );
@@ -42,7 +128,7 @@ NAN_METHOD(FaceRecognizer::Train) {
 
 NAN_METHOD(FaceRecognizer::TrainAsync) {
   FF::AsyncBindingBase(
-    std::make_shared<FaceRecognizerBindings::TrainWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer()),
+    std::make_shared<FaceRecognizerBindings::TrainWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
     "FaceRecognizer::TrainAsync",
     info
   );
@@ -50,7 +136,7 @@ NAN_METHOD(FaceRecognizer::TrainAsync) {
 
 NAN_METHOD(FaceRecognizer::Predict) {
   FF::SyncBindingBase(
-    std::make_shared<FaceRecognizerBindings::PredictWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer()),
+    std::make_shared<FaceRecognizerBindings::PredictWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
     "FaceRecognizer::Predict",
     info
   );
@@ -58,10 +144,42 @@ NAN_METHOD(FaceRecognizer::Predict) {
 
 NAN_METHOD(FaceRecognizer::PredictAsync) {
   FF::AsyncBindingBase(
-    std::make_shared<FaceRecognizerBindings::PredictWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer()),
+    std::make_shared<FaceRecognizerBindings::PredictWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
     "FaceRecognizer::PredictAsync",
     info
   );
 }
 
+NAN_METHOD(FaceRecognizer::PredictBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceRecognizerBindings::PredictBatchWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::PredictBatch",
+    info
+  );
+}
+
+NAN_METHOD(FaceRecognizer::PredictBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceRecognizerBindings::PredictBatchWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::PredictBatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(FaceRecognizer::Project) {
+  FF::SyncBindingBase(
+    std::make_shared<FaceRecognizerBindings::ProjectWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::Project",
+    info
+  );
+}
+
+NAN_METHOD(FaceRecognizer::ProjectAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FaceRecognizerBindings::ProjectWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+    "FaceRecognizer::ProjectAsync",
+    info
+  );
+}
+
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "macros.h"
 #include "CatchCvExceptionWorker.h"
 #include "Mat.h"
+#include "ReadWriteLock.h"
 #include <opencv2/face.hpp>
 
 #ifndef __FF_FACERECOGNIZER_H__
@@ -12,15 +13,30 @@ public:
 	virtual cv::Ptr<cv::face::FaceRecognizer> getFaceRecognizer() = 0;
 	virtual void save(std::string) = 0;
 	virtual void load(std::string) = 0;
+	// empty recognizer of the derived type, which loadFromBuffer reads into
+	virtual cv::Ptr<cv::face::FaceRecognizer> createFaceRecognizer() = 0;
+	virtual void setFaceRecognizer(cv::Ptr<cv::face::FaceRecognizer> faceRecognizer) = 0;
+
+	// predictions share the lock, train and update modify the recognizer and have to hold it exclusively
+	std::shared_ptr<ReadWriteLock> lock = std::make_shared<ReadWriteLock>();
 
 	static void Init(v8::Local<v8::FunctionTemplate>);
 
 	static NAN_METHOD(Save);
 	static NAN_METHOD(Load);
+	static NAN_METHOD(SaveToBuffer);
+	static NAN_METHOD(SaveToBufferAsync);
+	static NAN_METHOD(LoadFromBuffer);
+	static NAN_METHOD(LoadFromBufferAsync);
 	static NAN_METHOD(Train);
 	static NAN_METHOD(TrainAsync);
 	static NAN_METHOD(Predict);
 	static NAN_METHOD(PredictAsync);
+	static NAN_METHOD(PredictBatch);
+	static NAN_METHOD(PredictBatchAsync);
+	// registered by the eigen- and fisherface recognizers only
+	static NAN_METHOD(Project);
+	static NAN_METHOD(ProjectAsync);
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "FaceRecognizer.h"
+#include "parallelUtils.h"
 
 #ifndef __FF_FACERECOGNIZERBINDINGS_H_
 #define __FF_FACERECOGNIZERBINDINGS_H_
@@ -32,14 +33,17 @@ namespace FaceRecognizerBindings {
   struct TrainWorker : public CatchCvExceptionWorker {
   public:
     cv::Ptr<cv::face::FaceRecognizer> self;
-    TrainWorker(cv::Ptr<cv::face::FaceRecognizer> self) {
+    std::shared_ptr<ReadWriteLock> lock;
+    TrainWorker(cv::Ptr<cv::face::FaceRecognizer> self, std::shared_ptr<ReadWriteLock> lock) {
       this->self = self;
+      this->lock = lock;
     }
   
     std::vector<cv::Mat> images;
     std::vector<int> labels;
   
     std::string executeCatchCvExceptionWorker() {
+      ReadWriteLock::ExclusiveGuard guard(*lock);
       self->train(images, labels);
       return "";
     }
@@ -55,8 +59,10 @@ namespace FaceRecognizerBindings {
   struct PredictWorker : public CatchCvExceptionWorker {
   public:
     cv::Ptr<cv::face::FaceRecognizer> self;
-    PredictWorker(cv::Ptr<cv::face::FaceRecognizer> self) {
+    std::shared_ptr<ReadWriteLock> lock;
+    PredictWorker(cv::Ptr<cv::face::FaceRecognizer> self, std::shared_ptr<ReadWriteLock> lock) {
       this->self = self;
+      this->lock = lock;
     }
   
     cv::Mat image;
@@ -64,6 +70,7 @@ namespace FaceRecognizerBindings {
     double confidence;
   
     std::string executeCatchCvExceptionWorker() {
+      ReadWriteLock::SharedGuard guard(*lock);
       self->predict(image, label, confidence);
       return "";
     }
@@ -83,6 +90,187 @@ namespace FaceRecognizerBindings {
   };
   
 
+  // incremental training, only supported by LBPHFaceRecognizer
+  struct UpdateWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::face::FaceRecognizer> self;
+    std::shared_ptr<ReadWriteLock> lock;
+    UpdateWorker(cv::Ptr<cv::face::FaceRecognizer> self, std::shared_ptr<ReadWriteLock> lock) {
+      this->self = self;
+      this->lock = lock;
+    }
+
+    std::vector<cv::Mat> images;
+    std::vector<int> labels;
+
+    std::string executeCatchCvExceptionWorker() {
+      ReadWriteLock::ExclusiveGuard guard(*lock);
+      self->update(images, labels);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::ArrayConverter::arg(0, &images, info) ||
+        FF::IntArrayConverter::arg(1, &labels, info)
+      );
+    }
+  };
+
+  /* predicts the faces in parallel, FaceRecognizer::predict is const, with topK > 0 the topK nearest
+     labels of each face are collected as well */
+  struct PredictBatchWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::face::FaceRecognizer> self;
+    std::shared_ptr<ReadWriteLock> lock;
+    PredictBatchWorker(cv::Ptr<cv::face::FaceRecognizer> self, std::shared_ptr<ReadWriteLock> lock) {
+      this->self = self;
+      this->lock = lock;
+    }
+
+    std::vector<cv::Mat> images;
+    int topK = 0;
+
+    std::vector<int> labels;
+    std::vector<double> confidences;
+    std::vector<std::vector<std::pair<int, double>>> nearest;
+
+    std::string executeCatchCvExceptionWorker() {
+#if CV_VERSION_MAJOR <= 3 && CV_VERSION_MINOR < 2
+      if (topK > 0) {
+        return "topK not implemented for v3.0, v3.1";
+      }
+#endif
+      int numImages = (int)images.size();
+      labels.resize(numImages);
+      confidences.resize(numImages);
+      nearest.resize(topK > 0 ? numImages : 0);
+      ReadWriteLock::SharedGuard guard(*lock);
+      double threshold = getThreshold();
+      return ParallelUtils::forEachStripe(numImages, [&](int i) {
+        predictImage(i, threshold);
+      });
+    }
+
+    double getThreshold() {
+      cv::Ptr<cv::face::LBPHFaceRecognizer> lbph = self.dynamicCast<cv::face::LBPHFaceRecognizer>();
+      if (lbph) {
+        return lbph->getThreshold();
+      }
+      cv::Ptr<cv::face::BasicFaceRecognizer> basic = self.dynamicCast<cv::face::BasicFaceRecognizer>();
+      return basic ? basic->getThreshold() : DBL_MAX;
+    }
+
+    void predictImage(int i, double threshold) {
+      if (topK <= 0) {
+        self->predict(images[i], labels[i], confidences[i]);
+        return;
+      }
+#if CV_VERSION_MAJOR > 3 || CV_VERSION_MINOR > 1
+      // same as FaceRecognizer::predict, which collects the distances to all training samples as well
+      cv::Ptr<cv::face::StandardCollector> collector = cv::face::StandardCollector::create(threshold);
+      self->predict(images[i], collector);
+      labels[i] = collector->getMinLabel();
+      confidences[i] = collector->getMinDist();
+
+      std::map<int, double> labelDists = collector->getResultsMap();
+      nearest[i].assign(labelDists.begin(), labelDists.end());
+      size_t k = std::min((size_t)topK, nearest[i].size());
+      std::partial_sort(nearest[i].begin(), nearest[i].begin() + k, nearest[i].end(),
+        [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+          return a.second != b.second ? a.second < b.second : a.first < b.first;
+        });
+      nearest[i].resize(k);
+#endif
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("labels").ToLocalChecked(), FF::IntArrayConverter::wrap(labels));
+      Nan::Set(ret, Nan::New("confidences").ToLocalChecked(), FF::DoubleArrayConverter::wrap(confidences));
+      if (topK > 0) {
+        v8::Local<v8::Array> jsNearest = Nan::New<v8::Array>(nearest.size());
+        for (size_t i = 0; i < nearest.size(); i++) {
+          v8::Local<v8::Array> jsImageNearest = Nan::New<v8::Array>(nearest[i].size());
+          for (size_t j = 0; j < nearest[i].size(); j++) {
+            v8::Local<v8::Object> jsResult = Nan::New<v8::Object>();
+            Nan::Set(jsResult, Nan::New("label").ToLocalChecked(), Nan::New(nearest[i][j].first));
+            Nan::Set(jsResult, Nan::New("confidence").ToLocalChecked(), Nan::New(nearest[i][j].second));
+            Nan::Set(jsImageNearest, j, jsResult);
+          }
+          Nan::Set(jsNearest, i, jsImageNearest);
+        }
+        Nan::Set(ret, Nan::New("nearest").ToLocalChecked(), jsNearest);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::ArrayConverter::arg(0, &images, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::optArg(1, &topK, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return FF::IntConverter::optProp(&topK, "topK", opts);
+    }
+  };
+
+  /* projects the images into the eigen- or fisherface subspace of a trained BasicFaceRecognizer,
+     one CV_32F row per image, which can be added to or queried against a FaceGallery */
+  struct ProjectWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::face::FaceRecognizer> self;
+    std::shared_ptr<ReadWriteLock> lock;
+    ProjectWorker(cv::Ptr<cv::face::FaceRecognizer> self, std::shared_ptr<ReadWriteLock> lock) {
+      this->self = self;
+      this->lock = lock;
+    }
+
+    std::vector<cv::Mat> images;
+
+    cv::Mat projections;
+
+    std::string executeCatchCvExceptionWorker() {
+      cv::Ptr<cv::face::BasicFaceRecognizer> basic = self.dynamicCast<cv::face::BasicFaceRecognizer>();
+      if (!basic) {
+        return "expected an EigenFaceRecognizer or FisherFaceRecognizer";
+      }
+      ReadWriteLock::SharedGuard guard(*lock);
+      cv::Mat eigenvectors = basic->getEigenVectors();
+      cv::Mat mean = basic->getMean();
+      if (eigenvectors.empty()) {
+        return "recognizer has not been trained";
+      }
+      projections = cv::Mat((int)images.size(), eigenvectors.cols, CV_32F);
+      for (size_t i = 0; i < images.size(); i++) {
+        if ((int)images[i].total() != eigenvectors.rows) {
+          return "expected image " + std::to_string(i) + " to have " + std::to_string(eigenvectors.rows) + " pixels";
+        }
+        cv::Mat sample = images[i].isContinuous() ? images[i] : images[i].clone();
+        cv::Mat projection = cv::LDA::subspaceProject(eigenvectors, mean, sample.reshape(1, 1));
+        cv::Mat row = projections.row((int)i);
+        projection.convertTo(row, CV_32F);
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Mat::Converter::wrap(projections);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::ArrayConverter::arg(0, &images, info);
+    }
+  };
+
 }
 
 #endif
\ No newline at end of file
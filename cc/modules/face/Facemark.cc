@@ -30,6 +30,8 @@ void Facemark::Init(v8::Local<v8::FunctionTemplate> ctor) {
   Nan::SetPrototypeMethod(ctor, "loadModelAsync", LoadModelAsync);
   Nan::SetPrototypeMethod(ctor, "fit", Fit);
   Nan::SetPrototypeMethod(ctor, "fitAsync", FitAsync);
+  Nan::SetPrototypeMethod(ctor, "fitBatch", FitBatch);
+  Nan::SetPrototypeMethod(ctor, "fitBatchAsync", FitBatchAsync);
   Nan::SetPrototypeMethod(ctor, "save", Save);
   Nan::SetPrototypeMethod(ctor, "load", Load);
 #if CV_MINOR_VERSION < 2
@@ -48,7 +50,7 @@ void Facemark::Init(v8::Local<v8::FunctionTemplate> ctor) {
 
 NAN_METHOD(Facemark::LoadModel) {
   FF::SyncBindingBase(
-    std::make_shared<FacemarkBindings::LoadModelWorker>(Facemark::unwrapThis(info)->getFacemark()),
+    std::make_shared<FacemarkBindings::LoadModelWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
     "Facemark::LoadModel",
     info
   );
@@ -56,7 +58,7 @@ NAN_METHOD(Facemark::LoadModel) {
 
 NAN_METHOD(Facemark::LoadModelAsync) {
   FF::AsyncBindingBase(
-    std::make_shared<FacemarkBindings::LoadModelWorker>(Facemark::unwrapThis(info)->getFacemark()),
+    std::make_shared<FacemarkBindings::LoadModelWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
     "Facemark::LoadModelAsync",
     info
   );
@@ -78,6 +80,22 @@ NAN_METHOD(Facemark::FitAsync) {
 	);
 }
 
+NAN_METHOD(Facemark::FitBatch) {
+	FF::SyncBindingBase(
+		std::make_shared<FacemarkBindings::FitBatchWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
+		"Facemark::FitBatch",
+		info
+	);
+}
+
+NAN_METHOD(Facemark::FitBatchAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<FacemarkBindings::FitBatchWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
+		"Facemark::FitBatchAsync",
+		info
+	);
+}
+
 #if CV_MINOR_VERSION < 2
 
 NAN_METHOD(Facemark::AddTrainingSample) {
@@ -145,7 +163,7 @@ NAN_METHOD(Facemark::SetFaceDetector) {
 
 NAN_METHOD(Facemark::Training) {
   FF::SyncBindingBase(
-    std::make_shared<FacemarkBindings::TrainingWorker>(Facemark::unwrapThis(info)->getFacemark()),
+    std::make_shared<FacemarkBindings::TrainingWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
     "Facemark::Train",
     info
   );
@@ -153,7 +171,7 @@ NAN_METHOD(Facemark::Training) {
 
 NAN_METHOD(Facemark::TrainingAsync) {
   FF::AsyncBindingBase(
-    std::make_shared<FacemarkBindings::TrainingWorker>(Facemark::unwrapThis(info)->getFacemark()),
+    std::make_shared<FacemarkBindings::TrainingWorker>(Facemark::unwrapThis(info)->getFacemark(), Facemark::unwrapThis(info)->pool),
     "Facemark::TrainAsync",
     info
   );
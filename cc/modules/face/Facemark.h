@@ -3,6 +3,7 @@
 #include "Point.h"
 #include "Rect.h"
 #include "macros.h"
+#include "FacemarkPool.h"
 #include <iostream>
 #include <opencv2/face.hpp>
 
@@ -17,6 +18,8 @@ public:
   virtual void save(std::string) = 0;
   virtual void load(std::string) = 0;
 
+  std::shared_ptr<FacemarkPool> pool;
+
   static void Init(v8::Local<v8::FunctionTemplate>);
 
   static NAN_METHOD(AddTrainingSample);
@@ -32,6 +35,8 @@ public:
   static NAN_METHOD(TrainingAsync);
   static NAN_METHOD(Fit);
   static NAN_METHOD(FitAsync);
+  static NAN_METHOD(FitBatch);
+  static NAN_METHOD(FitBatchAsync);
   static NAN_METHOD(Save);
   static NAN_METHOD(Load);
 
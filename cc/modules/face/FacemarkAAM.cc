@@ -32,6 +32,9 @@ NAN_METHOD(FacemarkAAM::New) {
   FacemarkAAM *self = new FacemarkAAM();
   self->Wrap(info.Holder());
   self->facemark = cv::face::FacemarkAAM::create(params);
+  self->pool = std::make_shared<FacemarkPool>([params]() -> cv::Ptr<cv::face::Facemark> {
+    return cv::face::FacemarkAAM::create(params);
+  });
 
   info.GetReturnValue().Set(info.Holder());
 };
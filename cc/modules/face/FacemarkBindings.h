@@ -1,5 +1,7 @@
 #include "Facemark.h"
 #include "FacemarkAAMData.h"
+#include "typedArrayUtils.h"
+#include "parallelUtils.h"
 
 #if CV_VERSION_MINOR >= 4
 
@@ -11,12 +13,17 @@ namespace FacemarkBindings {
   struct LoadModelWorker : public CatchCvExceptionWorker {
   public:
     cv::Ptr<cv::face::Facemark> self;
-    LoadModelWorker(cv::Ptr<cv::face::Facemark> self) { this->self = self; }
+    std::shared_ptr<FacemarkPool> pool;
+    LoadModelWorker(cv::Ptr<cv::face::Facemark> self, std::shared_ptr<FacemarkPool> pool) {
+      this->self = self;
+      this->pool = pool;
+    }
 
     std::string model;
 
     std::string executeCatchCvExceptionWorker() {
       self->loadModel(model);
+      pool->setModel(model);
       return "";
     }
 
@@ -50,6 +57,125 @@ namespace FacemarkBindings {
 	  }
   };
 
+  /* fits the faces of each frame, frames are distributed over replicas of the facemark if a model has
+     been loaded by loadModel and not been replaced by training, otherwise they are fitted one after another. The landmarks of a frame are
+     returned as a Float32Array of packed x, y coordinates, face after face, counts holds the number of
+     landmarks of each face and fitted is false if Facemark::fit failed for the frame. */
+  struct FitBatchWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::face::Facemark> self;
+    std::shared_ptr<FacemarkPool> pool;
+    FitBatchWorker(cv::Ptr<cv::face::Facemark> self, std::shared_ptr<FacemarkPool> pool) {
+      this->self = self;
+      this->pool = pool;
+    }
+
+    struct Frame {
+      cv::Mat image;
+      std::vector<cv::Rect> faces;
+    };
+
+    std::vector<Frame> frames;
+    int concurrency = 0;
+
+    std::vector<std::vector<float>> landmarks;
+    std::vector<std::vector<int>> counts;
+    // not a vector<bool>, since frames are written concurrently
+    std::vector<uchar> fitted;
+
+    std::string executeCatchCvExceptionWorker() {
+      landmarks.resize(frames.size());
+      counts.resize(frames.size());
+      fitted.resize(frames.size(), true);
+      if (!pool->hasModel()) {
+        for (size_t i = 0; i < frames.size(); i++) {
+          fitFrame(self, i);
+        }
+        return "";
+      }
+
+      int numStripes = std::min(ParallelUtils::getNumStripes((int)frames.size(), concurrency), pool->getMaxReplicas());
+      return ParallelUtils::forEachStripe(numStripes, [&](int s) {
+        int generation;
+        cv::Ptr<cv::face::Facemark> replica = pool->acquire(&generation);
+        try {
+          for (size_t i = s; i < frames.size(); i += numStripes) {
+            fitFrame(replica, i);
+          }
+        }
+        catch (...) {
+          // the state of a replica which threw is unknown
+          pool->release(cv::Ptr<cv::face::Facemark>(), generation);
+          throw;
+        }
+        pool->release(replica, generation);
+      });
+    }
+
+    void fitFrame(cv::Ptr<cv::face::Facemark> facemark, size_t i) {
+      std::vector<std::vector<cv::Point2f>> faceLandmarks;
+      if (frames[i].faces.size() > 0) {
+        fitted[i] = facemark->fit(frames[i].image, frames[i].faces, faceLandmarks);
+      }
+      for (const std::vector<cv::Point2f>& points : faceLandmarks) {
+        counts[i].push_back((int)points.size());
+        for (const cv::Point2f& pt : points) {
+          landmarks[i].push_back(pt.x);
+          landmarks[i].push_back(pt.y);
+        }
+      }
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(landmarks.size());
+      for (size_t i = 0; i < landmarks.size(); i++) {
+        v8::Local<v8::Object> jsFrame = Nan::New<v8::Object>();
+        Nan::Set(jsFrame, Nan::New("landmarks").ToLocalChecked(), FF::Float32TypedArrayConverter::wrap(landmarks[i]));
+        Nan::Set(jsFrame, Nan::New("counts").ToLocalChecked(), FF::IntArrayConverter::wrap(counts[i]));
+        Nan::Set(jsFrame, Nan::New("fitted").ToLocalChecked(), Nan::New((bool)fitted[i]));
+        Nan::Set(ret, i, jsFrame);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!FF::hasArg(info, 0) || !info[0]->IsArray()) {
+        Nan::ThrowError("expected arg 0 to be an array of objects { image, faces }");
+        return true;
+      }
+      v8::Local<v8::Array> jsFrames = v8::Local<v8::Array>::Cast(info[0]);
+      frames.resize(jsFrames->Length());
+      for (uint i = 0; i < jsFrames->Length(); i++) {
+        v8::Local<v8::Value> jsFrame = Nan::Get(jsFrames, i).ToLocalChecked();
+        if (!jsFrame->IsObject()) {
+          Nan::ThrowError("expected arg 0 to be an array of objects { image, faces }");
+          return true;
+        }
+        v8::Local<v8::Object> jsObj = jsFrame->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+        if (
+          Mat::Converter::prop(&frames[i].image, "image", jsObj) ||
+          Rect::ArrayWithCastConverter<cv::Rect>::prop(&frames[i].faces, "faces", jsObj)
+        ) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::optArg(1, &concurrency, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return FF::IntConverter::optProp(&concurrency, "concurrency", opts);
+    }
+  };
+
 #if CV_MINOR_VERSION < 2
   struct AddTrainingSampleWorker : public CatchCvExceptionWorker {
   public:
@@ -124,10 +250,16 @@ namespace FacemarkBindings {
   struct TrainingWorker : public CatchCvExceptionWorker {
   public:
     cv::Ptr<cv::face::Facemark> self;
-    TrainingWorker(cv::Ptr<cv::face::Facemark> self) { this->self = self; }
+    std::shared_ptr<FacemarkPool> pool;
+    TrainingWorker(cv::Ptr<cv::face::Facemark> self, std::shared_ptr<FacemarkPool> pool) {
+      this->self = self;
+      this->pool = pool;
+    }
 
     std::string executeCatchCvExceptionWorker() {
       self->training();
+      // replicas hold the previously loaded model, fitBatch fits with the trained instance until loadModel
+      pool->clearModel();
       return "";
     }
   };
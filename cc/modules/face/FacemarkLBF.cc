@@ -32,6 +32,9 @@ NAN_METHOD(FacemarkLBF::New) {
   FacemarkLBF *self = new FacemarkLBF();
   self->Wrap(info.Holder());
   self->facemark = cv::face::FacemarkLBF::create(params);
+  self->pool = std::make_shared<FacemarkPool>([params]() -> cv::Ptr<cv::face::Facemark> {
+    return cv::face::FacemarkLBF::create(params);
+  });
 
 
   info.GetReturnValue().Set(info.Holder());
@@ -0,0 +1,114 @@
+#include <opencv2/face.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if CV_VERSION_MINOR >= 4
+
+#ifndef __FF_FACEMARKPOOL_H__
+#define __FF_FACEMARKPOOL_H__
+
+/* replicas of a facemark with the model loaded by loadModel, which fitBatch fits frames with concurrently,
+   since Facemark::fit stores the current face in the params and thus can not be called concurrently on one
+   instance. Replicas are created and loaded on first use and kept for subsequent batches, loading another
+   model or training discards them. Each replica holds a full copy of the model, hence at most one replica
+   per OpenCV thread is created and acquire waits for a replica to be released beyond that. */
+class FacemarkPool {
+public:
+	FacemarkPool(std::function<cv::Ptr<cv::face::Facemark>()> create) {
+		this->create = create;
+	}
+
+	bool hasModel() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return !model.empty();
+	}
+
+	void setModel(const std::string& model) {
+		std::lock_guard<std::mutex> lock(mutex);
+		this->model = model;
+		discardReplicas();
+	}
+
+	// training replaces the model of the facemark, which replicas can not load from the model file
+	void clearModel() {
+		std::lock_guard<std::mutex> lock(mutex);
+		model.clear();
+		discardReplicas();
+	}
+
+	int getMaxReplicas() {
+		return std::max(cv::getNumThreads(), 1);
+	}
+
+	// generation identifies the model the replica has been loaded with
+	cv::Ptr<cv::face::Facemark> acquire(int* generation) {
+		std::string modelToLoad;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			replicaReleased.wait(lock, [this]() { return !idle.empty() || numReplicas < getMaxReplicas(); });
+			if (model.empty()) {
+				throw std::runtime_error("Facemark::fitBatch - the model has been discarded by training, call loadModel");
+			}
+			*generation = this->generation;
+			if (!idle.empty()) {
+				cv::Ptr<cv::face::Facemark> replica = idle.back();
+				idle.pop_back();
+				return replica;
+			}
+			modelToLoad = model;
+			numReplicas++;
+		}
+		try {
+			cv::Ptr<cv::face::Facemark> replica = create();
+			replica->loadModel(modelToLoad);
+			return replica;
+		}
+		catch (...) {
+			release(cv::Ptr<cv::face::Facemark>(), *generation);
+			throw;
+		}
+	}
+
+	// an empty replica gives up its slot, e.g. if it failed to load or fit
+	void release(cv::Ptr<cv::face::Facemark> replica, int generation) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (generation != this->generation) {
+				return;
+			}
+			if (replica.empty()) {
+				numReplicas--;
+			}
+			else {
+				idle.push_back(replica);
+			}
+		}
+		replicaReleased.notify_one();
+	}
+
+private:
+	std::mutex mutex;
+	std::condition_variable replicaReleased;
+	std::function<cv::Ptr<cv::face::Facemark>()> create;
+	std::string model;
+	int generation = 0;
+	// replicas of the current generation, idle or acquired
+	int numReplicas = 0;
+	std::vector<cv::Ptr<cv::face::Facemark>> idle;
+
+	// replicas of the previous generation are dropped on release
+	void discardReplicas() {
+		idle.clear();
+		numReplicas = 0;
+		generation++;
+		replicaReleased.notify_all();
+	}
+};
+
+#endif
+
+#endif
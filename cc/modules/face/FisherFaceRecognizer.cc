@@ -10,6 +10,8 @@ NAN_MODULE_INIT(FisherFaceRecognizer::Init) {
 	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
 
 	FaceRecognizer::Init(ctor);
+	Nan::SetPrototypeMethod(ctor, "project", FaceRecognizer::Project);
+	Nan::SetPrototypeMethod(ctor, "projectAsync", FaceRecognizer::ProjectAsync);
 	constructor.Reset(ctor);
 	ctor->SetClassName(Nan::New("FisherFaceRecognizer").ToLocalChecked());
 	instanceTemplate->SetInternalFieldCount(1);
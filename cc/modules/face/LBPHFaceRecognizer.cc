@@ -10,6 +10,8 @@ NAN_MODULE_INIT(LBPHFaceRecognizer::Init) {
 	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
 
 	FaceRecognizer::Init(ctor);
+	Nan::SetPrototypeMethod(ctor, "update", Update);
+	Nan::SetPrototypeMethod(ctor, "updateAsync", UpdateAsync);
 	constructor.Reset(ctor);
 	ctor->SetClassName(Nan::New("LBPHFaceRecognizer").ToLocalChecked());
 	instanceTemplate->SetInternalFieldCount(1);
@@ -70,4 +72,20 @@ NAN_METHOD(LBPHFaceRecognizer::New) {
 	info.GetReturnValue().Set(info.Holder());
 };
 
+NAN_METHOD(LBPHFaceRecognizer::Update) {
+	FF::SyncBindingBase(
+		std::make_shared<FaceRecognizerBindings::UpdateWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+		"LBPHFaceRecognizer::Update",
+		info
+	);
+}
+
+NAN_METHOD(LBPHFaceRecognizer::UpdateAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<FaceRecognizerBindings::UpdateWorker>(FaceRecognizer::unwrapThis(info)->getFaceRecognizer(), FaceRecognizer::unwrapThis(info)->lock),
+		"LBPHFaceRecognizer::UpdateAsync",
+		info
+	);
+}
+
 #endif // HAVE_FACE
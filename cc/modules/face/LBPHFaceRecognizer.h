@@ -21,12 +21,26 @@ public:
 	static NAN_MODULE_INIT(Init);
 	struct NewWorker;
 	static NAN_METHOD(New);
+	static NAN_METHOD(Update);
+	static NAN_METHOD(UpdateAsync);
 
 	static Nan::Persistent<v8::FunctionTemplate> constructor;
 
 	cv::Ptr<cv::face::FaceRecognizer> getFaceRecognizer() {
 		return faceRecognizer;
 	}
+
+	cv::Ptr<cv::face::FaceRecognizer> createFaceRecognizer() {
+#if CV_VERSION_MINOR < 3
+		return cv::face::createLBPHFaceRecognizer();
+#else
+		return cv::face::LBPHFaceRecognizer::create();
+#endif
+	}
+
+	void setFaceRecognizer(cv::Ptr<cv::face::FaceRecognizer> faceRecognizer) {
+		this->faceRecognizer = faceRecognizer;
+	}
 };
 
 #endif
\ No newline at end of file
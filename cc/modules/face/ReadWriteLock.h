@@ -0,0 +1,77 @@
+#include <condition_variable>
+#include <mutex>
+
+#ifndef __FF_READWRITELOCK_H__
+#define __FF_READWRITELOCK_H__
+
+/* allows any number of concurrent readers or a single writer, waiting writers block new readers,
+   such that a writer is not starved by a steady stream of readers */
+class ReadWriteLock {
+public:
+	void lockShared() {
+		std::unique_lock<std::mutex> lock(mutex);
+		canRead.wait(lock, [this]() { return !isWriting && numWaitingWriters == 0; });
+		numReaders++;
+	}
+
+	void unlockShared() {
+		std::lock_guard<std::mutex> lock(mutex);
+		numReaders--;
+		if (numReaders == 0) {
+			canWrite.notify_one();
+		}
+	}
+
+	void lock() {
+		std::unique_lock<std::mutex> lock(mutex);
+		numWaitingWriters++;
+		canWrite.wait(lock, [this]() { return !isWriting && numReaders == 0; });
+		numWaitingWriters--;
+		isWriting = true;
+	}
+
+	void unlock() {
+		std::lock_guard<std::mutex> lock(mutex);
+		isWriting = false;
+		if (numWaitingWriters > 0) {
+			canWrite.notify_one();
+		}
+		else {
+			canRead.notify_all();
+		}
+	}
+
+	class SharedGuard {
+	public:
+		SharedGuard(ReadWriteLock& rwLock) : rwLock(rwLock) {
+			rwLock.lockShared();
+		}
+		~SharedGuard() {
+			rwLock.unlockShared();
+		}
+	private:
+		ReadWriteLock& rwLock;
+	};
+
+	class ExclusiveGuard {
+	public:
+		ExclusiveGuard(ReadWriteLock& rwLock) : rwLock(rwLock) {
+			rwLock.lock();
+		}
+		~ExclusiveGuard() {
+			rwLock.unlock();
+		}
+	private:
+		ReadWriteLock& rwLock;
+	};
+
+private:
+	std::mutex mutex;
+	std::condition_variable canRead;
+	std::condition_variable canWrite;
+	int numReaders = 0;
+	int numWaitingWriters = 0;
+	bool isWriting = false;
+};
+
+#endif
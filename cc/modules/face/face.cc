@@ -4,6 +4,7 @@
 #include "EigenFaceRecognizer.h"
 #include "FisherFaceRecognizer.h"
 #include "LBPHFaceRecognizer.h"
+#include "FaceGallery.h"
 
 #if CV_VERSION_MINOR >= 4
 #include "FacemarkAAM.h"
@@ -17,6 +18,7 @@ NAN_MODULE_INIT(Face::Init) {
   EigenFaceRecognizer::Init(target);
   FisherFaceRecognizer::Init(target);
   LBPHFaceRecognizer::Init(target);
+  FaceGallery::Init(target);
 #if CV_VERSION_MINOR >= 4
   FacemarkAAM::Init(target);
   FacemarkAAMData::Init(target);
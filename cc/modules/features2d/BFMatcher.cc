@@ -1,5 +1,6 @@
 #include "BFMatcher.h"
 #include "BFMatcherBindings.h"
+#include "batchMatching.h"
 
 Nan::Persistent<v8::FunctionTemplate> BFMatcher::constructor;
 
@@ -19,6 +20,10 @@ NAN_MODULE_INIT(BFMatcher::Init) {
     Nan::SetPrototypeMethod(ctor, "matchAsync", matchAsync);
     Nan::SetPrototypeMethod(ctor, "knnMatch", knnMatch);
     Nan::SetPrototypeMethod(ctor, "knnMatchAsync", knnMatchAsync);
+    Nan::SetPrototypeMethod(ctor, "radiusMatch", radiusMatch);
+    Nan::SetPrototypeMethod(ctor, "radiusMatchAsync", radiusMatchAsync);
+    Nan::SetPrototypeMethod(ctor, "knnMatchBatch", knnMatchBatch);
+    Nan::SetPrototypeMethod(ctor, "knnMatchBatchAsync", knnMatchBatchAsync);
 
     Nan::Set(target,Nan::New("BFMatcher").ToLocalChecked(), FF::getFunction(ctor));
 };
@@ -75,3 +80,37 @@ NAN_METHOD(BFMatcher::knnMatchAsync) {
     info
   );
 }
+
+NAN_METHOD(BFMatcher::radiusMatch) {
+  FF::SyncBindingBase(
+    std::make_shared<BFMatcherBindings::RadiusMatchWorker>(BFMatcher::unwrapSelf(info)),
+    "BFMatcher::radiusMatch",
+    info
+  );
+}
+
+NAN_METHOD(BFMatcher::radiusMatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<BFMatcherBindings::RadiusMatchWorker>(BFMatcher::unwrapSelf(info)),
+    "BFMatcher::radiusMatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(BFMatcher::knnMatchBatch) {
+  BFMatcher* self = BFMatcher::unwrapThis(info);
+  FF::SyncBindingBase(
+    std::make_shared<BatchMatching::MatchKnnBatchWorker>(self->normType, self->crossCheck),
+    "BFMatcher::knnMatchBatch",
+    info
+  );
+}
+
+NAN_METHOD(BFMatcher::knnMatchBatchAsync) {
+  BFMatcher* self = BFMatcher::unwrapThis(info);
+  FF::AsyncBindingBase(
+    std::make_shared<BatchMatching::MatchKnnBatchWorker>(self->normType, self->crossCheck),
+    "BFMatcher::knnMatchBatchAsync",
+    info
+  );
+}
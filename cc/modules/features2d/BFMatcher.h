@@ -29,6 +29,10 @@ public:
     static NAN_METHOD(matchAsync);
     static NAN_METHOD(knnMatch);
     static NAN_METHOD(knnMatchAsync);
+    static NAN_METHOD(radiusMatch);
+    static NAN_METHOD(radiusMatchAsync);
+    static NAN_METHOD(knnMatchBatch);
+    static NAN_METHOD(knnMatchBatchAsync);
 
 	struct NewWorker : CatchCvExceptionWorker {
 	public:
@@ -1,5 +1,6 @@
 #include "BFMatcher.h"
 #include "DescriptorMatch.h"
+#include "features2dUtils.h"
 
 #ifndef __FF_BFMATCHERBINDINGS_H_
 #define __FF_BFMATCHERBINDINGS_H_
@@ -16,10 +17,15 @@ struct MatchWorker : public CatchCvExceptionWorker {
 
         cv::Mat descFrom;
         cv::Mat descTo;
+        bool packed = false;
+        Features2dUtils::MatchFilter filter;
         std::vector<cv::DMatch> dmatches;
 
         std::string executeCatchCvExceptionWorker() {
             bfmatcher.match(descFrom, descTo, dmatches);
+            if (filter.enabled) {
+                dmatches = Features2dUtils::filterMatches(bfmatcher, descFrom, descTo, dmatches, filter);
+            }
             return "";
         }
 
@@ -28,8 +34,13 @@ struct MatchWorker : public CatchCvExceptionWorker {
                 || Mat::Converter::arg(1, &descTo, info);
         }
 
+        bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+            return Features2dUtils::unwrapPackedOption(&packed, 2, info)
+                || Features2dUtils::unwrapMatchFilterOption(&filter, 2, info);
+        }
+
         v8::Local<v8::Value> getReturnValue() {
-            return DescriptorMatch::ArrayConverter::wrap(dmatches);
+            return Features2dUtils::wrapMatches(dmatches, packed);
         }
     };
 
@@ -45,10 +56,16 @@ struct MatchKnnWorker : public CatchCvExceptionWorker {
         cv::Mat descFrom;
         cv::Mat descTo;
         int k;
+        bool packed = false;
+        Features2dUtils::MatchFilter filter;
         std::vector<std::vector<cv::DMatch>> dmatches;
+        std::vector<cv::DMatch> filtered;
 
         std::string executeCatchCvExceptionWorker() {
             bfmatcher.knnMatch(descFrom, descTo, dmatches, k);
+            if (filter.enabled) {
+                filtered = Features2dUtils::filterMatches(bfmatcher, descFrom, descTo, dmatches, filter);
+            }
             return "";
         }
 
@@ -58,8 +75,59 @@ struct MatchKnnWorker : public CatchCvExceptionWorker {
                 || FF::IntConverter::arg(2, &k, info);
         }
 
+        bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+            return Features2dUtils::unwrapPackedOption(&packed, 3, info)
+                || Features2dUtils::unwrapMatchFilterOption(&filter, 3, info);
+        }
+
+        v8::Local<v8::Value> getReturnValue() {
+            if (filter.enabled) {
+                return Features2dUtils::wrapMatches(filtered, packed);
+            }
+            return Features2dUtils::wrapMatches(dmatches, packed);
+        }
+};
+
+struct RadiusMatchWorker : public CatchCvExceptionWorker {
+    public:
+        cv::BFMatcher bfmatcher;
+
+        RadiusMatchWorker(cv::BFMatcher _bfmatcher) {
+            this->bfmatcher = _bfmatcher;
+        }
+
+        cv::Mat descFrom;
+        cv::Mat descTo;
+        float maxDistance;
+        bool packed = false;
+        Features2dUtils::MatchFilter filter;
+        std::vector<std::vector<cv::DMatch>> dmatches;
+        std::vector<cv::DMatch> filtered;
+
+        std::string executeCatchCvExceptionWorker() {
+            bfmatcher.radiusMatch(descFrom, descTo, dmatches, maxDistance);
+            if (filter.enabled) {
+                filtered = Features2dUtils::filterMatches(bfmatcher, descFrom, descTo, dmatches, filter);
+            }
+            return "";
+        }
+
+        bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+            return Mat::Converter::arg(0, &descFrom, info)
+                || Mat::Converter::arg(1, &descTo, info)
+                || FF::FloatConverter::arg(2, &maxDistance, info);
+        }
+
+        bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+            return Features2dUtils::unwrapPackedOption(&packed, 3, info)
+                || Features2dUtils::unwrapMatchFilterOption(&filter, 3, info);
+        }
+
         v8::Local<v8::Value> getReturnValue() {
-            return DescriptorMatch::ArrayOfArraysConverter::wrap(dmatches);
+            if (filter.enabled) {
+                return Features2dUtils::wrapMatches(filtered, packed);
+            }
+            return Features2dUtils::wrapMatches(dmatches, packed);
         }
 };
 
@@ -0,0 +1,88 @@
+#include "BOWImgDescriptorExtractor.h"
+#include "BOWImgDescriptorExtractorBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> BOWImgDescriptorExtractor::constructor;
+
+NAN_MODULE_INIT(BOWImgDescriptorExtractor::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(BOWImgDescriptorExtractor::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  instanceTemplate->SetInternalFieldCount(1);
+  ctor->SetClassName(Nan::New("BOWImgDescriptorExtractor").ToLocalChecked());
+
+  Nan::SetAccessor(instanceTemplate, Nan::New("vocabulary").ToLocalChecked(), vocabulary_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("descriptorSize").ToLocalChecked(), descriptorSize_getter);
+
+  Nan::SetPrototypeMethod(ctor, "setVocabulary", SetVocabulary);
+  Nan::SetPrototypeMethod(ctor, "compute", Compute);
+  Nan::SetPrototypeMethod(ctor, "computeAsync", ComputeAsync);
+  Nan::SetPrototypeMethod(ctor, "computeFromDescriptors", ComputeFromDescriptors);
+  Nan::SetPrototypeMethod(ctor, "computeFromDescriptorsAsync", ComputeFromDescriptorsAsync);
+
+  Nan::Set(target, Nan::New("BOWImgDescriptorExtractor").ToLocalChecked(), FF::getFunction(ctor));
+};
+
+NAN_METHOD(BOWImgDescriptorExtractor::New) {
+  FF::TryCatch tryCatch("BOWImgDescriptorExtractor::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+
+  cv::Ptr<cv::FeatureDetector> detector;
+  if (FeatureDetector::detectorArg(0, &detector, info)) {
+    return tryCatch.reThrow();
+  }
+  std::shared_ptr<BOWImgDescriptorExtractorState> state = std::make_shared<BOWImgDescriptorExtractorState>(detector);
+
+  if (FF::hasArg(info, 1)) {
+    cv::Mat vocabulary;
+    if (Mat::Converter::arg(1, &vocabulary, info)) {
+      return tryCatch.reThrow();
+    }
+    state->setVocabulary(vocabulary);
+  }
+
+  BOWImgDescriptorExtractor* self = new BOWImgDescriptorExtractor();
+  self->self = state;
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(BOWImgDescriptorExtractor::SetVocabulary) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWImgDescriptorExtractorBindings::SetVocabularyWorker>(BOWImgDescriptorExtractor::unwrapSelf(info)),
+    "BOWImgDescriptorExtractor::SetVocabulary",
+    info
+  );
+}
+
+NAN_METHOD(BOWImgDescriptorExtractor::Compute) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWImgDescriptorExtractorBindings::ComputeWorker>(BOWImgDescriptorExtractor::unwrapSelf(info)),
+    "BOWImgDescriptorExtractor::Compute",
+    info
+  );
+}
+
+NAN_METHOD(BOWImgDescriptorExtractor::ComputeAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<BOWImgDescriptorExtractorBindings::ComputeWorker>(BOWImgDescriptorExtractor::unwrapSelf(info)),
+    "BOWImgDescriptorExtractor::ComputeAsync",
+    info
+  );
+}
+
+NAN_METHOD(BOWImgDescriptorExtractor::ComputeFromDescriptors) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWImgDescriptorExtractorBindings::ComputeFromDescriptorsWorker>(BOWImgDescriptorExtractor::unwrapSelf(info)),
+    "BOWImgDescriptorExtractor::ComputeFromDescriptors",
+    info
+  );
+}
+
+NAN_METHOD(BOWImgDescriptorExtractor::ComputeFromDescriptorsAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<BOWImgDescriptorExtractorBindings::ComputeFromDescriptorsWorker>(BOWImgDescriptorExtractor::unwrapSelf(info)),
+    "BOWImgDescriptorExtractor::ComputeFromDescriptorsAsync",
+    info
+  );
+}
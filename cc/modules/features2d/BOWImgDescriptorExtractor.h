@@ -0,0 +1,97 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include "Mat.h"
+#include "CatchCvExceptionWorker.h"
+#include "FeatureDetector.h"
+#include <mutex>
+
+#ifndef __FF_BOWIMGDESCRIPTOREXTRACTOR_H__
+#define __FF_BOWIMGDESCRIPTOREXTRACTOR_H__
+
+/* encodes images as normalized histograms of visual words, the detector computes the descriptors which
+   are assigned to their nearest word of the vocabulary, each call uses its own matcher such that compute
+   can run concurrently with setVocabulary */
+class BOWImgDescriptorExtractorState {
+public:
+	cv::Ptr<cv::FeatureDetector> detector;
+
+	BOWImgDescriptorExtractorState(cv::Ptr<cv::FeatureDetector> detector) {
+		this->detector = detector;
+	}
+
+	void setVocabulary(const cv::Mat& vocabulary) {
+		cv::Mat converted;
+		vocabulary.convertTo(converted, CV_32F);
+		std::lock_guard<std::mutex> lock(mutex);
+		this->vocabulary = converted;
+	}
+
+	cv::Mat getVocabulary() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return vocabulary;
+	}
+
+	int getVocabularySize() {
+		return getVocabulary().rows;
+	}
+
+	// binary descriptors are converted to CV_32F, as the vocabulary is the result of k-means
+	cv::Mat computeFromDescriptors(const cv::Mat& descriptors) {
+		cv::Mat words = getVocabulary();
+		if (words.empty()) {
+			throw std::runtime_error("BOWImgDescriptorExtractor - vocabulary has not been set");
+		}
+		if (descriptors.rows > 0 && descriptors.cols != words.cols) {
+			throw std::runtime_error("BOWImgDescriptorExtractor - expected descriptors to have "
+				+ std::to_string(words.cols) + " cols");
+		}
+		// an image without descriptors would be normalized by zero
+		if (descriptors.rows == 0) {
+			return cv::Mat::zeros(1, words.rows, CV_32F);
+		}
+		cv::Mat converted;
+		descriptors.convertTo(converted, CV_32F);
+		cv::BOWImgDescriptorExtractor extractor(cv::makePtr<cv::BFMatcher>(cv::NORM_L2));
+		extractor.setVocabulary(words);
+		cv::Mat histogram;
+		extractor.compute(converted, histogram);
+		return histogram;
+	}
+
+	cv::Mat compute(const cv::Mat& img, std::vector<cv::KeyPoint>& keyPoints, bool detect) {
+		if (detect) {
+			detector->detect(img, keyPoints);
+		}
+		cv::Mat descriptors;
+		detector->compute(img, keyPoints, descriptors);
+		return computeFromDescriptors(descriptors);
+	}
+
+private:
+	std::mutex mutex;
+	cv::Mat vocabulary;
+};
+
+class BOWImgDescriptorExtractor : public FF::ObjectWrap<BOWImgDescriptorExtractor, std::shared_ptr<BOWImgDescriptorExtractorState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "BOWImgDescriptorExtractor";
+	}
+
+	FF_GETTER_CUSTOM(vocabulary, Mat::Converter, self->getVocabulary());
+	FF_GETTER_CUSTOM(descriptorSize, FF::IntConverter, self->getVocabularySize());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(SetVocabulary);
+	static NAN_METHOD(Compute);
+	static NAN_METHOD(ComputeAsync);
+	static NAN_METHOD(ComputeFromDescriptors);
+	static NAN_METHOD(ComputeFromDescriptorsAsync);
+};
+
+#endif
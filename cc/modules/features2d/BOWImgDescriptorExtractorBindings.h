@@ -0,0 +1,91 @@
+#include "BOWImgDescriptorExtractor.h"
+#include "features2dUtils.h"
+
+#ifndef __FF_BOWIMGDESCRIPTOREXTRACTORBINDINGS_H_
+#define __FF_BOWIMGDESCRIPTOREXTRACTORBINDINGS_H_
+
+namespace BOWImgDescriptorExtractorBindings {
+
+  struct SetVocabularyWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWImgDescriptorExtractorState> self;
+    SetVocabularyWorker(std::shared_ptr<BOWImgDescriptorExtractorState> self) {
+      this->self = self;
+    }
+
+    cv::Mat vocabulary;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->setVocabulary(vocabulary);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &vocabulary, info);
+    }
+  };
+
+  struct ComputeWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWImgDescriptorExtractorState> self;
+    ComputeWorker(std::shared_ptr<BOWImgDescriptorExtractorState> self) {
+      this->self = self;
+    }
+
+    cv::Mat img;
+    std::vector<cv::KeyPoint> keyPoints;
+    bool detect = true;
+
+    cv::Mat histogram;
+
+    std::string executeCatchCvExceptionWorker() {
+      histogram = self->compute(img, keyPoints, detect);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &img, info);
+    }
+
+    // keypoints are detected with the detector of the extractor if omitted
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!FF::hasArg(info, 1) || info[1]->IsFunction()) {
+        return false;
+      }
+      detect = false;
+      return Features2dUtils::keyPointsArg(1, &keyPoints, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Mat::Converter::wrap(histogram);
+    }
+  };
+
+  struct ComputeFromDescriptorsWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWImgDescriptorExtractorState> self;
+    ComputeFromDescriptorsWorker(std::shared_ptr<BOWImgDescriptorExtractorState> self) {
+      this->self = self;
+    }
+
+    cv::Mat descriptors;
+
+    cv::Mat histogram;
+
+    std::string executeCatchCvExceptionWorker() {
+      histogram = self->computeFromDescriptors(descriptors);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &descriptors, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Mat::Converter::wrap(histogram);
+    }
+  };
+
+}
+
+#endif
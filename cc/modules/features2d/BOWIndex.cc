@@ -0,0 +1,79 @@
+#include "BOWIndex.h"
+#include "BOWIndexBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> BOWIndex::constructor;
+
+NAN_MODULE_INIT(BOWIndex::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(BOWIndex::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  instanceTemplate->SetInternalFieldCount(1);
+  ctor->SetClassName(Nan::New("BOWIndex").ToLocalChecked());
+
+  Nan::SetAccessor(instanceTemplate, Nan::New("vocabularySize").ToLocalChecked(), vocabularySize_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("numImages").ToLocalChecked(), numImages_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("imageIds").ToLocalChecked(), imageIds_getter);
+
+  Nan::SetPrototypeMethod(ctor, "add", Add);
+  Nan::SetPrototypeMethod(ctor, "remove", Remove);
+  Nan::SetPrototypeMethod(ctor, "clear", Clear);
+  Nan::SetPrototypeMethod(ctor, "query", Query);
+  Nan::SetPrototypeMethod(ctor, "queryAsync", QueryAsync);
+
+  Nan::Set(target, Nan::New("BOWIndex").ToLocalChecked(), FF::getFunction(ctor));
+};
+
+NAN_METHOD(BOWIndex::New) {
+  FF::TryCatch tryCatch("BOWIndex::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+
+  int vocabularySize;
+  if (FF::IntConverter::arg(0, &vocabularySize, info)) {
+    return tryCatch.reThrow();
+  }
+  if (vocabularySize < 1) {
+    return tryCatch.throwError("expected vocabularySize to be at least 1");
+  }
+
+  BOWIndex* self = new BOWIndex();
+  self->self = std::make_shared<BOWIndexState>(vocabularySize);
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(BOWIndex::Add) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWIndexBindings::AddWorker>(BOWIndex::unwrapSelf(info)),
+    "BOWIndex::Add",
+    info
+  );
+}
+
+NAN_METHOD(BOWIndex::Remove) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWIndexBindings::RemoveWorker>(BOWIndex::unwrapSelf(info)),
+    "BOWIndex::Remove",
+    info
+  );
+}
+
+NAN_METHOD(BOWIndex::Clear) {
+  BOWIndex::unwrapSelf(info)->clear();
+}
+
+NAN_METHOD(BOWIndex::Query) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWIndexBindings::QueryWorker>(BOWIndex::unwrapSelf(info)),
+    "BOWIndex::Query",
+    info
+  );
+}
+
+NAN_METHOD(BOWIndex::QueryAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<BOWIndexBindings::QueryWorker>(BOWIndex::unwrapSelf(info)),
+    "BOWIndex::QueryAsync",
+    info
+  );
+}
@@ -0,0 +1,32 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include "Mat.h"
+#include "CatchCvExceptionWorker.h"
+#include "BOWIndexState.h"
+
+#ifndef __FF_BOWINDEX_H__
+#define __FF_BOWINDEX_H__
+
+class BOWIndex : public FF::ObjectWrap<BOWIndex, std::shared_ptr<BOWIndexState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "BOWIndex";
+	}
+
+	FF_GETTER_CUSTOM(vocabularySize, FF::IntConverter, self->getVocabularySize());
+	FF_GETTER_CUSTOM(numImages, FF::IntConverter, self->getNumImages());
+	FF_GETTER_CUSTOM(imageIds, FF::IntArrayConverter, self->getImageIds());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(Add);
+	static NAN_METHOD(Remove);
+	static NAN_METHOD(Clear);
+	static NAN_METHOD(Query);
+	static NAN_METHOD(QueryAsync);
+};
+
+#endif
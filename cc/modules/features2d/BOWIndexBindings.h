@@ -0,0 +1,93 @@
+#include "BOWIndex.h"
+
+#ifndef __FF_BOWINDEXBINDINGS_H_
+#define __FF_BOWINDEXBINDINGS_H_
+
+namespace BOWIndexBindings {
+
+  struct AddWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWIndexState> self;
+    AddWorker(std::shared_ptr<BOWIndexState> self) {
+      this->self = self;
+    }
+
+    int imageId;
+    cv::Mat histogram;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->add(imageId, histogram);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::arg(0, &imageId, info)
+        || Mat::Converter::arg(1, &histogram, info);
+    }
+  };
+
+  struct RemoveWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWIndexState> self;
+    RemoveWorker(std::shared_ptr<BOWIndexState> self) {
+      this->self = self;
+    }
+
+    int imageId;
+
+    bool removed = false;
+
+    std::string executeCatchCvExceptionWorker() {
+      removed = self->remove(imageId);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::arg(0, &imageId, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return FF::BoolConverter::wrap(removed);
+    }
+  };
+
+  struct QueryWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWIndexState> self;
+    QueryWorker(std::shared_ptr<BOWIndexState> self) {
+      this->self = self;
+    }
+
+    cv::Mat histogram;
+    int topK = 10;
+
+    std::vector<BOWIndexResult> results;
+
+    std::string executeCatchCvExceptionWorker() {
+      results = self->query(histogram, topK);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &histogram, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::IntConverter::optArg(1, &topK, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(results.size());
+      for (size_t i = 0; i < results.size(); i++) {
+        v8::Local<v8::Object> jsResult = Nan::New<v8::Object>();
+        Nan::Set(jsResult, Nan::New("imageId").ToLocalChecked(), FF::IntConverter::wrap(results[i].imageId));
+        Nan::Set(jsResult, Nan::New("score").ToLocalChecked(), FF::FloatConverter::wrap(results[i].score));
+        Nan::Set(ret, i, jsResult);
+      }
+      return ret;
+    }
+  };
+
+}
+
+#endif
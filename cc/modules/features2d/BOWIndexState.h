@@ -0,0 +1,168 @@
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+#ifndef __FF_BOWINDEXSTATE_H__
+#define __FF_BOWINDEXSTATE_H__
+
+struct BOWIndexResult {
+	int imageId;
+	float score;
+};
+
+/* inverted file over bag of visual words histograms, each word holds the term frequencies of the images
+   containing it, a query only visits the postings of its own words and scores images by the cosine
+   similarity of their TF-IDF vectors, idf = log(1 + N / df) such that words occurring in every image
+   still contribute, image norms depend on N and df and are recomputed lazily after add or remove */
+class BOWIndexState {
+public:
+	BOWIndexState(int vocabularySize) {
+		this->vocabularySize = vocabularySize;
+		postings.resize(vocabularySize);
+	}
+
+	int getVocabularySize() {
+		return vocabularySize;
+	}
+
+	int getNumImages() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return (int)images.size();
+	}
+
+	std::vector<int> getImageIds() {
+		std::lock_guard<std::mutex> lock(mutex);
+		std::vector<int> imageIds;
+		for (const auto& image : images) {
+			imageIds.push_back(image.first);
+		}
+		std::sort(imageIds.begin(), imageIds.end());
+		return imageIds;
+	}
+
+	// replaces the histogram of imageId if it has been added before
+	void add(int imageId, const cv::Mat& histogram) {
+		std::vector<std::pair<int, float>> words = toSparse(histogram);
+		std::lock_guard<std::mutex> lock(mutex);
+		removeImage(imageId);
+		for (const auto& word : words) {
+			postings[word.first][imageId] = word.second;
+		}
+		images[imageId] = words;
+		normsDirty = true;
+	}
+
+	bool remove(int imageId) {
+		std::lock_guard<std::mutex> lock(mutex);
+		bool removed = removeImage(imageId);
+		normsDirty = normsDirty || removed;
+		return removed;
+	}
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+		images.clear();
+		norms.clear();
+		for (auto& posting : postings) {
+			posting.clear();
+		}
+		normsDirty = false;
+	}
+
+	std::vector<BOWIndexResult> query(const cv::Mat& histogram, int topK) {
+		std::vector<std::pair<int, float>> words = toSparse(histogram);
+		std::lock_guard<std::mutex> lock(mutex);
+		if (normsDirty) {
+			computeNorms();
+		}
+
+		std::unordered_map<int, float> dots;
+		float queryNormSq = 0;
+		for (const auto& word : words) {
+			const std::unordered_map<int, float>& posting = postings[word.first];
+			if (posting.empty()) {
+				continue;
+			}
+			float idf = getIdf(word.first);
+			float queryWeight = word.second * idf;
+			queryNormSq += queryWeight * queryWeight;
+			for (const auto& entry : posting) {
+				dots[entry.first] += queryWeight * entry.second * idf;
+			}
+		}
+
+		std::vector<BOWIndexResult> results;
+		float queryNorm = std::sqrt(queryNormSq);
+		for (const auto& dot : dots) {
+			float norm = norms[dot.first];
+			if (queryNorm > 0 && norm > 0) {
+				results.push_back({ dot.first, dot.second / (queryNorm * norm) });
+			}
+		}
+		int numResults = topK > 0 ? std::min(topK, (int)results.size()) : (int)results.size();
+		std::partial_sort(results.begin(), results.begin() + numResults, results.end(),
+			[](const BOWIndexResult& a, const BOWIndexResult& b) {
+				return a.score != b.score ? a.score > b.score : a.imageId < b.imageId;
+			});
+		results.resize(numResults);
+		return results;
+	}
+
+private:
+	int vocabularySize;
+	std::mutex mutex;
+	std::unordered_map<int, std::vector<std::pair<int, float>>> images;
+	std::vector<std::unordered_map<int, float>> postings;
+	std::unordered_map<int, float> norms;
+	bool normsDirty = false;
+
+	std::vector<std::pair<int, float>> toSparse(const cv::Mat& histogram) {
+		if ((int)histogram.total() != vocabularySize || histogram.channels() != 1) {
+			throw std::runtime_error("BOWIndex - expected histogram with " + std::to_string(vocabularySize) + " entries");
+		}
+		cv::Mat converted;
+		histogram.reshape(1, 1).convertTo(converted, CV_32F);
+		std::vector<std::pair<int, float>> words;
+		const float* data = converted.ptr<float>(0);
+		for (int w = 0; w < vocabularySize; w++) {
+			if (data[w] > 0) {
+				words.push_back(std::make_pair(w, data[w]));
+			}
+		}
+		return words;
+	}
+
+	bool removeImage(int imageId) {
+		auto image = images.find(imageId);
+		if (image == images.end()) {
+			return false;
+		}
+		for (const auto& word : image->second) {
+			postings[word.first].erase(imageId);
+		}
+		images.erase(image);
+		norms.erase(imageId);
+		return true;
+	}
+
+	float getIdf(int word) {
+		return std::log(1.0f + (float)images.size() / (float)postings[word].size());
+	}
+
+	void computeNorms() {
+		norms.clear();
+		for (const auto& image : images) {
+			float normSq = 0;
+			for (const auto& word : image.second) {
+				float weight = word.second * getIdf(word.first);
+				normSq += weight * weight;
+			}
+			norms[image.first] = std::sqrt(normSq);
+		}
+		normsDirty = false;
+	}
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include "BOWKMeansTrainer.h"
+#include "BOWKMeansTrainerBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> BOWKMeansTrainer::constructor;
+
+NAN_MODULE_INIT(BOWKMeansTrainer::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(BOWKMeansTrainer::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  instanceTemplate->SetInternalFieldCount(1);
+  ctor->SetClassName(Nan::New("BOWKMeansTrainer").ToLocalChecked());
+
+  Nan::SetAccessor(instanceTemplate, Nan::New("clusterCount").ToLocalChecked(), clusterCount_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("attempts").ToLocalChecked(), attempts_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("flags").ToLocalChecked(), flags_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("descriptorsCount").ToLocalChecked(), descriptorsCount_getter);
+
+  Nan::SetPrototypeMethod(ctor, "add", Add);
+  Nan::SetPrototypeMethod(ctor, "clear", Clear);
+  Nan::SetPrototypeMethod(ctor, "cluster", Cluster);
+  Nan::SetPrototypeMethod(ctor, "clusterAsync", ClusterAsync);
+
+  Nan::Set(target, Nan::New("BOWKMeansTrainer").ToLocalChecked(), FF::getFunction(ctor));
+};
+
+NAN_METHOD(BOWKMeansTrainer::New) {
+  FF::TryCatch tryCatch("BOWKMeansTrainer::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+  BOWKMeansTrainer::NewWorker worker;
+
+  if (worker.applyUnwrappers(info)) {
+    return tryCatch.reThrow();
+  }
+  if (worker.clusterCount < 1) {
+    return tryCatch.throwError("expected clusterCount to be at least 1");
+  }
+
+  std::shared_ptr<BOWKMeansTrainerState> state = std::make_shared<BOWKMeansTrainerState>();
+  state->clusterCount = worker.clusterCount;
+  state->termCriteria = worker.termCriteria;
+  state->attempts = worker.attempts;
+  state->flags = worker.flags;
+
+  BOWKMeansTrainer* self = new BOWKMeansTrainer();
+  self->self = state;
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(BOWKMeansTrainer::Add) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWKMeansTrainerBindings::AddWorker>(BOWKMeansTrainer::unwrapSelf(info)),
+    "BOWKMeansTrainer::Add",
+    info
+  );
+}
+
+NAN_METHOD(BOWKMeansTrainer::Clear) {
+  BOWKMeansTrainer::unwrapSelf(info)->clear();
+}
+
+NAN_METHOD(BOWKMeansTrainer::Cluster) {
+  FF::SyncBindingBase(
+    std::make_shared<BOWKMeansTrainerBindings::ClusterWorker>(BOWKMeansTrainer::unwrapSelf(info)),
+    "BOWKMeansTrainer::Cluster",
+    info
+  );
+}
+
+NAN_METHOD(BOWKMeansTrainer::ClusterAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<BOWKMeansTrainerBindings::ClusterWorker>(BOWKMeansTrainer::unwrapSelf(info)),
+    "BOWKMeansTrainer::ClusterAsync",
+    info
+  );
+}
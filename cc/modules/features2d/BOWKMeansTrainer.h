@@ -0,0 +1,126 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include "Mat.h"
+#include "TermCriteria.h"
+#include "CatchCvExceptionWorker.h"
+#include <mutex>
+
+#ifndef __FF_BOWKMEANSTRAINER_H__
+#define __FF_BOWKMEANSTRAINER_H__
+
+/* descriptors added to a BOWKMeansTrainer, descriptors are converted to CV_32F on add such that binary
+   descriptors can be clustered as well, cluster() runs on a snapshot so descriptors can be added concurrently */
+class BOWKMeansTrainerState {
+public:
+	int clusterCount;
+	cv::TermCriteria termCriteria;
+	int attempts;
+	int flags;
+
+	void add(const cv::Mat& descriptors) {
+		cv::Mat converted;
+		descriptors.convertTo(converted, CV_32F);
+		std::lock_guard<std::mutex> lock(mutex);
+		if (trainDescriptors.size() > 0 && trainDescriptors[0].cols != converted.cols) {
+			throw std::runtime_error("BOWKMeansTrainer::add - expected descriptors to have "
+				+ std::to_string(trainDescriptors[0].cols) + " cols");
+		}
+		trainDescriptors.push_back(converted);
+	}
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+		trainDescriptors.clear();
+	}
+
+	int getDescriptorsCount() {
+		std::lock_guard<std::mutex> lock(mutex);
+		int count = 0;
+		for (const cv::Mat& desc : trainDescriptors) {
+			count += desc.rows;
+		}
+		return count;
+	}
+
+	// cv::kmeans distributes the label assignment and center updates over threads
+	cv::Mat cluster() {
+		std::vector<cv::Mat> descriptors;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			descriptors = trainDescriptors;
+		}
+		if (descriptors.size() == 0) {
+			throw std::runtime_error("BOWKMeansTrainer::cluster - no descriptors have been added");
+		}
+		cv::Mat merged;
+		cv::vconcat(descriptors, merged);
+		cv::BOWKMeansTrainer trainer(clusterCount, termCriteria, attempts, flags);
+		return trainer.cluster(merged);
+	}
+
+private:
+	std::mutex mutex;
+	std::vector<cv::Mat> trainDescriptors;
+};
+
+class BOWKMeansTrainer : public FF::ObjectWrap<BOWKMeansTrainer, std::shared_ptr<BOWKMeansTrainerState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "BOWKMeansTrainer";
+	}
+
+	FF_GETTER_CUSTOM(clusterCount, FF::IntConverter, self->clusterCount);
+	FF_GETTER_CUSTOM(attempts, FF::IntConverter, self->attempts);
+	FF_GETTER_CUSTOM(flags, FF::IntConverter, self->flags);
+	FF_GETTER_CUSTOM(descriptorsCount, FF::IntConverter, self->getDescriptorsCount());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(Add);
+	static NAN_METHOD(Clear);
+	static NAN_METHOD(Cluster);
+	static NAN_METHOD(ClusterAsync);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		int clusterCount;
+		cv::TermCriteria termCriteria = cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 100, 0.001);
+		int attempts = 3;
+		int flags = cv::KMEANS_PP_CENTERS;
+
+		bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::IntConverter::arg(0, &clusterCount, info);
+		}
+
+		bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return (
+				TermCriteria::Converter::optArg(1, &termCriteria, info) ||
+				FF::IntConverter::optArg(2, &attempts, info) ||
+				FF::IntConverter::optArg(3, &flags, info)
+			);
+		}
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 1) && !TermCriteria::hasInstance(info[1]);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				TermCriteria::Converter::optProp(&termCriteria, "termCriteria", opts) ||
+				FF::IntConverter::optProp(&attempts, "attempts", opts) ||
+				FF::IntConverter::optProp(&flags, "flags", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			return "";
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,48 @@
+#include "BOWKMeansTrainer.h"
+
+#ifndef __FF_BOWKMEANSTRAINERBINDINGS_H_
+#define __FF_BOWKMEANSTRAINERBINDINGS_H_
+
+namespace BOWKMeansTrainerBindings {
+
+  struct AddWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWKMeansTrainerState> self;
+    AddWorker(std::shared_ptr<BOWKMeansTrainerState> self) {
+      this->self = self;
+    }
+
+    cv::Mat descriptors;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->add(descriptors);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &descriptors, info);
+    }
+  };
+
+  struct ClusterWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<BOWKMeansTrainerState> self;
+    ClusterWorker(std::shared_ptr<BOWKMeansTrainerState> self) {
+      this->self = self;
+    }
+
+    cv::Mat vocabulary;
+
+    std::string executeCatchCvExceptionWorker() {
+      vocabulary = self->cluster();
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Mat::Converter::wrap(vocabulary);
+    }
+  };
+
+}
+
+#endif
@@ -0,0 +1,147 @@
+#include "DescriptorIndex.h"
+#include "DescriptorIndexBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> DescriptorIndex::constructor;
+
+NAN_MODULE_INIT(DescriptorIndex::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(DescriptorIndex::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  instanceTemplate->SetInternalFieldCount(1);
+  ctor->SetClassName(Nan::New("DescriptorIndex").ToLocalChecked());
+
+  Nan::SetAccessor(instanceTemplate, Nan::New("algorithm").ToLocalChecked(), algorithm_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("isTrained").ToLocalChecked(), isTrained_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("numImages").ToLocalChecked(), numImages_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("numDescriptors").ToLocalChecked(), numDescriptors_getter);
+  Nan::SetAccessor(instanceTemplate, Nan::New("imageIds").ToLocalChecked(), imageIds_getter);
+
+  Nan::SetPrototypeMethod(ctor, "add", Add);
+  Nan::SetPrototypeMethod(ctor, "clear", Clear);
+  Nan::SetPrototypeMethod(ctor, "train", Train);
+  Nan::SetPrototypeMethod(ctor, "trainAsync", TrainAsync);
+  Nan::SetPrototypeMethod(ctor, "knnMatch", KnnMatch);
+  Nan::SetPrototypeMethod(ctor, "knnMatchAsync", KnnMatchAsync);
+  Nan::SetPrototypeMethod(ctor, "radiusMatch", RadiusMatch);
+  Nan::SetPrototypeMethod(ctor, "radiusMatchAsync", RadiusMatchAsync);
+  Nan::SetPrototypeMethod(ctor, "save", Save);
+  Nan::SetPrototypeMethod(ctor, "saveAsync", SaveAsync);
+  Nan::SetPrototypeMethod(ctor, "load", Load);
+  Nan::SetPrototypeMethod(ctor, "loadAsync", LoadAsync);
+
+  Nan::Set(target, Nan::New("DescriptorIndex").ToLocalChecked(), FF::getFunction(ctor));
+};
+
+NAN_METHOD(DescriptorIndex::New) {
+  FF::TryCatch tryCatch("DescriptorIndex::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+  DescriptorIndex::NewWorker worker;
+
+  if (worker.applyUnwrappers(info)) {
+    return tryCatch.reThrow();
+  }
+
+  std::shared_ptr<DescriptorIndexState> state = std::make_shared<DescriptorIndexState>(worker.params);
+  std::string err = state->validateParams();
+  if (!err.empty()) {
+    return tryCatch.throwError(err);
+  }
+
+  DescriptorIndex* self = new DescriptorIndex();
+  self->self = state;
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(DescriptorIndex::Add) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::AddWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::Add",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::Clear) {
+  DescriptorIndex::unwrapSelf(info)->clear();
+}
+
+NAN_METHOD(DescriptorIndex::Train) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::TrainWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::Train",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::TrainAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::TrainWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::TrainAsync",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::KnnMatch) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::KnnMatchWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::KnnMatch",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::KnnMatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::KnnMatchWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::KnnMatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::RadiusMatch) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::RadiusMatchWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::RadiusMatch",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::RadiusMatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::RadiusMatchWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::RadiusMatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::Save) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::SaveWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::Save",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::SaveAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::SaveWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::SaveAsync",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::Load) {
+  FF::SyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::LoadWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::Load",
+    info
+  );
+}
+
+NAN_METHOD(DescriptorIndex::LoadAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<DescriptorIndexBindings::LoadWorker>(DescriptorIndex::unwrapSelf(info)),
+    "DescriptorIndex::LoadAsync",
+    info
+  );
+}
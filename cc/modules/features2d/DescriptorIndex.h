@@ -0,0 +1,75 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include "Mat.h"
+#include "CatchCvExceptionWorker.h"
+#include "DescriptorIndexState.h"
+
+#ifndef __FF_DESCRIPTORINDEX_H__
+#define __FF_DESCRIPTORINDEX_H__
+
+class DescriptorIndex : public FF::ObjectWrap<DescriptorIndex, std::shared_ptr<DescriptorIndexState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "DescriptorIndex";
+	}
+
+	FF_GETTER_CUSTOM(algorithm, FF::StringConverter, self->getAlgorithm());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(numImages, FF::IntConverter, self->getNumImages());
+	FF_GETTER_CUSTOM(numDescriptors, FF::IntConverter, self->getNumDescriptors());
+	FF_GETTER_CUSTOM(imageIds, FF::IntArrayConverter, self->getImageIds());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(Add);
+	static NAN_METHOD(Clear);
+	static NAN_METHOD(Train);
+	static NAN_METHOD(TrainAsync);
+	static NAN_METHOD(KnnMatch);
+	static NAN_METHOD(KnnMatchAsync);
+	static NAN_METHOD(RadiusMatch);
+	static NAN_METHOD(RadiusMatchAsync);
+	static NAN_METHOD(Save);
+	static NAN_METHOD(SaveAsync);
+	static NAN_METHOD(Load);
+	static NAN_METHOD(LoadAsync);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		DescriptorIndexParams params;
+
+		bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return (
+				FF::StringConverter::optArg(0, &params.algorithm, info)
+			);
+		}
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				FF::StringConverter::optProp(&params.algorithm, "algorithm", opts) ||
+				FF::IntConverter::optProp(&params.normType, "normType", opts) ||
+				FF::IntConverter::optProp(&params.trees, "trees", opts) ||
+				FF::IntConverter::optProp(&params.checks, "checks", opts) ||
+				FF::FloatConverter::optProp(&params.eps, "eps", opts) ||
+				FF::IntConverter::optProp(&params.tableNumber, "tableNumber", opts) ||
+				FF::IntConverter::optProp(&params.keySize, "keySize", opts) ||
+				FF::IntConverter::optProp(&params.multiProbeLevel, "multiProbeLevel", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			return "";
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include "DescriptorIndex.h"
+#include "features2dUtils.h"
+
+#ifndef __FF_DESCRIPTORINDEXBINDINGS_H_
+#define __FF_DESCRIPTORINDEXBINDINGS_H_
+
+namespace DescriptorIndexBindings {
+
+  struct AddWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    AddWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    std::vector<cv::Mat> descriptors;
+    std::vector<int> imageIds;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->add(descriptors, imageIds);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (info[0]->IsArray()) {
+        return Mat::ArrayConverter::arg(0, &descriptors, info);
+      }
+      descriptors.resize(1);
+      return Mat::Converter::arg(0, &descriptors[0], info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (FF::hasArg(info, 1) && info[1]->IsNumber()) {
+        imageIds.resize(1);
+        return FF::IntConverter::arg(1, &imageIds[0], info);
+      }
+      return FF::IntArrayConverter::optArg(1, &imageIds, info);
+    }
+  };
+
+  struct TrainWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    TrainWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    std::string executeCatchCvExceptionWorker() {
+      self->train();
+      return "";
+    }
+  };
+
+  struct KnnMatchWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    KnnMatchWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    cv::Mat queryDescriptors;
+    int k;
+    bool packed = false;
+    std::vector<std::vector<cv::DMatch>> dmatches;
+
+    std::string executeCatchCvExceptionWorker() {
+      std::shared_ptr<TrainedDescriptorIndex> index = self->getTrainedIndex();
+      index->knnMatch(index->prepareQuery(queryDescriptors), dmatches, k);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::Converter::arg(0, &queryDescriptors, info) ||
+        FF::IntConverter::arg(1, &k, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Features2dUtils::unwrapPackedOption(&packed, 2, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Features2dUtils::wrapMatches(dmatches, packed);
+    }
+  };
+
+  struct RadiusMatchWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    RadiusMatchWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    cv::Mat queryDescriptors;
+    float maxDistance;
+    int maxResults = 0;
+    bool packed = false;
+    std::vector<std::vector<cv::DMatch>> dmatches;
+
+    std::string executeCatchCvExceptionWorker() {
+      std::shared_ptr<TrainedDescriptorIndex> index = self->getTrainedIndex();
+      index->radiusMatch(index->prepareQuery(queryDescriptors), dmatches, maxDistance, maxResults);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::Converter::arg(0, &queryDescriptors, info) ||
+        FF::FloatConverter::arg(1, &maxDistance, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 2);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[2]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::IntConverter::optProp(&maxResults, "maxResults", opts) ||
+        FF::BoolConverter::optProp(&packed, "packed", opts)
+      );
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Features2dUtils::wrapMatches(dmatches, packed);
+    }
+  };
+
+  struct SaveWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    SaveWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    std::string path;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->save(path);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::StringConverter::arg(0, &path, info);
+    }
+  };
+
+  struct LoadWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<DescriptorIndexState> self;
+    LoadWorker(std::shared_ptr<DescriptorIndexState> self) {
+      this->self = self;
+    }
+
+    std::string path;
+
+    std::string executeCatchCvExceptionWorker() {
+      self->load(path);
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::StringConverter::arg(0, &path, info);
+    }
+  };
+
+}
+
+#endif
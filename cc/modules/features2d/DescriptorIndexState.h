@@ -0,0 +1,448 @@
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include <opencv2/flann.hpp>
+#include "MappedFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#ifndef __FF_DESCRIPTORINDEXSTATE_H__
+#define __FF_DESCRIPTORINDEXSTATE_H__
+
+struct DescriptorIndexParams {
+	std::string algorithm = "kdtree";
+	int normType = cv::NORM_L2;
+	int trees = 4;
+	int checks = 32;
+	float eps = 0;
+	int tableNumber = 12;
+	int keySize = 20;
+	int multiProbeLevel = 2;
+
+	static const char* getAlgorithmName(int code) {
+		static const char* names[] = { "kdtree", "lsh", "bruteforce" };
+		return (code >= 0 && code < 3) ? names[code] : "";
+	}
+
+	int getAlgorithmCode() const {
+		for (int code = 0; code < 3; code++) {
+			if (algorithm == getAlgorithmName(code)) {
+				return code;
+			}
+		}
+		return -1;
+	}
+
+	bool isFlann() const {
+		return algorithm != "bruteforce";
+	}
+};
+
+/* immutable search structure over the merged train descriptors, the rows of image i start at startIdxs[i],
+   the descriptors are either owned or point into a memory mapped index file kept alive by mappedFile */
+class TrainedDescriptorIndex {
+public:
+	DescriptorIndexParams params;
+	cv::Mat descriptors;
+	std::vector<int> startIdxs;
+	std::vector<int> imageIds;
+	cv::Ptr<cv::flann::Index> flannIndex;
+	cv::Ptr<cv::DescriptorMatcher> bfMatcher;
+	std::shared_ptr<MappedFile> mappedFile;
+
+	int getNumImages() const {
+		return (int)startIdxs.size();
+	}
+
+	// query descriptors of kd-tree indexes are converted to the type of the train descriptors
+	cv::Mat prepareQuery(cv::Mat query) const {
+		if (params.algorithm == "kdtree" && query.type() != descriptors.type()) {
+			cv::Mat converted;
+			query.convertTo(converted, descriptors.type());
+			return converted;
+		}
+		return query;
+	}
+
+	cv::Mat getImageDescriptors(int imgIdx) const {
+		int end = imgIdx + 1 < getNumImages() ? startIdxs[imgIdx + 1] : descriptors.rows;
+		return descriptors.rowRange(startIdxs[imgIdx], end);
+	}
+
+	// builds the flann index or brute force matcher, an existing flann index is read from flannFile if given
+	void createMatcher(const std::string& flannFile = "") {
+		if (!params.isFlann()) {
+			std::vector<cv::Mat> images;
+			for (int i = 0; i < getNumImages(); i++) {
+				images.push_back(getImageDescriptors(i));
+			}
+			bfMatcher = cv::makePtr<cv::BFMatcher>(params.normType);
+			bfMatcher->add(images);
+			bfMatcher->train();
+			return;
+		}
+
+		flannIndex = cv::makePtr<cv::flann::Index>();
+		if (!flannFile.empty()) {
+			if (!flannIndex->load(descriptors, flannFile)) {
+				throw std::runtime_error("failed to load flann index: " + flannFile);
+			}
+			return;
+		}
+		if (params.algorithm == "lsh") {
+			flannIndex->build(descriptors, cv::flann::LshIndexParams(params.tableNumber, params.keySize, params.multiProbeLevel),
+				cvflann::FLANN_DIST_HAMMING);
+		}
+		else {
+			flannIndex->build(descriptors, cv::flann::KDTreeIndexParams(params.trees), cvflann::FLANN_DIST_L2);
+		}
+	}
+
+	void knnMatch(const cv::Mat& query, std::vector<std::vector<cv::DMatch>>& matches, int k) {
+		if (bfMatcher) {
+			bfMatcher->knnMatch(query, matches, k);
+			return;
+		}
+		cv::Mat indices, dists;
+		flannIndex->knnSearch(query, indices, dists, k, getSearchParams());
+		matches.clear();
+		matches.resize(query.rows);
+		for (int q = 0; q < query.rows; q++) {
+			for (int j = 0; j < indices.cols; j++) {
+				int idx = indices.at<int>(q, j);
+				if (idx >= 0) {
+					matches[q].push_back(toDMatch(q, idx, toDistance(dists, q, j)));
+				}
+			}
+		}
+	}
+
+	// maxResults limits the number of matches per query descriptor, 0 for no limit
+	void radiusMatch(const cv::Mat& query, std::vector<std::vector<cv::DMatch>>& matches, float maxDistance, int maxResults) {
+		if (bfMatcher) {
+			bfMatcher->radiusMatch(query, matches, maxDistance);
+			if (maxResults > 0) {
+				for (std::vector<cv::DMatch>& queryMatches : matches) {
+					queryMatches.resize(std::min((int)queryMatches.size(), maxResults));
+				}
+			}
+			return;
+		}
+		// flann expects squared radii for L2
+		bool isHamming = params.algorithm == "lsh";
+		double radius = isHamming ? maxDistance : maxDistance * maxDistance;
+		int numResults = maxResults > 0 ? std::min(maxResults, descriptors.rows) : descriptors.rows;
+		cv::Mat indices, dists;
+		matches.clear();
+		matches.resize(query.rows);
+		for (int q = 0; q < query.rows; q++) {
+			int numFound = flannIndex->radiusSearch(query.row(q), indices, dists, radius, numResults, getSearchParams());
+			for (int j = 0; j < std::min(numFound, numResults); j++) {
+				int idx = indices.at<int>(0, j);
+				if (idx >= 0) {
+					matches[q].push_back(toDMatch(q, idx, toDistance(dists, 0, j)));
+				}
+			}
+		}
+	}
+
+	static std::shared_ptr<TrainedDescriptorIndex> build(DescriptorIndexParams params,
+		const std::vector<cv::Mat>& images, const std::vector<int>& imageIds) {
+		std::shared_ptr<TrainedDescriptorIndex> trained = std::make_shared<TrainedDescriptorIndex>();
+		trained->params = params;
+		trained->imageIds = imageIds;
+		int numRows = 0;
+		for (const cv::Mat& desc : images) {
+			trained->startIdxs.push_back(numRows);
+			numRows += desc.rows;
+		}
+		cv::vconcat(images, trained->descriptors);
+		trained->createMatcher();
+		return trained;
+	}
+
+	/* index file layout: magic, version, params, descriptor type and cols, number of rows and images,
+	   eps, checksum of the flann file, startIdxs, imageIds, padding to 64 bytes, then the raw descriptor
+	   rows. flann indexes write their search structure to <path>.flann, the two files are replaced one
+	   after another, hence load compares the checksum to detect a .flann file of another save */
+	void save(const std::string& path) {
+		if (!descriptors.isContinuous()) {
+			throw std::runtime_error("DescriptorIndex::save - expected continuous descriptors");
+		}
+		std::vector<int32_t> header = {
+			fileMagic, fileVersion,
+			params.getAlgorithmCode(), params.normType, params.trees, params.checks,
+			params.tableNumber, params.keySize, params.multiProbeLevel,
+			descriptors.type(), descriptors.cols, descriptors.rows, getNumImages()
+		};
+		float eps = params.eps;
+
+		// written to temporary files which replace the previous files once complete, since loaded
+		// indexes map the previous files
+		std::string flannTmpPath = path + ".flann.tmp";
+		uint64_t flannChecksum = 0;
+		if (flannIndex) {
+			flannIndex->save(flannTmpPath);
+			flannChecksum = fileChecksum(flannTmpPath);
+		}
+
+		std::string tmpPath = path + ".tmp";
+		std::ofstream stream(tmpPath.c_str(), std::ios::binary | std::ios::trunc);
+		if (!stream) {
+			std::remove(flannTmpPath.c_str());
+			throw std::runtime_error("failed to open file for writing: " + tmpPath);
+		}
+		stream.write((const char*)header.data(), header.size() * sizeof(int32_t));
+		stream.write((const char*)&eps, sizeof(float));
+		stream.write((const char*)&flannChecksum, sizeof(uint64_t));
+		stream.write((const char*)startIdxs.data(), startIdxs.size() * sizeof(int32_t));
+		stream.write((const char*)imageIds.data(), imageIds.size() * sizeof(int32_t));
+		size_t offset = (size_t)stream.tellp();
+		std::vector<char> padding(alignUp(offset) - offset, 0);
+		stream.write(padding.data(), padding.size());
+		stream.write((const char*)descriptors.data, descriptors.total() * descriptors.elemSize());
+		stream.close();
+		if (!stream) {
+			std::remove(tmpPath.c_str());
+			std::remove(flannTmpPath.c_str());
+			throw std::runtime_error("failed to write file: " + tmpPath);
+		}
+
+		if (flannIndex) {
+			replaceFile(flannTmpPath, path + ".flann");
+		}
+		replaceFile(tmpPath, path);
+	}
+
+	// the descriptors are not copied, they point into the memory mapped file
+	static std::shared_ptr<TrainedDescriptorIndex> load(const std::string& path) {
+		std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(path);
+		const char* data = file->getData();
+		size_t offset = 0;
+		int32_t header[13];
+		float eps;
+		readChecked(file, &offset, header, sizeof(header), path);
+		readChecked(file, &offset, &eps, sizeof(float), path);
+		if (header[0] != fileMagic || header[1] < 1 || header[1] > fileVersion) {
+			throw std::runtime_error("not a descriptor index file or unsupported version: " + path);
+		}
+		// version 1 files were saved without the checksum of the flann file
+		uint64_t flannChecksum = 0;
+		if (header[1] > 1) {
+			readChecked(file, &offset, &flannChecksum, sizeof(uint64_t), path);
+		}
+
+		std::shared_ptr<TrainedDescriptorIndex> trained = std::make_shared<TrainedDescriptorIndex>();
+		trained->mappedFile = file;
+		DescriptorIndexParams& params = trained->params;
+		params.algorithm = DescriptorIndexParams::getAlgorithmName(header[2]);
+		params.normType = header[3];
+		params.trees = header[4];
+		params.checks = header[5];
+		params.tableNumber = header[6];
+		params.keySize = header[7];
+		params.multiProbeLevel = header[8];
+		params.eps = eps;
+		int type = header[9], cols = header[10], rows = header[11], numImages = header[12];
+		if (params.algorithm.empty() || rows < 0 || cols < 0 || numImages < 0) {
+			throw std::runtime_error("corrupt descriptor index file: " + path);
+		}
+
+		trained->startIdxs.resize(numImages);
+		trained->imageIds.resize(numImages);
+		readChecked(file, &offset, trained->startIdxs.data(), numImages * sizeof(int32_t), path);
+		readChecked(file, &offset, trained->imageIds.data(), numImages * sizeof(int32_t), path);
+		offset = alignUp(offset);
+		size_t dataSize = (size_t)rows * cols * CV_ELEM_SIZE(type);
+		if (offset + dataSize > file->getSize()) {
+			throw std::runtime_error("corrupt descriptor index file: " + path);
+		}
+		trained->descriptors = cv::Mat(rows, cols, type, (void*)(data + offset));
+		std::string flannPath = params.isFlann() ? path + ".flann" : "";
+		if (header[1] > 1 && params.isFlann() && fileChecksum(flannPath) != flannChecksum) {
+			throw std::runtime_error("flann index does not belong to the descriptor index, it has been saved concurrently or saving has been interrupted: " + flannPath);
+		}
+		trained->createMatcher(flannPath);
+		return trained;
+	}
+
+private:
+	enum { fileMagic = 0x49444646 /* "FFDI" */, fileVersion = 2 };
+
+	// FNV-1a of the file contents
+	static uint64_t fileChecksum(const std::string& path) {
+		MappedFile file(path);
+		const unsigned char* data = (const unsigned char*)file.getData();
+		uint64_t hash = 14695981039346656037ULL;
+		for (size_t i = 0; i < file.getSize(); i++) {
+			hash = (hash ^ data[i]) * 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	static size_t alignUp(size_t offset) {
+		return (offset + 63) & ~(size_t)63;
+	}
+
+	static void readChecked(std::shared_ptr<MappedFile> file, size_t* offset, void* dst, size_t size, const std::string& path) {
+		if (*offset + size > file->getSize()) {
+			throw std::runtime_error("corrupt descriptor index file: " + path);
+		}
+		memcpy(dst, file->getData() + *offset, size);
+		*offset += size;
+	}
+
+	cv::flann::SearchParams getSearchParams() {
+		return cv::flann::SearchParams(params.checks, params.eps);
+	}
+
+	cv::DMatch toDMatch(int queryIdx, int idx, float distance) {
+		int imgIdx = (int)(std::upper_bound(startIdxs.begin(), startIdxs.end(), idx) - startIdxs.begin()) - 1;
+		return cv::DMatch(queryIdx, idx - startIdxs[imgIdx], imgIdx, distance);
+	}
+
+	// flann reports squared L2 distances and integer hamming distances
+	static float toDistance(const cv::Mat& dists, int row, int col) {
+		if (dists.type() == CV_32S) {
+			return (float)dists.at<int>(row, col);
+		}
+		return std::sqrt(dists.at<float>(row, col));
+	}
+};
+
+/* train descriptors and trained index of a DescriptorIndex, a trained index is never modified, train()
+   and load() build a new one and swap it in, such that queries can run concurrently with each other
+   and with add, train and load */
+class DescriptorIndexState {
+public:
+	DescriptorIndexParams params;
+
+	DescriptorIndexState(DescriptorIndexParams params) {
+		this->params = params;
+	}
+
+	std::string validateParams() {
+		if (params.getAlgorithmCode() < 0) {
+			return "expected algorithm to be one of 'kdtree', 'lsh' or 'bruteforce', have: " + params.algorithm;
+		}
+		return "";
+	}
+
+	// kd-trees and the L2 norm only work on float descriptors, descriptors are always copied, such that
+	// modifying the passed Mat afterwards does not change the index
+	cv::Mat prepareDescriptors(cv::Mat descriptors) {
+		if (params.algorithm == "kdtree" && descriptors.type() != CV_32F) {
+			cv::Mat converted;
+			descriptors.convertTo(converted, CV_32F);
+			return converted;
+		}
+		return descriptors.clone();
+	}
+
+	// imageIds defaults to the running image index
+	void add(const std::vector<cv::Mat>& descriptors, const std::vector<int>& ids) {
+		if (ids.size() > 0 && ids.size() != descriptors.size()) {
+			throw std::runtime_error("DescriptorIndex::add - expected one image id per descriptor Mat");
+		}
+		std::lock_guard<std::mutex> lock(mutex);
+		for (size_t i = 0; i < descriptors.size(); i++) {
+			imageIds.push_back(ids.size() > 0 ? ids[i] : (int)trainDescriptors.size());
+			trainDescriptors.push_back(prepareDescriptors(descriptors[i]));
+		}
+	}
+
+	void clear() {
+		std::lock_guard<std::mutex> lock(mutex);
+		trainDescriptors.clear();
+		imageIds.clear();
+		trained.reset();
+		mappedFile.reset();
+	}
+
+	void train() {
+		std::vector<cv::Mat> descriptors;
+		std::vector<int> ids;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			descriptors = trainDescriptors;
+			ids = imageIds;
+		}
+		if (descriptors.size() == 0) {
+			throw std::runtime_error("DescriptorIndex::train - no descriptors have been added");
+		}
+		std::shared_ptr<TrainedDescriptorIndex> index = TrainedDescriptorIndex::build(params, descriptors, ids);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		trained = index;
+	}
+
+	void save(const std::string& path) {
+		getTrainedIndex()->save(path);
+	}
+
+	// replaces params, train descriptors and trained index with the contents of the index file
+	void load(const std::string& path) {
+		std::shared_ptr<TrainedDescriptorIndex> index = TrainedDescriptorIndex::load(path);
+		std::vector<cv::Mat> descriptors;
+		for (int i = 0; i < index->getNumImages(); i++) {
+			descriptors.push_back(index->getImageDescriptors(i));
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		params = index->params;
+		trainDescriptors = descriptors;
+		imageIds = index->imageIds;
+		mappedFile = index->mappedFile;
+		trained = index;
+	}
+
+	std::shared_ptr<TrainedDescriptorIndex> getTrainedIndex() {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!trained) {
+			throw std::runtime_error("DescriptorIndex has not been trained, call train first");
+		}
+		return trained;
+	}
+
+	bool isTrained() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return !!trained;
+	}
+
+	std::string getAlgorithm() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return params.algorithm;
+	}
+
+	std::vector<int> getImageIds() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return imageIds;
+	}
+
+	int getNumImages() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return (int)trainDescriptors.size();
+	}
+
+	int getNumDescriptors() {
+		std::lock_guard<std::mutex> lock(mutex);
+		int numDescriptors = 0;
+		for (const cv::Mat& desc : trainDescriptors) {
+			numDescriptors += desc.rows;
+		}
+		return numDescriptors;
+	}
+
+private:
+	std::mutex mutex;
+	std::vector<cv::Mat> trainDescriptors;
+	std::vector<int> imageIds;
+	std::shared_ptr<TrainedDescriptorIndex> trained;
+	// keeps descriptors added by load alive
+	std::shared_ptr<MappedFile> mappedFile;
+};
+
+#endif
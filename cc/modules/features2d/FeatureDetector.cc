@@ -1,13 +1,42 @@
 #include "FeatureDetector.h"
 #include "FeatureDetectorBindings.h"
 
+std::vector<std::shared_ptr<Nan::Persistent<v8::FunctionTemplate>>> FeatureDetector::detectorConstructors;
+
 void FeatureDetector::Init(v8::Local<v8::FunctionTemplate> ctor) {
+  detectorConstructors.push_back(std::make_shared<Nan::Persistent<v8::FunctionTemplate>>(ctor));
   Nan::SetPrototypeMethod(ctor, "detect", FeatureDetector::Detect);
   Nan::SetPrototypeMethod(ctor, "compute", FeatureDetector::Compute);
   Nan::SetPrototypeMethod(ctor, "detectAsync", FeatureDetector::DetectAsync);
   Nan::SetPrototypeMethod(ctor, "computeAsync", FeatureDetector::ComputeAsync);
+  Nan::SetPrototypeMethod(ctor, "detectAndCompute", FeatureDetector::DetectAndCompute);
+  Nan::SetPrototypeMethod(ctor, "detectAndComputeAsync", FeatureDetector::DetectAndComputeAsync);
+  Nan::SetPrototypeMethod(ctor, "detectGrid", FeatureDetector::DetectGrid);
+  Nan::SetPrototypeMethod(ctor, "detectGridAsync", FeatureDetector::DetectGridAsync);
 };
 
+bool FeatureDetector::hasInstance(v8::Local<v8::Value> val) {
+  if (!val->IsObject()) {
+    return false;
+  }
+  for (std::shared_ptr<Nan::Persistent<v8::FunctionTemplate>> ctor : detectorConstructors) {
+    if (Nan::New(*ctor)->HasInstance(val)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FeatureDetector::detectorArg(int argN, cv::Ptr<cv::FeatureDetector>* det, Nan::NAN_METHOD_ARGS_TYPE info) {
+  if (!FF::hasArg(info, argN) || !hasInstance(info[argN])) {
+    Nan::ThrowError(Nan::New(std::string("expected arg ") + std::to_string(argN) + " to be a detector instance").ToLocalChecked());
+    return true;
+  }
+  v8::Local<v8::Object> obj = info[argN]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+  *det = Nan::ObjectWrap::Unwrap<FeatureDetector>(obj)->getDetector();
+  return false;
+}
+
 NAN_METHOD(FeatureDetector::Detect) {
   FF::SyncBindingBase(
     std::make_shared<FeatureDetectorBindings::DetectWorker>(FeatureDetector::unwrapThis(info)->getDetector()),
@@ -39,3 +68,35 @@ NAN_METHOD(FeatureDetector::ComputeAsync) {
     info
   );
 }
+
+NAN_METHOD(FeatureDetector::DetectAndCompute) {
+  FF::SyncBindingBase(
+    std::make_shared<FeatureDetectorBindings::DetectAndComputeWorker>(FeatureDetector::unwrapThis(info)->getDetector()),
+    "FeatureDetector::DetectAndCompute",
+    info
+  );
+}
+
+NAN_METHOD(FeatureDetector::DetectAndComputeAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FeatureDetectorBindings::DetectAndComputeWorker>(FeatureDetector::unwrapThis(info)->getDetector()),
+    "FeatureDetector::DetectAndComputeAsync",
+    info
+  );
+}
+
+NAN_METHOD(FeatureDetector::DetectGrid) {
+  FF::SyncBindingBase(
+    std::make_shared<FeatureDetectorBindings::DetectGridWorker>(FeatureDetector::unwrapThis(info)->getDetector()),
+    "FeatureDetector::DetectGrid",
+    info
+  );
+}
+
+NAN_METHOD(FeatureDetector::DetectGridAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<FeatureDetectorBindings::DetectGridWorker>(FeatureDetector::unwrapThis(info)->getDetector()),
+    "FeatureDetector::DetectGridAsync",
+    info
+  );
+}
@@ -19,6 +19,19 @@ public:
 	static NAN_METHOD(DetectAsync);
 	static NAN_METHOD(Compute);
 	static NAN_METHOD(ComputeAsync);
+	static NAN_METHOD(DetectAndCompute);
+	static NAN_METHOD(DetectAndComputeAsync);
+	static NAN_METHOD(DetectGrid);
+	static NAN_METHOD(DetectGridAsync);
+
+	// true if val is an instance of any of the detector classes
+	static bool hasInstance(v8::Local<v8::Value> val);
+	// unwraps the detector of a detector instance passed at argN, returns true and throws on error
+	static bool detectorArg(int argN, cv::Ptr<cv::FeatureDetector>* det, Nan::NAN_METHOD_ARGS_TYPE info);
+
+private:
+	// constructors of all detector classes, registered in Init
+	static std::vector<std::shared_ptr<Nan::Persistent<v8::FunctionTemplate>>> detectorConstructors;
 };
 
 #endif
\ No newline at end of file
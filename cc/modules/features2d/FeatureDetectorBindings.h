@@ -1,4 +1,9 @@
 #include "FeatureDetector.h"
+#include "features2dUtils.h"
+#include "parallelUtils.h"
+#include <numeric>
+#include <unordered_map>
+#include <cmath>
 
 #ifndef __FF_FEATUREDETECTORBINDINGS_H_
 #define __FF_FEATUREDETECTORBINDINGS_H_
@@ -13,6 +18,7 @@ namespace FeatureDetectorBindings {
     }
   
     cv::Mat img;
+    bool packed = false;
     std::vector<cv::KeyPoint> kps;
   
     std::string executeCatchCvExceptionWorker() {
@@ -23,10 +29,13 @@ namespace FeatureDetectorBindings {
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
       return Mat::Converter::arg(0, &img, info);
     }
-  
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Features2dUtils::unwrapPackedOption(&packed, 1, info);
+    }
   
     v8::Local<v8::Value> getReturnValue() {
-      return KeyPoint::ArrayConverter::wrap(kps);
+      return Features2dUtils::wrapKeyPoints(kps, packed);
     }
   };
   
@@ -49,7 +58,7 @@ namespace FeatureDetectorBindings {
     bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
       return (
         Mat::Converter::arg(0, &img, info)
-        || KeyPoint::ArrayConverter::arg(1, &kps, info)
+        || Features2dUtils::keyPointsArg(1, &kps, info)
       );
     }
   
@@ -57,8 +66,281 @@ namespace FeatureDetectorBindings {
       return Mat::Converter::wrap(desc);
     }
   };
-  
+
+  struct DetectAndComputeWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::FeatureDetector> det;
+    DetectAndComputeWorker(cv::Ptr<cv::FeatureDetector> _det) {
+      this->det = _det;
+    }
+
+    cv::Mat img;
+    cv::Mat mask;
+    int retainBest = 0;
+    bool packed = false;
+    std::vector<cv::KeyPoint> kps;
+    cv::Mat desc;
+
+    std::string executeCatchCvExceptionWorker() {
+      det->detectAndCompute(img, mask, kps, desc);
+      if (retainBest > 0 && (int)kps.size() > retainBest) {
+        // keep the strongest keypoints in detection order together with their descriptor rows
+        std::vector<int> order(kps.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::nth_element(order.begin(), order.begin() + retainBest, order.end(), [this](int a, int b) {
+          return kps[a].response > kps[b].response;
+        });
+        order.resize(retainBest);
+        std::sort(order.begin(), order.end());
+
+        std::vector<cv::KeyPoint> bestKps;
+        cv::Mat bestDesc(retainBest, desc.cols, desc.type());
+        for (int i = 0; i < retainBest; i++) {
+          bestKps.push_back(kps[order[i]]);
+          desc.row(order[i]).copyTo(bestDesc.row(i));
+        }
+        kps = bestKps;
+        desc = bestDesc;
+      }
+      return "";
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &img, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::Converter::optArg(1, &mask, info)
+        || FF::IntConverter::optArg(2, &retainBest, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1) && !Mat::hasInstance(info[1]);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        Mat::Converter::optProp(&mask, "mask", opts)
+        || FF::IntConverter::optProp(&retainBest, "retainBest", opts)
+        || FF::BoolConverter::optProp(&packed, "packed", opts)
+      );
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("keyPoints").ToLocalChecked(), Features2dUtils::wrapKeyPoints(kps, packed));
+      Nan::Set(ret, Nan::New("descriptors").ToLocalChecked(), Mat::Converter::wrap(desc));
+      return ret;
+    }
+  };
+
+  /* detects keypoints per cell of a rows x cols grid, each cell is detected on its own ROI extended by overlap
+     pixels, such that detectors with a border margin find keypoints near the seams, and only keeps the keypoints
+     lying inside the cell. keypoints closer than dedupRadius to a stronger keypoint of a neighbouring cell are
+     dropped and at most maxPerCell keypoints with the highest response are kept per cell */
+  struct DetectGridWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::FeatureDetector> det;
+    DetectGridWorker(cv::Ptr<cv::FeatureDetector> _det) {
+      this->det = _det;
+    }
+
+    cv::Mat img;
+    int rows = 4;
+    int cols = 4;
+    int maxPerCell = 0;
+    int overlap = 16;
+    double dedupRadius = 2;
+    bool packed = false;
+    std::vector<cv::KeyPoint> kps;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (rows < 1 || cols < 1) {
+        return "expected rows and cols to be at least 1";
+      }
+      if (overlap < 0) {
+        return "expected overlap to be non negative";
+      }
+      std::string err = validateImage();
+      if (!err.empty()) {
+        return err;
+      }
+      int numCells = rows * cols;
+      std::vector<cv::Rect> cells(numCells);
+      std::vector<std::vector<cv::KeyPoint>> cellKps(numCells);
+      cv::Rect imgRect(0, 0, img.cols, img.rows);
+      for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+          int x0 = c * img.cols / cols, x1 = (c + 1) * img.cols / cols;
+          int y0 = r * img.rows / rows, y1 = (r + 1) * img.rows / rows;
+          cells[r * cols + c] = cv::Rect(x0, y0, x1 - x0, y1 - y0);
+        }
+      }
+
+      auto detectCell = [&](int i) {
+        const cv::Rect& cell = cells[i];
+        cv::Rect roi = cv::Rect(cell.x - overlap, cell.y - overlap, cell.width + 2 * overlap, cell.height + 2 * overlap) & imgRect;
+        if (cell.area() == 0) {
+          return;
+        }
+        std::vector<cv::KeyPoint> roiKps;
+        det->detect(img(roi), roiKps);
+        for (cv::KeyPoint& kp : roiKps) {
+          kp.pt.x += roi.x;
+          kp.pt.y += roi.y;
+          if (cell.contains(cv::Point((int)kp.pt.x, (int)kp.pt.y))) {
+            cellKps[i].push_back(kp);
+          }
+        }
+      };
+      // MSER keeps its work buffers in the algorithm instance and can not detect concurrently
+      if (det.dynamicCast<cv::MSER>()) {
+        for (int i = 0; i < numCells; i++) {
+          detectCell(i);
+        }
+      }
+      else {
+        err = ParallelUtils::forEachStripe(numCells, detectCell);
+        if (!err.empty()) {
+          return err;
+        }
+      }
+
+      if (dedupRadius > 0) {
+        dedupSeams(cells, cellKps);
+      }
+      for (int i = 0; i < numCells; i++) {
+        std::vector<cv::KeyPoint>& cellBest = cellKps[i];
+        if (maxPerCell > 0 && (int)cellBest.size() > maxPerCell) {
+          cv::KeyPointsFilter::retainBest(cellBest, maxPerCell);
+          // retainBest keeps keypoints tied with the weakest one
+          cellBest.resize(std::min((int)cellBest.size(), maxPerCell));
+        }
+        kps.insert(kps.end(), cellBest.begin(), cellBest.end());
+      }
+      return "";
+    }
+
+    // checked up front, such that an unsupported image fails with a single error instead of an assertion per cell
+    std::string validateImage() {
+      if (img.empty()) {
+        return "expected image to be non empty";
+      }
+      if (img.channels() != 1 && img.channels() != 3 && img.channels() != 4) {
+        return "expected image to have 1, 3 or 4 channels";
+      }
+      bool requires8U = det.dynamicCast<cv::FastFeatureDetector>() || det.dynamicCast<cv::AgastFeatureDetector>()
+        || det.dynamicCast<cv::ORB>() || det.dynamicCast<cv::BRISK>() || det.dynamicCast<cv::MSER>();
+      if (requires8U && img.depth() != CV_8U) {
+        return "expected image depth to be CV_8U for this detector";
+      }
+      return "";
+    }
+
+    // only keypoints within dedupRadius of a cell border can duplicate keypoints of a neighbouring cell
+    void dedupSeams(const std::vector<cv::Rect>& cells, std::vector<std::vector<cv::KeyPoint>>& cellKps) {
+      struct SeamKeyPoint {
+        int cellIdx;
+        int kpIdx;
+      };
+      std::vector<SeamKeyPoint> seamKps;
+      for (size_t i = 0; i < cells.size(); i++) {
+        cv::Rect inner(cells[i].x + (int)dedupRadius, cells[i].y + (int)dedupRadius,
+          cells[i].width - 2 * (int)dedupRadius, cells[i].height - 2 * (int)dedupRadius);
+        for (size_t j = 0; j < cellKps[i].size(); j++) {
+          if (!inner.contains(cv::Point((int)cellKps[i][j].pt.x, (int)cellKps[i][j].pt.y))) {
+            seamKps.push_back({ (int)i, (int)j });
+          }
+        }
+      }
+      std::sort(seamKps.begin(), seamKps.end(), [&](const SeamKeyPoint& a, const SeamKeyPoint& b) {
+        return cellKps[a.cellIdx][a.kpIdx].response > cellKps[b.cellIdx][b.kpIdx].response;
+      });
+
+      // a keypoint is dropped if a stronger keypoint of another cell, which is kept itself, lies within
+      // dedupRadius, kept keypoints are hashed into buckets of size dedupRadius, such that only the 3x3
+      // neighbouring buckets have to be searched
+      std::vector<std::vector<bool>> removed(cells.size());
+      for (size_t i = 0; i < cells.size(); i++) {
+        removed[i] = std::vector<bool>(cellKps[i].size(), false);
+      }
+      auto bucketKey = [](int64_t bx, int64_t by) {
+        return (bx << 32) ^ (by & 0xFFFFFFFF);
+      };
+      std::unordered_map<int64_t, std::vector<int>> keptBuckets;
+      double radiusSq = dedupRadius * dedupRadius;
+      for (size_t a = 0; a < seamKps.size(); a++) {
+        const SeamKeyPoint& weaker = seamKps[a];
+        const cv::Point2f& pt = cellKps[weaker.cellIdx][weaker.kpIdx].pt;
+        int64_t bx = (int64_t)std::floor(pt.x / dedupRadius);
+        int64_t by = (int64_t)std::floor(pt.y / dedupRadius);
+        bool isDuplicate = false;
+        for (int64_t nx = bx - 1; nx <= bx + 1 && !isDuplicate; nx++) {
+          for (int64_t ny = by - 1; ny <= by + 1 && !isDuplicate; ny++) {
+            auto bucket = keptBuckets.find(bucketKey(nx, ny));
+            if (bucket == keptBuckets.end()) {
+              continue;
+            }
+            for (int b : bucket->second) {
+              const SeamKeyPoint& stronger = seamKps[b];
+              if (stronger.cellIdx == weaker.cellIdx) {
+                continue;
+              }
+              cv::Point2f diff = cellKps[stronger.cellIdx][stronger.kpIdx].pt - pt;
+              if (diff.dot(diff) <= radiusSq) {
+                isDuplicate = true;
+                break;
+              }
+            }
+          }
+        }
+        if (isDuplicate) {
+          removed[weaker.cellIdx][weaker.kpIdx] = true;
+        }
+        else {
+          keptBuckets[bucketKey(bx, by)].push_back((int)a);
+        }
+      }
+
+      for (size_t i = 0; i < cells.size(); i++) {
+        std::vector<cv::KeyPoint> kept;
+        for (size_t j = 0; j < cellKps[i].size(); j++) {
+          if (!removed[i][j]) {
+            kept.push_back(cellKps[i][j]);
+          }
+        }
+        cellKps[i] = kept;
+      }
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &img, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::IntConverter::optProp(&rows, "rows", opts)
+        || FF::IntConverter::optProp(&cols, "cols", opts)
+        || FF::IntConverter::optProp(&maxPerCell, "maxPerCell", opts)
+        || FF::IntConverter::optProp(&overlap, "overlap", opts)
+        || FF::DoubleConverter::optProp(&dedupRadius, "dedupRadius", opts)
+        || FF::BoolConverter::optProp(&packed, "packed", opts)
+      );
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Features2dUtils::wrapKeyPoints(kps, packed);
+    }
+  };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,78 @@
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "fileUtils.h"
+
+#ifndef WIN
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef __FF_MAPPEDFILE_H__
+#define __FF_MAPPEDFILE_H__
+
+/* read only view of a file, the file is memory mapped such that processes loading the same file
+   share its pages, on windows the file contents are read into memory instead */
+class MappedFile {
+public:
+	MappedFile(const std::string& path) {
+#ifdef WIN
+		std::ifstream stream(path.c_str(), std::ios::binary);
+		if (!stream) {
+			throw std::runtime_error("failed to open file: " + path);
+		}
+		buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		data = buffer.data();
+		size = buffer.size();
+#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			throw std::runtime_error("failed to open file: " + path);
+		}
+		struct stat st;
+		if (fstat(fd, &st) != 0) {
+			close(fd);
+			throw std::runtime_error("failed to stat file: " + path);
+		}
+		size = (size_t)st.st_size;
+		void* mapped = size > 0 ? mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0) : NULL;
+		close(fd);
+		if (mapped == MAP_FAILED) {
+			throw std::runtime_error("failed to mmap file: " + path);
+		}
+		data = (const char*)mapped;
+#endif
+	}
+
+	~MappedFile() {
+#ifndef WIN
+		if (data != NULL) {
+			munmap((void*)data, size);
+		}
+#endif
+	}
+
+	const char* getData() const {
+		return data;
+	}
+
+	size_t getSize() const {
+		return size;
+	}
+
+private:
+	const char* data = NULL;
+	size_t size = 0;
+#ifdef WIN
+	std::vector<char> buffer;
+#endif
+
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+};
+
+#endif
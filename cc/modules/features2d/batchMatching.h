@@ -0,0 +1,237 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include <opencv2/calib3d.hpp>
+#include "CatchCvExceptionWorker.h"
+#include "Mat.h"
+#include "DescriptorIndex.h"
+#include "features2dUtils.h"
+#include "parallelUtils.h"
+
+#ifndef __FF_BATCHMATCHING_H__
+#define __FF_BATCHMATCHING_H__
+
+namespace BatchMatching {
+
+  struct ImageScore {
+    int imgIdx = 0;
+    int imageId = 0;
+    int numInliers = 0;
+    std::vector<cv::DMatch> matches;
+    cv::Mat homography;
+  };
+
+  // keypoints are given as an array of KeyPoints or packed keypoints
+  static inline bool unwrapKeyPoints(std::vector<cv::KeyPoint>* kps, v8::Local<v8::Value> val) {
+    if (FF::Float32TypedArrayConverter::isTypedArray(val)) {
+      return Features2dUtils::unwrapPackedKeyPoints(kps, val);
+    }
+    return KeyPoint::ArrayConverter::unwrapTo(kps, val);
+  }
+
+  /* matches one query descriptor Mat against a list of train descriptor sets or a trained DescriptorIndex,
+     each image is matched in parallel with kNN and ratio test, optional cross-check and optional RANSAC
+     homography verification if keypoints are given, only the topK images with most inliers are returned,
+     images without any surviving match are omitted */
+  struct MatchKnnBatchWorker : public CatchCvExceptionWorker {
+  public:
+    // normType -1 selects the hamming norm for CV_8U descriptors and L2 otherwise
+    MatchKnnBatchWorker(int normType = -1, bool crossCheck = false) {
+      this->normType = normType;
+      filter.enabled = true;
+      filter.ratio = 0.8;
+      filter.crossCheck = crossCheck;
+    }
+
+    cv::Mat queryDescriptors;
+    std::vector<cv::Mat> trainDescriptors;
+    std::shared_ptr<DescriptorIndexState> index;
+
+    int normType;
+    int k = 2;
+    Features2dUtils::MatchFilter filter;
+    int topK = 10;
+    int minMatches = 0;
+    double ransacReprojThreshold = 3.0;
+    bool packed = false;
+    std::vector<cv::KeyPoint> queryKeyPoints;
+    std::vector<std::vector<cv::KeyPoint>> trainKeyPoints;
+
+    std::vector<ImageScore> results;
+
+    std::string executeCatchCvExceptionWorker() {
+      cv::Mat query = queryDescriptors;
+      std::vector<int> imageIds;
+      if (index) {
+        std::shared_ptr<TrainedDescriptorIndex> trained = index->getTrainedIndex();
+        query = trained->prepareQuery(queryDescriptors);
+        for (int i = 0; i < trained->getNumImages(); i++) {
+          trainDescriptors.push_back(trained->getImageDescriptors(i));
+        }
+        imageIds = trained->imageIds;
+        if (normType < 0) {
+          normType = trained->params.algorithm == "lsh" ? cv::NORM_HAMMING
+            : (trained->params.algorithm == "kdtree" ? cv::NORM_L2 : trained->params.normType);
+        }
+      }
+      if (normType < 0) {
+        normType = query.depth() == CV_8U ? cv::NORM_HAMMING : cv::NORM_L2;
+      }
+
+      // validate everything up front, such that invalid input is reported before any image is matched
+      if (k < 1 || (filter.ratio < 1 && k < 2)) {
+        return "expected k to be at least 2 for the ratio test";
+      }
+      for (const cv::Mat& train : trainDescriptors) {
+        if (train.rows > 0 && (train.type() != query.type() || train.cols != query.cols)) {
+          return "expected train descriptors to have the same type and number of cols as the query descriptors";
+        }
+      }
+      bool verify = queryKeyPoints.size() > 0;
+      if (verify) {
+        if ((int)queryKeyPoints.size() != query.rows || trainKeyPoints.size() != trainDescriptors.size()) {
+          return "expected one keypoint per descriptor for the query and each train descriptor set";
+        }
+        for (size_t i = 0; i < trainKeyPoints.size(); i++) {
+          if ((int)trainKeyPoints[i].size() != trainDescriptors[i].rows) {
+            return "expected one keypoint per descriptor for the query and each train descriptor set";
+          }
+        }
+      }
+
+      int numImages = (int)trainDescriptors.size();
+      std::vector<ImageScore> scores(numImages);
+      std::string err = ParallelUtils::forEachStripe(numImages, [&](int i) {
+        cv::BFMatcher matcher(normType);
+        scores[i].imgIdx = i;
+        scores[i].imageId = imageIds.size() > 0 ? imageIds[i] : i;
+        matchImage(matcher, query, i, verify, scores[i]);
+      });
+      if (!err.empty()) {
+        return err;
+      }
+
+      for (ImageScore& score : scores) {
+        if ((int)score.matches.size() >= minMatches && score.numInliers > 0) {
+          results.push_back(score);
+        }
+      }
+      int numResults = std::min((int)results.size(), topK > 0 ? topK : (int)results.size());
+      std::partial_sort(results.begin(), results.begin() + numResults, results.end(),
+        [](const ImageScore& a, const ImageScore& b) {
+          return a.numInliers != b.numInliers ? a.numInliers > b.numInliers : a.imgIdx < b.imgIdx;
+        });
+      results.resize(numResults);
+      return "";
+    }
+
+    void matchImage(cv::BFMatcher& matcher, const cv::Mat& query, int imgIdx, bool verify, ImageScore& score) {
+      const cv::Mat& train = trainDescriptors[imgIdx];
+      if (query.rows == 0 || train.rows == 0) {
+        return;
+      }
+      std::vector<std::vector<cv::DMatch>> knnMatches;
+      matcher.knnMatch(query, train, knnMatches, k);
+      score.matches = Features2dUtils::filterMatches(matcher, query, train, knnMatches, filter);
+      for (cv::DMatch& match : score.matches) {
+        match.imgIdx = imgIdx;
+      }
+      score.numInliers = (int)score.matches.size();
+
+      if (!verify) {
+        return;
+      }
+      // a homography needs at least 4 correspondences
+      if (score.matches.size() < 4) {
+        score.numInliers = 0;
+        return;
+      }
+      std::vector<cv::Point2f> srcPoints, dstPoints;
+      for (const cv::DMatch& match : score.matches) {
+        srcPoints.push_back(queryKeyPoints[match.queryIdx].pt);
+        dstPoints.push_back(trainKeyPoints[imgIdx][match.trainIdx].pt);
+      }
+      std::vector<uchar> mask;
+      score.homography = cv::findHomography(srcPoints, dstPoints, cv::RANSAC, ransacReprojThreshold, mask);
+      std::vector<cv::DMatch> inliers;
+      for (size_t i = 0; i < mask.size(); i++) {
+        if (mask[i]) {
+          inliers.push_back(score.matches[i]);
+        }
+      }
+      score.matches = inliers;
+      score.numInliers = score.homography.empty() ? 0 : (int)inliers.size();
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(results.size());
+      for (size_t i = 0; i < results.size(); i++) {
+        v8::Local<v8::Object> jsScore = Nan::New<v8::Object>();
+        Nan::Set(jsScore, Nan::New("imgIdx").ToLocalChecked(), FF::IntConverter::wrap(results[i].imgIdx));
+        Nan::Set(jsScore, Nan::New("imageId").ToLocalChecked(), FF::IntConverter::wrap(results[i].imageId));
+        Nan::Set(jsScore, Nan::New("numInliers").ToLocalChecked(), FF::IntConverter::wrap(results[i].numInliers));
+        Nan::Set(jsScore, Nan::New("matches").ToLocalChecked(), Features2dUtils::wrapMatches(results[i].matches, packed));
+        if (!results[i].homography.empty()) {
+          Nan::Set(jsScore, Nan::New("homography").ToLocalChecked(), Mat::Converter::wrap(results[i].homography));
+        }
+        Nan::Set(ret, i, jsScore);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (Mat::Converter::arg(0, &queryDescriptors, info)) {
+        return true;
+      }
+      if (FF::hasArg(info, 1) && DescriptorIndex::hasInstance(info[1])) {
+        return DescriptorIndex::Converter::arg(1, &index, info);
+      }
+      return Mat::ArrayConverter::arg(1, &trainDescriptors, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 2);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[2]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      if (
+        FF::IntConverter::optProp(&k, "k", opts) ||
+        FF::DoubleConverter::optProp(&filter.ratio, "ratio", opts) ||
+        FF::BoolConverter::optProp(&filter.crossCheck, "crossCheck", opts) ||
+        FF::DoubleConverter::optProp(&filter.maxDistance, "maxDistance", opts) ||
+        FF::IntConverter::optProp(&topK, "topK", opts) ||
+        FF::IntConverter::optProp(&minMatches, "minMatches", opts) ||
+        FF::DoubleConverter::optProp(&ransacReprojThreshold, "ransacReprojThreshold", opts) ||
+        FF::IntConverter::optProp(&normType, "normType", opts) ||
+        FF::BoolConverter::optProp(&packed, "packed", opts)
+      ) {
+        return true;
+      }
+
+      v8::Local<v8::Value> jsQueryKps = Nan::Get(opts, Nan::New("queryKeyPoints").ToLocalChecked()).ToLocalChecked();
+      v8::Local<v8::Value> jsTrainKps = Nan::Get(opts, Nan::New("trainKeyPoints").ToLocalChecked()).ToLocalChecked();
+      if (jsQueryKps->IsUndefined() && jsTrainKps->IsUndefined()) {
+        return false;
+      }
+      if (jsQueryKps->IsUndefined() || !jsTrainKps->IsArray()) {
+        Nan::ThrowError("expected queryKeyPoints and trainKeyPoints to be passed for homography verification");
+        return true;
+      }
+      if (unwrapKeyPoints(&queryKeyPoints, jsQueryKps)) {
+        return true;
+      }
+      v8::Local<v8::Array> jsTrainKpsArray = v8::Local<v8::Array>::Cast(jsTrainKps);
+      trainKeyPoints.resize(jsTrainKpsArray->Length());
+      for (uint i = 0; i < jsTrainKpsArray->Length(); i++) {
+        if (unwrapKeyPoints(&trainKeyPoints[i], Nan::Get(jsTrainKpsArray, i).ToLocalChecked())) {
+          return true;
+        }
+      }
+      return false;
+    }
+  };
+
+}
+
+#endif
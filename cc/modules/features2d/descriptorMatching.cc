@@ -1,4 +1,5 @@
 #include "descriptorMatching.h"
+#include "features2dUtils.h"
 
 NAN_MODULE_INIT(DescriptorMatching::Init) {
 	Nan::SetMethod(target, "matchFlannBased", MatchFlannBased);
@@ -112,10 +113,15 @@ public:
 
 	cv::Mat descFrom;
 	cv::Mat descTo;
+	bool packed = false;
+	Features2dUtils::MatchFilter filter;
 	std::vector<cv::DMatch> dmatches;
 
 	std::string executeCatchCvExceptionWorker() {
 		matcher->match(descFrom, descTo, dmatches);
+		if (filter.enabled) {
+			dmatches = Features2dUtils::filterMatches(*matcher, descFrom, descTo, dmatches, filter);
+		}
 		return "";
 	}
 
@@ -124,8 +130,13 @@ public:
 			|| Mat::Converter::arg(1, &descTo, info);
 	}
 
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Features2dUtils::unwrapPackedOption(&packed, 2, info)
+			|| Features2dUtils::unwrapMatchFilterOption(&filter, 2, info);
+	}
+
 	v8::Local<v8::Value> getReturnValue() {
-		return DescriptorMatch::ArrayConverter::wrap(dmatches);
+		return Features2dUtils::wrapMatches(dmatches, packed);
 	}
 };
 
@@ -1,4 +1,7 @@
 #include "descriptorMatchingKnn.h"
+#include "features2dUtils.h"
+#include "batchMatching.h"
+#include "hammingKnn.h"
 
 NAN_MODULE_INIT(DescriptorMatchingKnn::Init) {
 	Nan::SetMethod(target, "matchKnnFlannBased", MatchKnnFlannBased);
@@ -9,6 +12,10 @@ NAN_MODULE_INIT(DescriptorMatchingKnn::Init) {
 	Nan::SetMethod(target, "matchKnnBruteForceAsync", MatchKnnBruteForceAsync);
 	Nan::SetMethod(target, "matchKnnBruteForceL1Async", MatchKnnBruteForceL1Async);
 	Nan::SetMethod(target, "matchKnnBruteForceHammingAsync", MatchKnnBruteForceHammingAsync);
+	Nan::SetMethod(target, "matchKnnBruteForceHammingBlocked", MatchKnnBruteForceHammingBlocked);
+	Nan::SetMethod(target, "matchKnnBruteForceHammingBlockedAsync", MatchKnnBruteForceHammingBlockedAsync);
+	Nan::SetMethod(target, "matchKnnBatch", MatchKnnBatch);
+	Nan::SetMethod(target, "matchKnnBatchAsync", MatchKnnBatchAsync);
 #if 2 <= CV_VERSION_MINOR
 	Nan::SetMethod(target, "matchKnnBruteForceHammingLut", MatchKnnBruteForceHammingLut);
 	Nan::SetMethod(target, "matchKnnBruteForceSL2", MatchKnnBruteForceSL2);
@@ -113,10 +120,16 @@ public:
 	cv::Mat descFrom;
 	cv::Mat descTo;
 	int k;
+	bool packed = false;
+	Features2dUtils::MatchFilter filter;
 	std::vector<std::vector<cv::DMatch>> dmatches;
+	std::vector<cv::DMatch> filtered;
 
 	std::string executeCatchCvExceptionWorker() {
 		matcher->knnMatch(descFrom, descTo, dmatches, k);
+		if (filter.enabled) {
+			filtered = Features2dUtils::filterMatches(*matcher, descFrom, descTo, dmatches, filter);
+		}
 		return "";
 	}
 
@@ -126,8 +139,17 @@ public:
 			|| FF::IntConverter::arg(2, &k, info);
 	}
 
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Features2dUtils::unwrapPackedOption(&packed, 3, info)
+			|| Features2dUtils::unwrapMatchFilterOption(&filter, 3, info);
+	}
+
+	// filtered matches are returned as a flat array with the surviving best match of each query
 	v8::Local<v8::Value> getReturnValue() {
-		return DescriptorMatch::ArrayOfArraysConverter::wrap(dmatches);
+		if (filter.enabled) {
+			return Features2dUtils::wrapMatches(filtered, packed);
+		}
+		return Features2dUtils::wrapMatches(dmatches, packed);
 	}
 };
 
@@ -154,3 +176,35 @@ void DescriptorMatchingKnn::matchKnnAsync(Nan::NAN_METHOD_ARGS_TYPE info, int ma
 		info
 	);
 }
+
+NAN_METHOD(DescriptorMatchingKnn::MatchKnnBruteForceHammingBlocked) {
+	FF::SyncBindingBase(
+		std::make_shared<HammingKnn::MatchKnnWorker>(),
+		"DescriptorMatchingKnn::MatchKnnBruteForceHammingBlocked",
+		info
+	);
+}
+
+NAN_METHOD(DescriptorMatchingKnn::MatchKnnBruteForceHammingBlockedAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<HammingKnn::MatchKnnWorker>(),
+		"DescriptorMatchingKnn::MatchKnnBruteForceHammingBlockedAsync",
+		info
+	);
+}
+
+NAN_METHOD(DescriptorMatchingKnn::MatchKnnBatch) {
+	FF::SyncBindingBase(
+		std::make_shared<BatchMatching::MatchKnnBatchWorker>(),
+		"DescriptorMatchingKnn::MatchKnnBatch",
+		info
+	);
+}
+
+NAN_METHOD(DescriptorMatchingKnn::MatchKnnBatchAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<BatchMatching::MatchKnnBatchWorker>(),
+		"DescriptorMatchingKnn::MatchKnnBatchAsync",
+		info
+	);
+}
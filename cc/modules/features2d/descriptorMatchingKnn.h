@@ -26,6 +26,10 @@ public:
 	static NAN_METHOD(MatchKnnBruteForceHammingAsync);
 	static NAN_METHOD(MatchKnnBruteForceHammingLutAsync);
 	static NAN_METHOD(MatchKnnBruteForceSL2Async);
+	static NAN_METHOD(MatchKnnBruteForceHammingBlocked);
+	static NAN_METHOD(MatchKnnBruteForceHammingBlockedAsync);
+	static NAN_METHOD(MatchKnnBatch);
+	static NAN_METHOD(MatchKnnBatchAsync);
 #if CV_VERSION_MINOR < 2
 	static void matchKnn(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType);
 	static void matchKnnAsync(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType);
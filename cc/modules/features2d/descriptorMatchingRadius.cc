@@ -0,0 +1,171 @@
+#include "descriptorMatchingRadius.h"
+#include "features2dUtils.h"
+
+NAN_MODULE_INIT(DescriptorMatchingRadius::Init) {
+	Nan::SetMethod(target, "radiusMatchFlannBased", RadiusMatchFlannBased);
+	Nan::SetMethod(target, "radiusMatchBruteForce", RadiusMatchBruteForce);
+	Nan::SetMethod(target, "radiusMatchBruteForceL1", RadiusMatchBruteForceL1);
+	Nan::SetMethod(target, "radiusMatchBruteForceHamming", RadiusMatchBruteForceHamming);
+	Nan::SetMethod(target, "radiusMatchFlannBasedAsync", RadiusMatchFlannBasedAsync);
+	Nan::SetMethod(target, "radiusMatchBruteForceAsync", RadiusMatchBruteForceAsync);
+	Nan::SetMethod(target, "radiusMatchBruteForceL1Async", RadiusMatchBruteForceL1Async);
+	Nan::SetMethod(target, "radiusMatchBruteForceHammingAsync", RadiusMatchBruteForceHammingAsync);
+#if 2 <= CV_VERSION_MINOR
+	Nan::SetMethod(target, "radiusMatchBruteForceHammingLut", RadiusMatchBruteForceHammingLut);
+	Nan::SetMethod(target, "radiusMatchBruteForceSL2", RadiusMatchBruteForceSL2);
+	Nan::SetMethod(target, "radiusMatchBruteForceHammingLutAsync", RadiusMatchBruteForceHammingLutAsync);
+	Nan::SetMethod(target, "radiusMatchBruteForceSL2Async", RadiusMatchBruteForceSL2Async);
+#endif
+};
+
+#if CV_VERSION_MINOR < 2
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchFlannBased) {
+	radiusMatch(info, "FlannBased");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForce) {
+	radiusMatch(info, "BruteForce");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceL1) {
+	radiusMatch(info, "BruteForce-L1");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHamming) {
+	radiusMatch(info, "BruteForce-Hamming");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchFlannBasedAsync) {
+	radiusMatchAsync(info, "FlannBased");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceAsync) {
+	radiusMatchAsync(info, "BruteForce");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceL1Async) {
+	radiusMatchAsync(info, "BruteForce-L1");
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHammingAsync) {
+	radiusMatchAsync(info, "BruteForce-Hamming");
+}
+
+#else
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchFlannBased) {
+	radiusMatch(info, cv::DescriptorMatcher::FLANNBASED);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForce) {
+	radiusMatch(info, cv::DescriptorMatcher::BRUTEFORCE);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceL1) {
+	radiusMatch(info, cv::DescriptorMatcher::BRUTEFORCE_L1);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHamming) {
+	radiusMatch(info, cv::DescriptorMatcher::BRUTEFORCE_HAMMING);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHammingLut) {
+	radiusMatch(info, cv::DescriptorMatcher::BRUTEFORCE_HAMMINGLUT);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceSL2) {
+	radiusMatch(info, cv::DescriptorMatcher::BRUTEFORCE_SL2);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchFlannBasedAsync) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::FLANNBASED);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceAsync) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::BRUTEFORCE);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceL1Async) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::BRUTEFORCE_L1);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHammingAsync) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::BRUTEFORCE_HAMMING);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceHammingLutAsync) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::BRUTEFORCE_HAMMINGLUT);
+}
+
+NAN_METHOD(DescriptorMatchingRadius::RadiusMatchBruteForceSL2Async) {
+	radiusMatchAsync(info, cv::DescriptorMatcher::BRUTEFORCE_SL2);
+}
+
+#endif
+
+struct DescriptorMatchingRadius::RadiusMatchWorker : public CatchCvExceptionWorker {
+public:
+	cv::Ptr<cv::DescriptorMatcher> matcher;
+	RadiusMatchWorker(cv::Ptr<cv::DescriptorMatcher> _matcher) {
+		this->matcher = _matcher;
+	}
+
+	cv::Mat descFrom;
+	cv::Mat descTo;
+	float maxDistance;
+	bool packed = false;
+	Features2dUtils::MatchFilter filter;
+	std::vector<std::vector<cv::DMatch>> dmatches;
+	std::vector<cv::DMatch> filtered;
+
+	std::string executeCatchCvExceptionWorker() {
+		matcher->radiusMatch(descFrom, descTo, dmatches, maxDistance);
+		if (filter.enabled) {
+			filtered = Features2dUtils::filterMatches(*matcher, descFrom, descTo, dmatches, filter);
+		}
+		return "";
+	}
+
+	bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Mat::Converter::arg(0, &descFrom, info)
+			|| Mat::Converter::arg(1, &descTo, info)
+			|| FF::FloatConverter::arg(2, &maxDistance, info);
+	}
+
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Features2dUtils::unwrapPackedOption(&packed, 3, info)
+			|| Features2dUtils::unwrapMatchFilterOption(&filter, 3, info);
+	}
+
+	v8::Local<v8::Value> getReturnValue() {
+		if (filter.enabled) {
+			return Features2dUtils::wrapMatches(filtered, packed);
+		}
+		return Features2dUtils::wrapMatches(dmatches, packed);
+	}
+};
+
+#if CV_VERSION_MINOR < 2
+void DescriptorMatchingRadius::radiusMatch(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType) {
+#else
+void DescriptorMatchingRadius::radiusMatch(Nan::NAN_METHOD_ARGS_TYPE info, int matcherType) {
+#endif
+	FF::SyncBindingBase(
+		std::make_shared<RadiusMatchWorker>(cv::DescriptorMatcher::create(matcherType)),
+		"DescriptorMatchingRadius::RadiusMatch",
+		info
+	);
+}
+
+#if CV_VERSION_MINOR < 2
+void DescriptorMatchingRadius::radiusMatchAsync(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType) {
+#else
+void DescriptorMatchingRadius::radiusMatchAsync(Nan::NAN_METHOD_ARGS_TYPE info, int matcherType) {
+#endif
+	FF::AsyncBindingBase(
+		std::make_shared<RadiusMatchWorker>(cv::DescriptorMatcher::create(matcherType)),
+		"DescriptorMatchingRadius::RadiusMatchAsync",
+		info
+	);
+}
@@ -0,0 +1,40 @@
+#include "macros.h"
+#include "NativeNodeUtils.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include "Mat.h"
+#include "KeyPoint.h"
+#include "DescriptorMatch.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_DESCRIPTORMATCHINGRADIUS_H__
+#define __FF_DESCRIPTORMATCHINGRADIUS_H__
+
+class DescriptorMatchingRadius : public Nan::ObjectWrap {
+public:
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(RadiusMatchFlannBased);
+	static NAN_METHOD(RadiusMatchBruteForce);
+	static NAN_METHOD(RadiusMatchBruteForceL1);
+	static NAN_METHOD(RadiusMatchBruteForceHamming);
+	static NAN_METHOD(RadiusMatchBruteForceHammingLut);
+	static NAN_METHOD(RadiusMatchBruteForceSL2);
+	static NAN_METHOD(RadiusMatchFlannBasedAsync);
+	static NAN_METHOD(RadiusMatchBruteForceAsync);
+	static NAN_METHOD(RadiusMatchBruteForceL1Async);
+	static NAN_METHOD(RadiusMatchBruteForceHammingAsync);
+	static NAN_METHOD(RadiusMatchBruteForceHammingLutAsync);
+	static NAN_METHOD(RadiusMatchBruteForceSL2Async);
+#if CV_VERSION_MINOR < 2
+	static void radiusMatch(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType);
+	static void radiusMatchAsync(Nan::NAN_METHOD_ARGS_TYPE info, std::string matcherType);
+#else
+	static void radiusMatch(Nan::NAN_METHOD_ARGS_TYPE info, int matcherType);
+	static void radiusMatchAsync(Nan::NAN_METHOD_ARGS_TYPE info, int matcherType);
+#endif
+
+	struct RadiusMatchWorker;
+};
+
+#endif
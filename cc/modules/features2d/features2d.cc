@@ -2,9 +2,15 @@
 #include "KeyPoint.h"
 #include "KeyPointMatch.h"
 #include "DescriptorMatch.h"
+#include "features2dUtils.h"
 #include "BFMatcher.h"
+#include "DescriptorIndex.h"
+#include "BOWKMeansTrainer.h"
+#include "BOWImgDescriptorExtractor.h"
+#include "BOWIndex.h"
 #include "descriptorMatching.h"
 #include "descriptorMatchingKnn.h"
+#include "descriptorMatchingRadius.h"
 #include "detectors/AGASTDetector.h"
 #include "detectors/AKAZEDetector.h"
 #include "detectors/BRISKDetector.h"
@@ -21,10 +27,15 @@ NAN_MODULE_INIT(Features2d::Init) {
 	DescriptorMatch::Init(target);
 	DescriptorMatching::Init(target);
 	DescriptorMatchingKnn::Init(target);
+	DescriptorMatchingRadius::Init(target);
 	AGASTDetector::Init(target);
 	AKAZEDetector::Init(target);
 	BRISKDetector::Init(target);
 	BFMatcher::Init(target);
+	DescriptorIndex::Init(target);
+	BOWKMeansTrainer::Init(target);
+	BOWImgDescriptorExtractor::Init(target);
+	BOWIndex::Init(target);
 	FASTDetector::Init(target);
 	GFTTDetector::Init(target);
 	KAZEDetector::Init(target);
@@ -80,7 +91,7 @@ NAN_METHOD(Features2d::DrawKeyPoints) {
 	std::vector<cv::KeyPoint> kps;
 	if (
 		Mat::Converter::arg(0, &img, info) ||
-		KeyPoint::ArrayConverter::arg(1, &kps, info)
+		Features2dUtils::keyPointsArg(1, &kps, info)
 	) {
 		return tryCatch.reThrow();
 	}
@@ -99,9 +110,9 @@ NAN_METHOD(Features2d::DrawMatches) {
 	if (
 		Mat::Converter::arg(0, &img1, info) ||
 		Mat::Converter::arg(1, &img2, info) ||
-		KeyPoint::ArrayConverter::arg(2, &kps1, info) ||
-		KeyPoint::ArrayConverter::arg(3, &kps2, info) ||
-		DescriptorMatch::ArrayConverter::arg(4, &dMatches, info)
+		Features2dUtils::keyPointsArg(2, &kps1, info) ||
+		Features2dUtils::keyPointsArg(3, &kps2, info) ||
+		Features2dUtils::matchesArg(4, &dMatches, info)
 		) {
 		return tryCatch.reThrow();
 	}
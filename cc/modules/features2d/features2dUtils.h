@@ -0,0 +1,232 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/features2d.hpp>
+#include "typedArrayUtils.h"
+#include "KeyPoint.h"
+#include "DescriptorMatch.h"
+
+#ifndef __FF_FEATURES2DUTILS_H__
+#define __FF_FEATURES2DUTILS_H__
+
+namespace Features2dUtils {
+
+  // packed keypoints are Float32Array rows of [x, y, size, angle, response, octave, class_id]
+  static const int packedKeyPointStride = 7;
+
+  static inline v8::Local<v8::Value> wrapPackedKeyPoints(const std::vector<cv::KeyPoint>& kps) {
+    std::vector<float> packed(kps.size() * packedKeyPointStride);
+    for (size_t i = 0; i < kps.size(); i++) {
+      float* row = &packed[i * packedKeyPointStride];
+      row[0] = kps[i].pt.x;
+      row[1] = kps[i].pt.y;
+      row[2] = kps[i].size;
+      row[3] = kps[i].angle;
+      row[4] = kps[i].response;
+      row[5] = (float)kps[i].octave;
+      row[6] = (float)kps[i].class_id;
+    }
+    return FF::Float32TypedArrayConverter::wrap(packed);
+  }
+
+  static inline v8::Local<v8::Value> wrapKeyPoints(const std::vector<cv::KeyPoint>& kps, bool packed) {
+    if (packed) {
+      return wrapPackedKeyPoints(kps);
+    }
+    return KeyPoint::ArrayConverter::wrap(kps);
+  }
+
+  // unpacks a Float32Array of packed keypoints, returns true and throws on error
+  static inline bool unwrapPackedKeyPoints(std::vector<cv::KeyPoint>* kps, v8::Local<v8::Value> val) {
+    std::vector<float> packed;
+    FF::Float32TypedArrayConverter::unwrapUnchecked(&packed, val);
+    if (packed.size() % packedKeyPointStride != 0) {
+      Nan::ThrowError(Nan::New(
+        std::string("expected packed keypoints to have ") + std::to_string(packedKeyPointStride) + " values per keypoint"
+      ).ToLocalChecked());
+      return true;
+    }
+    size_t numKps = packed.size() / packedKeyPointStride;
+    kps->resize(numKps);
+    for (size_t i = 0; i < numKps; i++) {
+      const float* row = &packed[i * packedKeyPointStride];
+      kps->at(i) = cv::KeyPoint(row[0], row[1], row[2], row[3], row[4], (int)row[5], (int)row[6]);
+    }
+    return false;
+  }
+
+  // accepts an array of KeyPoints or packed keypoints
+  static inline bool keyPointsArg(int argN, std::vector<cv::KeyPoint>* kps, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (FF::Float32TypedArrayConverter::isTypedArray(info[argN])) {
+      return unwrapPackedKeyPoints(kps, info[argN]);
+    }
+    return KeyPoint::ArrayConverter::arg(argN, kps, info);
+  }
+
+  // packed matches are returned as { queryIdx: Int32Array, trainIdx: Int32Array, imgIdx: Int32Array, distance: Float32Array }
+  static inline v8::Local<v8::Value> wrapPackedMatches(const std::vector<cv::DMatch>& matches) {
+    std::vector<int> queryIdx(matches.size()), trainIdx(matches.size()), imgIdx(matches.size());
+    std::vector<float> distance(matches.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+      queryIdx[i] = matches[i].queryIdx;
+      trainIdx[i] = matches[i].trainIdx;
+      imgIdx[i] = matches[i].imgIdx;
+      distance[i] = matches[i].distance;
+    }
+    v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+    Nan::Set(ret, Nan::New("queryIdx").ToLocalChecked(), FF::Int32TypedArrayConverter::wrap(queryIdx));
+    Nan::Set(ret, Nan::New("trainIdx").ToLocalChecked(), FF::Int32TypedArrayConverter::wrap(trainIdx));
+    Nan::Set(ret, Nan::New("imgIdx").ToLocalChecked(), FF::Int32TypedArrayConverter::wrap(imgIdx));
+    Nan::Set(ret, Nan::New("distance").ToLocalChecked(), FF::Float32TypedArrayConverter::wrap(distance));
+    return ret;
+  }
+
+  static inline v8::Local<v8::Value> wrapMatches(const std::vector<cv::DMatch>& matches, bool packed) {
+    if (packed) {
+      return wrapPackedMatches(matches);
+    }
+    return DescriptorMatch::ArrayConverter::wrap(matches);
+  }
+
+  // knn and radius matches are flattened in packed mode, matches are ordered by query and rank
+  static inline v8::Local<v8::Value> wrapMatches(const std::vector<std::vector<cv::DMatch>>& matches, bool packed) {
+    if (!packed) {
+      return DescriptorMatch::ArrayOfArraysConverter::wrap(matches);
+    }
+    std::vector<cv::DMatch> flattened;
+    for (const std::vector<cv::DMatch>& queryMatches : matches) {
+      flattened.insert(flattened.end(), queryMatches.begin(), queryMatches.end());
+    }
+    return wrapPackedMatches(flattened);
+  }
+
+  static inline bool isPackedMatches(v8::Local<v8::Value> val) {
+    return val->IsObject() && !val->IsArray();
+  }
+
+  // unpacks packed matches, returns true and throws on error
+  static inline bool unwrapPackedMatches(std::vector<cv::DMatch>* matches, v8::Local<v8::Value> val) {
+    v8::Local<v8::Object> obj = val->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+    std::vector<int> queryIdx, trainIdx, imgIdx;
+    std::vector<float> distance;
+    if (
+      FF::Int32TypedArrayConverter::prop(&queryIdx, "queryIdx", obj) ||
+      FF::Int32TypedArrayConverter::prop(&trainIdx, "trainIdx", obj) ||
+      FF::Int32TypedArrayConverter::optProp(&imgIdx, "imgIdx", obj) ||
+      FF::Float32TypedArrayConverter::prop(&distance, "distance", obj)
+    ) {
+      return true;
+    }
+    if (trainIdx.size() != queryIdx.size() || distance.size() != queryIdx.size()
+      || (imgIdx.size() > 0 && imgIdx.size() != queryIdx.size())) {
+      Nan::ThrowError("expected packed matches to have the same number of entries for each field");
+      return true;
+    }
+    matches->resize(queryIdx.size());
+    for (size_t i = 0; i < queryIdx.size(); i++) {
+      matches->at(i) = cv::DMatch(queryIdx[i], trainIdx[i], imgIdx.size() > 0 ? imgIdx[i] : -1, distance[i]);
+    }
+    return false;
+  }
+
+  // accepts an array of DescriptorMatches or packed matches
+  static inline bool matchesArg(int argN, std::vector<cv::DMatch>* matches, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (isPackedMatches(info[argN])) {
+      return unwrapPackedMatches(matches, info[argN]);
+    }
+    return DescriptorMatch::ArrayConverter::arg(argN, matches, info);
+  }
+
+  // reads the packed flag from an options object passed at argN
+  static inline bool unwrapPackedOption(bool* packed, int argN, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (!FF::isArgObject(info, argN)) {
+      return false;
+    }
+    v8::Local<v8::Object> opts = info[argN]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+    return FF::BoolConverter::optProp(packed, "packed", opts);
+  }
+
+  // ratio >= 1 disables the ratio test and maxDistance < 0 disables the distance threshold
+  struct MatchFilter {
+    bool enabled = false;
+    double ratio = 1;
+    bool crossCheck = false;
+    double maxDistance = -1;
+  };
+
+  static inline bool unwrapMatchFilter(MatchFilter* filter, v8::Local<v8::Object> opts) {
+    filter->enabled = true;
+    return (
+      FF::DoubleConverter::optProp(&filter->ratio, "ratio", opts) ||
+      FF::BoolConverter::optProp(&filter->crossCheck, "crossCheck", opts) ||
+      FF::DoubleConverter::optProp(&filter->maxDistance, "maxDistance", opts)
+    );
+  }
+
+  // reads the filterMatches option from an options object passed at argN
+  static inline bool unwrapMatchFilterOption(MatchFilter* filter, int argN, Nan::NAN_METHOD_ARGS_TYPE info) {
+    if (!FF::isArgObject(info, argN)) {
+      return false;
+    }
+    v8::Local<v8::Object> opts = info[argN]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+    v8::Local<v8::String> key = Nan::New("filterMatches").ToLocalChecked();
+    if (!Nan::Has(opts, key).FromJust()) {
+      return false;
+    }
+    v8::Local<v8::Value> jsFilter = Nan::Get(opts, key).ToLocalChecked();
+    if (!jsFilter->IsObject()) {
+      Nan::ThrowError("expected filterMatches to be an object");
+      return true;
+    }
+    return unwrapMatchFilter(filter, jsFilter->ToObject(Nan::GetCurrentContext()).ToLocalChecked());
+  }
+
+  /* keeps the best match of each query descriptor if it passes the ratio test against the second best match,
+     the distance threshold and the cross-check, which requires the query descriptor to also be the best match
+     of its train descriptor, queries with a single candidate are not ratio tested */
+  static inline std::vector<cv::DMatch> filterMatches(cv::DescriptorMatcher& matcher, const cv::Mat& descFrom,
+    const cv::Mat& descTo, const std::vector<std::vector<cv::DMatch>>& matches, const MatchFilter& filter) {
+    std::vector<int> reverseBest;
+    if (filter.crossCheck) {
+      std::vector<cv::DMatch> reverseMatches;
+      matcher.match(descTo, descFrom, reverseMatches);
+      reverseBest = std::vector<int>(descTo.rows, -1);
+      for (const cv::DMatch& match : reverseMatches) {
+        reverseBest[match.queryIdx] = match.trainIdx;
+      }
+    }
+
+    std::vector<cv::DMatch> filtered;
+    for (const std::vector<cv::DMatch>& queryMatches : matches) {
+      if (queryMatches.empty()) {
+        continue;
+      }
+      const cv::DMatch& best = queryMatches[0];
+      if (filter.ratio < 1 && queryMatches.size() > 1 && best.distance >= filter.ratio * queryMatches[1].distance) {
+        continue;
+      }
+      if (filter.maxDistance >= 0 && best.distance > filter.maxDistance) {
+        continue;
+      }
+      if (filter.crossCheck && reverseBest[best.trainIdx] != best.queryIdx) {
+        continue;
+      }
+      filtered.push_back(best);
+    }
+    return filtered;
+  }
+
+  // match only yields the best match of each query descriptor, the ratio test requires knnMatch or radiusMatch
+  static inline std::vector<cv::DMatch> filterMatches(cv::DescriptorMatcher& matcher, const cv::Mat& descFrom,
+    const cv::Mat& descTo, const std::vector<cv::DMatch>& matches, const MatchFilter& filter) {
+    if (filter.ratio < 1) {
+      throw std::runtime_error("filterMatches.ratio is not supported by match, use knnMatch with k >= 2 for the ratio test");
+    }
+    std::vector<std::vector<cv::DMatch>> singleMatches;
+    for (const cv::DMatch& match : matches) {
+      singleMatches.push_back(std::vector<cv::DMatch>(1, match));
+    }
+    return filterMatches(matcher, descFrom, descTo, singleMatches, filter);
+  }
+
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/core.hpp>
+#include <opencv2/features2d.hpp>
+#include "CatchCvExceptionWorker.h"
+#include "Mat.h"
+#include "features2dUtils.h"
+#include "parallelUtils.h"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#ifndef __FF_HAMMINGKNN_H__
+#define __FF_HAMMINGKNN_H__
+
+// gcc and clang on x86 can compile a popcnt variant of the distance loop, which is selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FF_HAMMINGKNN_POPCNT_DISPATCH
+#endif
+
+/* brute force kNN for binary descriptors (ORB, AKAZE, BRISK), descriptors are repacked into zero padded
+   64 bit words, queries are scanned in blocks against cache sized tiles of train descriptors keeping a
+   sorted top k list per query, and query blocks are distributed over threads */
+namespace HammingKnn {
+
+  static const int queryBlockSize = 32;
+  static const int trainTileSize = 256;
+
+  struct Popcount64 {
+    int operator()(uint64_t x) const {
+#if defined(_MSC_VER) && defined(_M_X64)
+      return (int)__popcnt64(x);
+#elif defined(__GNUC__) || defined(__clang__)
+      return __builtin_popcountll(x);
+#else
+      x = x - ((x >> 1) & 0x5555555555555555ULL);
+      x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+      x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+      return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+  };
+
+  static inline std::vector<uint64_t> packWords(const cv::Mat& descriptors, int words) {
+    std::vector<uint64_t> packed((size_t)descriptors.rows * words, 0);
+    for (int r = 0; r < descriptors.rows; r++) {
+      memcpy(&packed[(size_t)r * words], descriptors.ptr<uchar>(r), descriptors.cols);
+    }
+    return packed;
+  }
+
+  template<typename Popcount>
+  static inline int distance(const uint64_t* a, const uint64_t* b, int words, Popcount popcount) {
+    // 256 bit descriptors are by far the most common case
+    if (words == 4) {
+      return popcount(a[0] ^ b[0]) + popcount(a[1] ^ b[1]) + popcount(a[2] ^ b[2]) + popcount(a[3] ^ b[3]);
+    }
+    int dist = 0;
+    for (int w = 0; w < words; w++) {
+      dist += popcount(a[w] ^ b[w]);
+    }
+    return dist;
+  }
+
+  // topDists and topIdxs hold k entries per query sorted by ascending distance
+  template<typename Popcount>
+  static inline void scanBlock(const uint64_t* query, const uint64_t* train, int words, int queryStart, int queryEnd,
+    int numTrain, int k, int* topDists, int* topIdxs, Popcount popcount) {
+    for (int tileStart = 0; tileStart < numTrain; tileStart += trainTileSize) {
+      int tileEnd = std::min(tileStart + trainTileSize, numTrain);
+      for (int q = queryStart; q < queryEnd; q++) {
+        const uint64_t* queryRow = query + (size_t)q * words;
+        int* dists = topDists + (size_t)(q - queryStart) * k;
+        int* idxs = topIdxs + (size_t)(q - queryStart) * k;
+        for (int t = tileStart; t < tileEnd; t++) {
+          int dist = distance(queryRow, train + (size_t)t * words, words, popcount);
+          if (dist >= dists[k - 1]) {
+            continue;
+          }
+          int pos = k - 1;
+          while (pos > 0 && dists[pos - 1] > dist) {
+            dists[pos] = dists[pos - 1];
+            idxs[pos] = idxs[pos - 1];
+            pos--;
+          }
+          dists[pos] = dist;
+          idxs[pos] = t;
+        }
+      }
+    }
+  }
+
+#ifdef FF_HAMMINGKNN_POPCNT_DISPATCH
+  // the builtin is only expanded to the popcnt instruction if it is inlined into this function, flatten
+  // inlines scanBlock, distance and Popcount64 here instead of leaving them to the inlining heuristics
+  __attribute__((target("popcnt"), flatten))
+  static void scanBlockPopcnt(const uint64_t* query, const uint64_t* train, int words, int queryStart, int queryEnd,
+    int numTrain, int k, int* topDists, int* topIdxs) {
+    scanBlock(query, train, words, queryStart, queryEnd, numTrain, k, topDists, topIdxs, Popcount64());
+  }
+#endif
+
+  // returns the first error of a block or ""
+  static inline std::string knnMatch(const cv::Mat& queryDescriptors, const cv::Mat& trainDescriptors,
+    std::vector<std::vector<cv::DMatch>>& matches, int k) {
+    int words = (queryDescriptors.cols + 7) / 8;
+    int numQuery = queryDescriptors.rows;
+    int numTrain = trainDescriptors.rows;
+    std::vector<uint64_t> query = packWords(queryDescriptors, words);
+    std::vector<uint64_t> train = packWords(trainDescriptors, words);
+#ifdef FF_HAMMINGKNN_POPCNT_DISPATCH
+    bool usePopcnt = cv::checkHardwareSupport(CV_CPU_POPCNT);
+#endif
+
+    matches.clear();
+    matches.resize(numQuery);
+    int numBlocks = (numQuery + queryBlockSize - 1) / queryBlockSize;
+    return ParallelUtils::forEachStripe(numBlocks, [&](int b) {
+      std::vector<int> topDists(queryBlockSize * k, std::numeric_limits<int>::max()), topIdxs(queryBlockSize * k, -1);
+      int queryStart = b * queryBlockSize;
+      int queryEnd = std::min(queryStart + queryBlockSize, numQuery);
+#ifdef FF_HAMMINGKNN_POPCNT_DISPATCH
+      if (usePopcnt) {
+        scanBlockPopcnt(query.data(), train.data(), words, queryStart, queryEnd, numTrain, k, topDists.data(), topIdxs.data());
+      }
+      else
+#endif
+      {
+        scanBlock(query.data(), train.data(), words, queryStart, queryEnd, numTrain, k, topDists.data(), topIdxs.data(), Popcount64());
+      }
+      for (int q = queryStart; q < queryEnd; q++) {
+        for (int j = 0; j < k; j++) {
+          int idx = topIdxs[(q - queryStart) * k + j];
+          if (idx >= 0) {
+            matches[q].push_back(cv::DMatch(q, idx, 0, (float)topDists[(q - queryStart) * k + j]));
+          }
+        }
+      }
+    });
+  }
+
+  struct MatchKnnWorker : public CatchCvExceptionWorker {
+  public:
+    cv::Mat descFrom;
+    cv::Mat descTo;
+    int k;
+    bool packed = false;
+    std::vector<std::vector<cv::DMatch>> dmatches;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (descFrom.type() != CV_8U || descTo.type() != CV_8U) {
+        return "expected binary descriptors of type CV_8U";
+      }
+      if (descFrom.cols != descTo.cols) {
+        return "expected descriptors to have the same number of cols";
+      }
+      if (k < 1) {
+        return "expected k to be at least 1";
+      }
+      return knnMatch(descFrom, descTo, dmatches, k);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &descFrom, info)
+        || Mat::Converter::arg(1, &descTo, info)
+        || FF::IntConverter::arg(2, &k, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Features2dUtils::unwrapPackedOption(&packed, 3, info);
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Features2dUtils::wrapMatches(dmatches, packed);
+    }
+  };
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include "ANN_MLP.h"
+
+Nan::Persistent<v8::FunctionTemplate> ANN_MLP::constructor;
+
+NAN_MODULE_INIT(ANN_MLP::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(ANN_MLP::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("ANN_MLP"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("layerSizes"), layerSizes_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("trainMethod"), trainMethod_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("termCriteria"), termCriteria_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("backpropWeightScale"), backpropWeightScale_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("backpropMomentumScale"), backpropMomentumScale_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("rpropDW0"), rpropDW0_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("rpropDWPlus"), rpropDWPlus_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("rpropDWMinus"), rpropDWMinus_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("rpropDWMin"), rpropDWMin_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("rpropDWMax"), rpropDWMax_getter);
+
+	Nan::Set(target, FF::newString("ANN_MLP"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(ANN_MLP::New) {
+	FF::TryCatch tryCatch("ANN_MLP::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+	ANN_MLP::NewWorker worker;
+
+	if (worker.applyUnwrappers(info)) {
+		return tryCatch.reThrow();
+	}
+	std::string err = worker.execute();
+	if (!err.empty()) {
+		return tryCatch.throwError(err);
+	}
+
+	ANN_MLP* self = new ANN_MLP();
+	self->self = worker.model;
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
@@ -0,0 +1,122 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "Mat.h"
+#include "TermCriteria.h"
+#include "StatModel.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_ANN_MLP_H__
+#define __FF_ANN_MLP_H__
+
+class ANN_MLP : public StatModel, public FF::ObjectWrapTemplate<ANN_MLP, cv::Ptr<cv::ml::ANN_MLP>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "ANN_MLP";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::ANN_MLP>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::ANN_MLP::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::ANN_MLP>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->isClassifier());
+	FF_GETTER_CUSTOM(layerSizes, Mat::Converter, self->getLayerSizes());
+	FF_GETTER_CUSTOM(trainMethod, FF::IntConverter, self->getTrainMethod());
+	FF_GETTER_CUSTOM(termCriteria, TermCriteria::Converter, self->getTermCriteria());
+	FF_GETTER_CUSTOM(backpropWeightScale, FF::DoubleConverter, self->getBackpropWeightScale());
+	FF_GETTER_CUSTOM(backpropMomentumScale, FF::DoubleConverter, self->getBackpropMomentumScale());
+	FF_GETTER_CUSTOM(rpropDW0, FF::DoubleConverter, self->getRpropDW0());
+	FF_GETTER_CUSTOM(rpropDWPlus, FF::DoubleConverter, self->getRpropDWPlus());
+	FF_GETTER_CUSTOM(rpropDWMinus, FF::DoubleConverter, self->getRpropDWMinus());
+	FF_GETTER_CUSTOM(rpropDWMin, FF::DoubleConverter, self->getRpropDWMin());
+	FF_GETTER_CUSTOM(rpropDWMax, FF::DoubleConverter, self->getRpropDWMax());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		cv::Ptr<cv::ml::ANN_MLP> model = cv::ml::ANN_MLP::create();
+		std::vector<int> layerSizes;
+		int activationFunction = cv::ml::ANN_MLP::SIGMOID_SYM;
+		// 0 selects the default params of the activation function
+		double activationParam1 = 0;
+		double activationParam2 = 0;
+		int trainMethod = model->getTrainMethod();
+		cv::TermCriteria termCriteria = model->getTermCriteria();
+		double backpropWeightScale = model->getBackpropWeightScale();
+		double backpropMomentumScale = model->getBackpropMomentumScale();
+		double rpropDW0 = model->getRpropDW0();
+		double rpropDWPlus = model->getRpropDWPlus();
+		double rpropDWMinus = model->getRpropDWMinus();
+		double rpropDWMin = model->getRpropDWMin();
+		double rpropDWMax = model->getRpropDWMax();
+
+		bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return (
+				FF::IntArrayConverter::optArg(0, &layerSizes, info) ||
+				FF::IntConverter::optArg(1, &activationFunction, info) ||
+				FF::IntConverter::optArg(2, &trainMethod, info)
+			);
+		}
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0) && !info[0]->IsArray();
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				FF::IntArrayConverter::optProp(&layerSizes, "layerSizes", opts) ||
+				FF::IntConverter::optProp(&activationFunction, "activationFunction", opts) ||
+				FF::DoubleConverter::optProp(&activationParam1, "activationParam1", opts) ||
+				FF::DoubleConverter::optProp(&activationParam2, "activationParam2", opts) ||
+				FF::IntConverter::optProp(&trainMethod, "trainMethod", opts) ||
+				TermCriteria::Converter::optProp(&termCriteria, "termCriteria", opts) ||
+				FF::DoubleConverter::optProp(&backpropWeightScale, "backpropWeightScale", opts) ||
+				FF::DoubleConverter::optProp(&backpropMomentumScale, "backpropMomentumScale", opts) ||
+				FF::DoubleConverter::optProp(&rpropDW0, "rpropDW0", opts) ||
+				FF::DoubleConverter::optProp(&rpropDWPlus, "rpropDWPlus", opts) ||
+				FF::DoubleConverter::optProp(&rpropDWMinus, "rpropDWMinus", opts) ||
+				FF::DoubleConverter::optProp(&rpropDWMin, "rpropDWMin", opts) ||
+				FF::DoubleConverter::optProp(&rpropDWMax, "rpropDWMax", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			if (layerSizes.size() > 0) {
+				model->setLayerSizes(layerSizes);
+			}
+			model->setActivationFunction(activationFunction, activationParam1, activationParam2);
+			// setTrainMethod overwrites the backprop and rprop params, which are applied afterwards
+			model->setTrainMethod(trainMethod);
+			model->setTermCriteria(termCriteria);
+			model->setBackpropWeightScale(backpropWeightScale);
+			model->setBackpropMomentumScale(backpropMomentumScale);
+			model->setRpropDW0(rpropDW0);
+			model->setRpropDWPlus(rpropDWPlus);
+			model->setRpropDWMinus(rpropDWMinus);
+			model->setRpropDWMin(rpropDWMin);
+			model->setRpropDWMax(rpropDWMax);
+			return "";
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,49 @@
+#include "Boost.h"
+
+Nan::Persistent<v8::FunctionTemplate> Boost::constructor;
+
+NAN_MODULE_INIT(Boost::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(Boost::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("Boost"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("maxCategories"), maxCategories_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("maxDepth"), maxDepth_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("minSampleCount"), minSampleCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("cvFolds"), cvFolds_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("useSurrogates"), useSurrogates_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("use1SERule"), use1SERule_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("truncatePrunedTree"), truncatePrunedTree_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("regressionAccuracy"), regressionAccuracy_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("boostType"), boostType_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("weakCount"), weakCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("weightTrimRate"), weightTrimRate_getter);
+
+	Nan::Set(target, FF::newString("Boost"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(Boost::New) {
+	FF::TryCatch tryCatch("Boost::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+	Boost::NewWorker worker;
+
+	if (worker.applyUnwrappers(info)) {
+		return tryCatch.reThrow();
+	}
+	std::string err = worker.execute();
+	if (!err.empty()) {
+		return tryCatch.throwError(err);
+	}
+
+	Boost* self = new Boost();
+	self->self = worker.model;
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
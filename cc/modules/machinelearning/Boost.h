@@ -0,0 +1,85 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "StatModel.h"
+#include "DTreesParams.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_BOOST_H__
+#define __FF_BOOST_H__
+
+class Boost : public StatModel, public FF::ObjectWrapTemplate<Boost, cv::Ptr<cv::ml::Boost>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "Boost";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::Boost>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::Boost::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::Boost>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->isClassifier());
+	FF_GETTER_CUSTOM(maxCategories, FF::IntConverter, self->getMaxCategories());
+	FF_GETTER_CUSTOM(maxDepth, FF::IntConverter, self->getMaxDepth());
+	FF_GETTER_CUSTOM(minSampleCount, FF::IntConverter, self->getMinSampleCount());
+	FF_GETTER_CUSTOM(cvFolds, FF::IntConverter, self->getCVFolds());
+	FF_GETTER_CUSTOM(useSurrogates, FF::BoolConverter, self->getUseSurrogates());
+	FF_GETTER_CUSTOM(use1SERule, FF::BoolConverter, self->getUse1SERule());
+	FF_GETTER_CUSTOM(truncatePrunedTree, FF::BoolConverter, self->getTruncatePrunedTree());
+	FF_GETTER_CUSTOM(regressionAccuracy, FF::FloatConverter, self->getRegressionAccuracy());
+	FF_GETTER_CUSTOM(boostType, FF::IntConverter, self->getBoostType());
+	FF_GETTER_CUSTOM(weakCount, FF::IntConverter, self->getWeakCount());
+	FF_GETTER_CUSTOM(weightTrimRate, FF::DoubleConverter, self->getWeightTrimRate());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		cv::Ptr<cv::ml::Boost> model = cv::ml::Boost::create();
+		DTreesParams params = DTreesParams(model);
+		int boostType = model->getBoostType();
+		int weakCount = model->getWeakCount();
+		double weightTrimRate = model->getWeightTrimRate();
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				params.unwrapFromOpts(opts) ||
+				FF::IntConverter::optProp(&boostType, "boostType", opts) ||
+				FF::IntConverter::optProp(&weakCount, "weakCount", opts) ||
+				FF::DoubleConverter::optProp(&weightTrimRate, "weightTrimRate", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			params.apply(model);
+			model->setBoostType(boostType);
+			model->setWeakCount(weakCount);
+			model->setWeightTrimRate(weightTrimRate);
+			return "";
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/ml.hpp>
+
+#ifndef __FF_DTREESPARAMS_H_
+#define __FF_DTREESPARAMS_H_
+
+// decision tree params shared by RTrees and Boost, defaults are read from the model
+struct DTreesParams {
+public:
+	int maxCategories;
+	int maxDepth;
+	int minSampleCount;
+	int cvFolds;
+	bool useSurrogates;
+	bool use1SERule;
+	bool truncatePrunedTree;
+	float regressionAccuracy;
+
+	DTreesParams(cv::Ptr<cv::ml::DTrees> model) {
+		maxCategories = model->getMaxCategories();
+		maxDepth = model->getMaxDepth();
+		minSampleCount = model->getMinSampleCount();
+		cvFolds = model->getCVFolds();
+		useSurrogates = model->getUseSurrogates();
+		use1SERule = model->getUse1SERule();
+		truncatePrunedTree = model->getTruncatePrunedTree();
+		regressionAccuracy = model->getRegressionAccuracy();
+	}
+
+	void apply(cv::Ptr<cv::ml::DTrees> model) {
+		model->setMaxCategories(maxCategories);
+		model->setMaxDepth(maxDepth);
+		model->setMinSampleCount(minSampleCount);
+		model->setCVFolds(cvFolds);
+		model->setUseSurrogates(useSurrogates);
+		model->setUse1SERule(use1SERule);
+		model->setTruncatePrunedTree(truncatePrunedTree);
+		model->setRegressionAccuracy(regressionAccuracy);
+	}
+
+	bool unwrapFromOpts(v8::Local<v8::Object> opts) {
+		return (
+			FF::IntConverter::optProp(&maxCategories, "maxCategories", opts) ||
+			FF::IntConverter::optProp(&maxDepth, "maxDepth", opts) ||
+			FF::IntConverter::optProp(&minSampleCount, "minSampleCount", opts) ||
+			FF::IntConverter::optProp(&cvFolds, "cvFolds", opts) ||
+			FF::BoolConverter::optProp(&useSurrogates, "useSurrogates", opts) ||
+			FF::BoolConverter::optProp(&use1SERule, "use1SERule", opts) ||
+			FF::BoolConverter::optProp(&truncatePrunedTree, "truncatePrunedTree", opts) ||
+			FF::FloatConverter::optProp(&regressionAccuracy, "regressionAccuracy", opts)
+		);
+	}
+};
+
+#endif
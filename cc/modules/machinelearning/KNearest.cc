@@ -0,0 +1,129 @@
+#include "KNearest.h"
+#include "StatModelBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> KNearest::constructor;
+
+NAN_MODULE_INIT(KNearest::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(KNearest::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("KNearest"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("defaultK"), defaultK_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("emax"), emax_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("algorithmType"), algorithmType_getter);
+
+	Nan::SetPrototypeMethod(ctor, "findNearest", FindNearest);
+	Nan::SetPrototypeMethod(ctor, "findNearestAsync", FindNearestAsync);
+
+	Nan::Set(target, FF::newString("KNearest"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(KNearest::New) {
+	FF::TryCatch tryCatch("KNearest::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+	KNearest::NewWorker worker;
+
+	if (worker.applyUnwrappers(info)) {
+		return tryCatch.reThrow();
+	}
+	std::string err = worker.execute();
+	if (!err.empty()) {
+		return tryCatch.throwError(err);
+	}
+
+	KNearest* self = new KNearest();
+	self->self = worker.model;
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
+
+// the sample rows are split into chunks which are searched in parallel
+struct FindNearestWorker : public CatchCvExceptionWorker {
+public:
+	cv::Ptr<cv::ml::KNearest> knn;
+
+	FindNearestWorker(cv::Ptr<cv::ml::KNearest> knn) {
+		this->knn = knn;
+	}
+
+	cv::Mat samples;
+	int k;
+	int chunkSize = 0;
+
+	cv::Mat results;
+	cv::Mat neighborResponses;
+	cv::Mat dists;
+
+	std::string executeCatchCvExceptionWorker() {
+		if (k < 1) {
+			return "expected k to be at least 1";
+		}
+		if (samples.rows == 0) {
+			results = cv::Mat(0, 1, CV_32F);
+			neighborResponses = cv::Mat(0, k, CV_32F);
+			dists = cv::Mat(0, k, CV_32F);
+			return "";
+		}
+		cv::Mat floatSamples = StatModelBindings::toFloatSamples(samples);
+		std::vector<cv::Range> chunks = StatModelBindings::getRowChunks(floatSamples.rows, chunkSize);
+		std::vector<cv::Mat> chunkResults(chunks.size()), chunkResponses(chunks.size()), chunkDists(chunks.size());
+		StatModelBindings::forEachRowChunk(chunks, [&](int c, const cv::Range& rows) {
+			knn->findNearest(floatSamples.rowRange(rows), k, chunkResults[c], chunkResponses[c], chunkDists[c]);
+		});
+		cv::vconcat(chunkResults, results);
+		cv::vconcat(chunkResponses, neighborResponses);
+		cv::vconcat(chunkDists, dists);
+		return "";
+	}
+
+	v8::Local<v8::Value> getReturnValue() {
+		v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+		Nan::Set(ret, FF::newString("results"), Mat::Converter::wrap(results));
+		Nan::Set(ret, FF::newString("neighborResponses"), Mat::Converter::wrap(neighborResponses));
+		Nan::Set(ret, FF::newString("dists"), Mat::Converter::wrap(dists));
+		return ret;
+	}
+
+	bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return (
+			Mat::Converter::arg(0, &samples, info) ||
+			FF::IntConverter::arg(1, &k, info)
+		);
+	}
+
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::IntConverter::optArg(2, &chunkSize, info);
+	}
+
+	bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::isArgObject(info, 2);
+	}
+
+	bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+		v8::Local<v8::Object> opts = info[2]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+		return FF::IntConverter::optProp(&chunkSize, "chunkSize", opts);
+	}
+};
+
+NAN_METHOD(KNearest::FindNearest) {
+	FF::SyncBindingBase(
+		std::make_shared<FindNearestWorker>(KNearest::unwrapSelf(info)),
+		"KNearest::FindNearest",
+		info
+	);
+}
+
+NAN_METHOD(KNearest::FindNearestAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<FindNearestWorker>(KNearest::unwrapSelf(info)),
+		"KNearest::FindNearestAsync",
+		info
+	);
+}
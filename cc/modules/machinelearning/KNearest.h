@@ -0,0 +1,85 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "StatModel.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_KNEAREST_H__
+#define __FF_KNEAREST_H__
+
+class KNearest : public StatModel, public FF::ObjectWrapTemplate<KNearest, cv::Ptr<cv::ml::KNearest>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "KNearest";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::KNearest>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::KNearest::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::KNearest>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->getIsClassifier());
+	FF_GETTER_CUSTOM(defaultK, FF::IntConverter, self->getDefaultK());
+	FF_GETTER_CUSTOM(emax, FF::IntConverter, self->getEmax());
+	FF_GETTER_CUSTOM(algorithmType, FF::IntConverter, self->getAlgorithmType());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+	static NAN_METHOD(FindNearest);
+	static NAN_METHOD(FindNearestAsync);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		cv::Ptr<cv::ml::KNearest> model = cv::ml::KNearest::create();
+		int defaultK = model->getDefaultK();
+		bool isClassifier = model->getIsClassifier();
+		int emax = model->getEmax();
+		int algorithmType = model->getAlgorithmType();
+
+		bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return (
+				FF::IntConverter::optArg(0, &defaultK, info) ||
+				FF::BoolConverter::optArg(1, &isClassifier, info)
+			);
+		}
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				FF::IntConverter::optProp(&defaultK, "defaultK", opts) ||
+				FF::BoolConverter::optProp(&isClassifier, "isClassifier", opts) ||
+				FF::IntConverter::optProp(&emax, "emax", opts) ||
+				FF::IntConverter::optProp(&algorithmType, "algorithmType", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			model->setDefaultK(defaultK);
+			model->setIsClassifier(isClassifier);
+			model->setEmax(emax);
+			model->setAlgorithmType(algorithmType);
+			return "";
+		}
+	};
+};
+
+#endif
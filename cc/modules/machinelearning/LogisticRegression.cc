@@ -0,0 +1,45 @@
+#include "LogisticRegression.h"
+
+Nan::Persistent<v8::FunctionTemplate> LogisticRegression::constructor;
+
+NAN_MODULE_INIT(LogisticRegression::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(LogisticRegression::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("LogisticRegression"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("learningRate"), learningRate_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("iterations"), iterations_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("regularization"), regularization_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("trainMethod"), trainMethod_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("miniBatchSize"), miniBatchSize_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("termCriteria"), termCriteria_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("learntThetas"), learntThetas_getter);
+
+	Nan::Set(target, FF::newString("LogisticRegression"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(LogisticRegression::New) {
+	FF::TryCatch tryCatch("LogisticRegression::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+	LogisticRegression::NewWorker worker;
+
+	if (worker.applyUnwrappers(info)) {
+		return tryCatch.reThrow();
+	}
+	std::string err = worker.execute();
+	if (!err.empty()) {
+		return tryCatch.throwError(err);
+	}
+
+	LogisticRegression* self = new LogisticRegression();
+	self->self = worker.model;
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
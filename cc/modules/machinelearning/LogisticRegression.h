@@ -0,0 +1,88 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "Mat.h"
+#include "TermCriteria.h"
+#include "StatModel.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_LOGISTICREGRESSION_H__
+#define __FF_LOGISTICREGRESSION_H__
+
+class LogisticRegression : public StatModel, public FF::ObjectWrapTemplate<LogisticRegression, cv::Ptr<cv::ml::LogisticRegression>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "LogisticRegression";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::LogisticRegression>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::LogisticRegression::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::LogisticRegression>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->isClassifier());
+	FF_GETTER_CUSTOM(learningRate, FF::DoubleConverter, self->getLearningRate());
+	FF_GETTER_CUSTOM(iterations, FF::IntConverter, self->getIterations());
+	FF_GETTER_CUSTOM(regularization, FF::IntConverter, self->getRegularization());
+	FF_GETTER_CUSTOM(trainMethod, FF::IntConverter, self->getTrainMethod());
+	FF_GETTER_CUSTOM(miniBatchSize, FF::IntConverter, self->getMiniBatchSize());
+	FF_GETTER_CUSTOM(termCriteria, TermCriteria::Converter, self->getTermCriteria());
+	FF_GETTER_CUSTOM(learntThetas, Mat::Converter, self->get_learnt_thetas());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		cv::Ptr<cv::ml::LogisticRegression> model = cv::ml::LogisticRegression::create();
+		double learningRate = model->getLearningRate();
+		int iterations = model->getIterations();
+		int regularization = model->getRegularization();
+		int trainMethod = model->getTrainMethod();
+		int miniBatchSize = model->getMiniBatchSize();
+		cv::TermCriteria termCriteria = model->getTermCriteria();
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				FF::DoubleConverter::optProp(&learningRate, "learningRate", opts) ||
+				FF::IntConverter::optProp(&iterations, "iterations", opts) ||
+				FF::IntConverter::optProp(&regularization, "regularization", opts) ||
+				FF::IntConverter::optProp(&trainMethod, "trainMethod", opts) ||
+				FF::IntConverter::optProp(&miniBatchSize, "miniBatchSize", opts) ||
+				TermCriteria::Converter::optProp(&termCriteria, "termCriteria", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			model->setLearningRate(learningRate);
+			model->setIterations(iterations);
+			model->setRegularization(regularization);
+			model->setTrainMethod(trainMethod);
+			model->setMiniBatchSize(miniBatchSize);
+			model->setTermCriteria(termCriteria);
+			return "";
+		}
+	};
+};
+
+#endif
@@ -0,0 +1,108 @@
+#include "NormalBayesClassifier.h"
+#include "StatModelBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> NormalBayesClassifier::constructor;
+
+NAN_MODULE_INIT(NormalBayesClassifier::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(NormalBayesClassifier::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("NormalBayesClassifier"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+
+	Nan::SetPrototypeMethod(ctor, "predictProb", PredictProb);
+	Nan::SetPrototypeMethod(ctor, "predictProbAsync", PredictProbAsync);
+
+	Nan::Set(target, FF::newString("NormalBayesClassifier"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(NormalBayesClassifier::New) {
+	FF::TryCatch tryCatch("NormalBayesClassifier::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+
+	NormalBayesClassifier* self = new NormalBayesClassifier();
+	self->self = cv::ml::NormalBayesClassifier::create();
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
+
+// the sample rows are split into chunks which are predicted in parallel
+struct PredictProbWorker : public CatchCvExceptionWorker {
+public:
+	cv::Ptr<cv::ml::NormalBayesClassifier> classifier;
+
+	PredictProbWorker(cv::Ptr<cv::ml::NormalBayesClassifier> classifier) {
+		this->classifier = classifier;
+	}
+
+	cv::Mat samples;
+	int flags = 0;
+	int chunkSize = 0;
+
+	cv::Mat outputs;
+	cv::Mat outputProbs;
+
+	std::string executeCatchCvExceptionWorker() {
+		if (samples.rows == 0) {
+			return "expected at least one sample";
+		}
+		cv::Mat floatSamples = StatModelBindings::toFloatSamples(samples);
+		std::vector<cv::Range> chunks = StatModelBindings::getRowChunks(floatSamples.rows, chunkSize);
+		std::vector<cv::Mat> chunkOutputs(chunks.size()), chunkProbs(chunks.size());
+		StatModelBindings::forEachRowChunk(chunks, [&](int c, const cv::Range& rows) {
+			classifier->predictProb(floatSamples.rowRange(rows), chunkOutputs[c], chunkProbs[c], flags);
+		});
+		cv::vconcat(chunkOutputs, outputs);
+		cv::vconcat(chunkProbs, outputProbs);
+		return "";
+	}
+
+	v8::Local<v8::Value> getReturnValue() {
+		v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+		Nan::Set(ret, FF::newString("outputs"), Mat::Converter::wrap(outputs));
+		Nan::Set(ret, FF::newString("outputProbs"), Mat::Converter::wrap(outputProbs));
+		return ret;
+	}
+
+	bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Mat::Converter::arg(0, &samples, info);
+	}
+
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::IntConverter::optArg(1, &flags, info);
+	}
+
+	bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::isArgObject(info, 1);
+	}
+
+	bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+		v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+		return (
+			FF::IntConverter::optProp(&flags, "flags", opts) ||
+			FF::IntConverter::optProp(&chunkSize, "chunkSize", opts)
+		);
+	}
+};
+
+NAN_METHOD(NormalBayesClassifier::PredictProb) {
+	FF::SyncBindingBase(
+		std::make_shared<PredictProbWorker>(NormalBayesClassifier::unwrapSelf(info)),
+		"NormalBayesClassifier::PredictProb",
+		info
+	);
+}
+
+NAN_METHOD(NormalBayesClassifier::PredictProbAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<PredictProbWorker>(NormalBayesClassifier::unwrapSelf(info)),
+		"NormalBayesClassifier::PredictProbAsync",
+		info
+	);
+}
@@ -0,0 +1,43 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "StatModel.h"
+
+#ifndef __FF_NORMALBAYESCLASSIFIER_H__
+#define __FF_NORMALBAYESCLASSIFIER_H__
+
+class NormalBayesClassifier : public StatModel, public FF::ObjectWrapTemplate<NormalBayesClassifier, cv::Ptr<cv::ml::NormalBayesClassifier>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "NormalBayesClassifier";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::NormalBayesClassifier>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::NormalBayesClassifier::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::NormalBayesClassifier>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->isClassifier());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+	static NAN_METHOD(PredictProb);
+	static NAN_METHOD(PredictProbAsync);
+};
+
+#endif
@@ -0,0 +1,133 @@
+#include "RTrees.h"
+#include "StatModelBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> RTrees::constructor;
+
+NAN_MODULE_INIT(RTrees::Init) {
+	v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(RTrees::New);
+	v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+	StatModel::Init(ctor);
+	constructor.Reset(ctor);
+	ctor->SetClassName(FF::newString("RTrees"));
+	instanceTemplate->SetInternalFieldCount(1);
+
+	Nan::SetAccessor(instanceTemplate, FF::newString("varCount"), varCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isTrained"), isTrained_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("isClassifier"), isClassifier_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("maxCategories"), maxCategories_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("maxDepth"), maxDepth_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("minSampleCount"), minSampleCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("cvFolds"), cvFolds_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("useSurrogates"), useSurrogates_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("use1SERule"), use1SERule_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("truncatePrunedTree"), truncatePrunedTree_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("regressionAccuracy"), regressionAccuracy_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("calculateVarImportance"), calculateVarImportance_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("activeVarCount"), activeVarCount_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("termCriteria"), termCriteria_getter);
+	Nan::SetAccessor(instanceTemplate, FF::newString("varImportance"), varImportance_getter);
+
+	Nan::SetPrototypeMethod(ctor, "getVotes", GetVotes);
+	Nan::SetPrototypeMethod(ctor, "getVotesAsync", GetVotesAsync);
+
+	Nan::Set(target, FF::newString("RTrees"), FF::getFunction(ctor));
+};
+
+NAN_METHOD(RTrees::New) {
+	FF::TryCatch tryCatch("RTrees::New");
+	FF_ASSERT_CONSTRUCT_CALL();
+	RTrees::NewWorker worker;
+
+	if (worker.applyUnwrappers(info)) {
+		return tryCatch.reThrow();
+	}
+	std::string err = worker.execute();
+	if (!err.empty()) {
+		return tryCatch.throwError(err);
+	}
+
+	RTrees* self = new RTrees();
+	self->self = worker.model;
+	self->Wrap(info.Holder());
+	info.GetReturnValue().Set(info.Holder());
+}
+
+/* votes of the trees per class, the first row holds the class labels followed by one row per sample,
+   the sample rows are split into chunks which are evaluated in parallel */
+struct GetVotesWorker : public CatchCvExceptionWorker {
+public:
+	cv::Ptr<cv::ml::RTrees> rtrees;
+
+	GetVotesWorker(cv::Ptr<cv::ml::RTrees> rtrees) {
+		this->rtrees = rtrees;
+	}
+
+	cv::Mat samples;
+	int flags = 0;
+	int chunkSize = 0;
+
+	cv::Mat votes;
+
+	std::string executeCatchCvExceptionWorker() {
+#if CV_VERSION_MINOR < 2
+		return "getVotes not implemented for v3.0, v3.1";
+#else
+		if (samples.rows == 0) {
+			return "expected at least one sample";
+		}
+		cv::Mat floatSamples = StatModelBindings::toFloatSamples(samples);
+		std::vector<cv::Range> chunks = StatModelBindings::getRowChunks(floatSamples.rows, chunkSize);
+		std::vector<cv::Mat> chunkVotes(chunks.size());
+		StatModelBindings::forEachRowChunk(chunks, [&](int c, const cv::Range& rows) {
+			rtrees->getVotes(floatSamples.rowRange(rows), chunkVotes[c], flags);
+		});
+		// each chunk starts with the row of class labels, which is kept only once
+		for (size_t c = 1; c < chunkVotes.size(); c++) {
+			chunkVotes[c] = chunkVotes[c].rowRange(1, chunkVotes[c].rows);
+		}
+		cv::vconcat(chunkVotes, votes);
+		return "";
+#endif
+	}
+
+	v8::Local<v8::Value> getReturnValue() {
+		return Mat::Converter::wrap(votes);
+	}
+
+	bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return Mat::Converter::arg(0, &samples, info);
+	}
+
+	bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::IntConverter::optArg(1, &flags, info);
+	}
+
+	bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+		return FF::isArgObject(info, 1);
+	}
+
+	bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+		v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+		return (
+			FF::IntConverter::optProp(&flags, "flags", opts) ||
+			FF::IntConverter::optProp(&chunkSize, "chunkSize", opts)
+		);
+	}
+};
+
+NAN_METHOD(RTrees::GetVotes) {
+	FF::SyncBindingBase(
+		std::make_shared<GetVotesWorker>(RTrees::unwrapSelf(info)),
+		"RTrees::GetVotes",
+		info
+	);
+}
+
+NAN_METHOD(RTrees::GetVotesAsync) {
+	FF::AsyncBindingBase(
+		std::make_shared<GetVotesWorker>(RTrees::unwrapSelf(info)),
+		"RTrees::GetVotesAsync",
+		info
+	);
+}
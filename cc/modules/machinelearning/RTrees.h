@@ -0,0 +1,90 @@
+#include "NativeNodeUtils.h"
+#include "macros.h"
+#include <opencv2/ml.hpp>
+#include "Mat.h"
+#include "TermCriteria.h"
+#include "StatModel.h"
+#include "DTreesParams.h"
+#include "CatchCvExceptionWorker.h"
+
+#ifndef __FF_RTREES_H__
+#define __FF_RTREES_H__
+
+class RTrees : public StatModel, public FF::ObjectWrapTemplate<RTrees, cv::Ptr<cv::ml::RTrees>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "RTrees";
+	}
+
+	cv::Ptr<cv::ml::StatModel> getStatModel() {
+		return self;
+	}
+
+	void load(std::string path) {
+		self = StatModel::loadModel<cv::ml::RTrees>(path);
+	}
+
+	cv::Ptr<cv::ml::StatModel> createStatModel() {
+		return cv::ml::RTrees::create();
+	}
+
+	void setStatModel(cv::Ptr<cv::ml::StatModel> model) {
+		self = model.dynamicCast<cv::ml::RTrees>();
+	}
+
+	FF_GETTER_CUSTOM(varCount, FF::IntConverter, self->getVarCount());
+	FF_GETTER_CUSTOM(isTrained, FF::BoolConverter, self->isTrained());
+	FF_GETTER_CUSTOM(isClassifier, FF::BoolConverter, self->isClassifier());
+	FF_GETTER_CUSTOM(maxCategories, FF::IntConverter, self->getMaxCategories());
+	FF_GETTER_CUSTOM(maxDepth, FF::IntConverter, self->getMaxDepth());
+	FF_GETTER_CUSTOM(minSampleCount, FF::IntConverter, self->getMinSampleCount());
+	FF_GETTER_CUSTOM(cvFolds, FF::IntConverter, self->getCVFolds());
+	FF_GETTER_CUSTOM(useSurrogates, FF::BoolConverter, self->getUseSurrogates());
+	FF_GETTER_CUSTOM(use1SERule, FF::BoolConverter, self->getUse1SERule());
+	FF_GETTER_CUSTOM(truncatePrunedTree, FF::BoolConverter, self->getTruncatePrunedTree());
+	FF_GETTER_CUSTOM(regressionAccuracy, FF::FloatConverter, self->getRegressionAccuracy());
+	FF_GETTER_CUSTOM(calculateVarImportance, FF::BoolConverter, self->getCalculateVarImportance());
+	FF_GETTER_CUSTOM(activeVarCount, FF::IntConverter, self->getActiveVarCount());
+	FF_GETTER_CUSTOM(termCriteria, TermCriteria::Converter, self->getTermCriteria());
+	FF_GETTER_CUSTOM(varImportance, Mat::Converter, self->getVarImportance());
+
+	static NAN_MODULE_INIT(Init);
+	static NAN_METHOD(New);
+	static NAN_METHOD(GetVotes);
+	static NAN_METHOD(GetVotesAsync);
+
+	struct NewWorker : CatchCvExceptionWorker {
+	public:
+		cv::Ptr<cv::ml::RTrees> model = cv::ml::RTrees::create();
+		DTreesParams params = DTreesParams(model);
+		bool calculateVarImportance = model->getCalculateVarImportance();
+		int activeVarCount = model->getActiveVarCount();
+		cv::TermCriteria termCriteria = model->getTermCriteria();
+
+		bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+			return FF::isArgObject(info, 0);
+		}
+
+		bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+			v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+			return (
+				params.unwrapFromOpts(opts) ||
+				FF::BoolConverter::optProp(&calculateVarImportance, "calculateVarImportance", opts) ||
+				FF::IntConverter::optProp(&activeVarCount, "activeVarCount", opts) ||
+				TermCriteria::Converter::optProp(&termCriteria, "termCriteria", opts)
+			);
+		}
+
+		std::string executeCatchCvExceptionWorker() {
+			params.apply(model);
+			model->setCalculateVarImportance(calculateVarImportance);
+			model->setActiveVarCount(activeVarCount);
+			model->setTermCriteria(termCriteria);
+			return "";
+		}
+	};
+};
+
+#endif
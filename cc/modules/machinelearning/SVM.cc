@@ -1,5 +1,7 @@
 #include "SVM.h"
 #include "SVMBindings.h"
+#include "StatModelBindings.h"
+#include "AlgorithmBufferBindings.h"
 
 Nan::Persistent<v8::FunctionTemplate> SVM::constructor;
 
@@ -23,16 +25,25 @@ NAN_MODULE_INIT(SVM::Init) {
   Nan::SetPrototypeMethod(ctor, "setParams", SetParams);
   Nan::SetPrototypeMethod(ctor, "train", Train);
   Nan::SetPrototypeMethod(ctor, "trainAuto", TrainAuto);
+  Nan::SetPrototypeMethod(ctor, "trainAutoParallel", TrainAutoParallel);
   Nan::SetPrototypeMethod(ctor, "predict", Predict);
+  Nan::SetPrototypeMethod(ctor, "predictBatch", PredictBatch);
   Nan::SetPrototypeMethod(ctor, "getSupportVectors", GetSupportVectors);
   Nan::SetPrototypeMethod(ctor, "getUncompressedSupportVectors", GetUncompressedSupportVectors);
   Nan::SetPrototypeMethod(ctor, "getDecisionFunction", GetDecisionFunction);
   Nan::SetPrototypeMethod(ctor, "calcError", CalcError);
   Nan::SetPrototypeMethod(ctor, "save", Save);
   Nan::SetPrototypeMethod(ctor, "load", Load);
+  Nan::SetPrototypeMethod(ctor, "saveToBuffer", SaveToBuffer);
+  Nan::SetPrototypeMethod(ctor, "loadFromBuffer", LoadFromBuffer);
 
   Nan::SetPrototypeMethod(ctor, "trainAsync", TrainAsync);
   Nan::SetPrototypeMethod(ctor, "trainAutoAsync", TrainAutoAsync);
+  Nan::SetPrototypeMethod(ctor, "trainAutoParallelAsync", TrainAutoParallelAsync);
+  Nan::SetPrototypeMethod(ctor, "predictAsync", PredictAsync);
+  Nan::SetPrototypeMethod(ctor, "predictBatchAsync", PredictBatchAsync);
+  Nan::SetPrototypeMethod(ctor, "saveToBufferAsync", SaveToBufferAsync);
+  Nan::SetPrototypeMethod(ctor, "loadFromBufferAsync", LoadFromBufferAsync);
 
   Nan::Set(target,Nan::New("SVM").ToLocalChecked(), FF::getFunction(ctor));
 };
@@ -104,46 +115,35 @@ NAN_METHOD(SVM::SetParams) {
 };
 
 NAN_METHOD(SVM::Predict) {
-	FF::TryCatch tryCatch("SVM::Predict");
+  FF::SyncBindingBase(
+    std::make_shared<StatModelBindings::PredictWorker>(SVM::unwrapSelf(info)),
+    "SVM::Predict",
+    info
+  );
+}
 
-  if (!info[0]->IsArray() && !Mat::hasInstance(info[0])) {
-	  return tryCatch.throwError("expected arg 0 to be an ARRAY or an instance of Mat");
-  }
+NAN_METHOD(SVM::PredictAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<StatModelBindings::PredictWorker>(SVM::unwrapSelf(info)),
+    "SVM::PredictAsync",
+    info
+  );
+}
 
-  cv::Mat results;
-  if (info[0]->IsArray()) {
-	std::vector<float> samples;
-	unsigned int flags = 0;
-	if (
-		FF::FloatArrayConverter::arg(0, &samples, info) ||
-		FF::UintConverter::optArg(1, &flags, info)
-	) {
-		return tryCatch.reThrow();
-	}
-    SVM::unwrapSelf(info)->predict(samples, results, (int)flags);
-  }
-  else {
-	cv::Mat samples;
-	unsigned int flags = 0;
-	if (
-		Mat::Converter::arg(0, &samples, info) ||
-		FF::UintConverter::optArg(1, &flags, info)
-		) {
-		return tryCatch.reThrow();
-	}
-	SVM::unwrapSelf(info)->predict(samples, results, (int)flags);
-  }
+NAN_METHOD(SVM::PredictBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<StatModelBindings::PredictBatchWorker>(SVM::unwrapSelf(info)),
+    "SVM::PredictBatch",
+    info
+  );
+}
 
-  v8::Local<v8::Value> jsResult;
-  if (results.cols == 1 && results.rows == 1) {
-    jsResult = Nan::New((double)results.at<float>(0, 0));
-  }
-  else {
-    std::vector<float> resultsVec;
-    results.col(0).copyTo(resultsVec);
-    jsResult = FF::FloatArrayConverter::wrap(resultsVec);
-  }
-  info.GetReturnValue().Set(jsResult);
+NAN_METHOD(SVM::PredictBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<StatModelBindings::PredictBatchWorker>(SVM::unwrapSelf(info)),
+    "SVM::PredictBatchAsync",
+    info
+  );
 }
 
 NAN_METHOD(SVM::GetSupportVectors) {
@@ -225,6 +225,47 @@ NAN_METHOD(SVM::Load) {
 #endif
 }
 
+NAN_METHOD(SVM::SaveToBuffer) {
+  FF::SyncBindingBase(
+    std::make_shared<AlgorithmBufferBindings::SaveToBufferWorker>(SVM::unwrapSelf(info)),
+    "SVM::SaveToBuffer",
+    info
+  );
+}
+
+NAN_METHOD(SVM::SaveToBufferAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<AlgorithmBufferBindings::SaveToBufferWorker>(SVM::unwrapSelf(info)),
+    "SVM::SaveToBufferAsync",
+    info
+  );
+}
+
+static std::shared_ptr<AlgorithmBufferBindings::LoadFromBufferWorker<cv::ml::SVM>> newLoadFromBufferWorker(Nan::NAN_METHOD_ARGS_TYPE info) {
+  SVM* self = SVM::unwrapThis(info);
+  return std::make_shared<AlgorithmBufferBindings::LoadFromBufferWorker<cv::ml::SVM>>(
+    info.This(),
+    cv::ml::SVM::create(),
+    [self](cv::Ptr<cv::ml::SVM> svm) { self->setNativeObject(svm); }
+  );
+}
+
+NAN_METHOD(SVM::LoadFromBuffer) {
+  FF::SyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "SVM::LoadFromBuffer",
+    info
+  );
+}
+
+NAN_METHOD(SVM::LoadFromBufferAsync) {
+  FF::AsyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "SVM::LoadFromBufferAsync",
+    info
+  );
+}
+
 NAN_METHOD(SVM::Train) {
   bool isTrainFromTrainData = TrainData::hasInstance(info[0]);
   if (isTrainFromTrainData) {
@@ -276,3 +317,36 @@ NAN_METHOD(SVM::TrainAutoAsync) {
     info
   );
 }
+
+NAN_METHOD(SVM::TrainAutoParallel) {
+  FF::TryCatch tryCatch("SVM::TrainAutoParallel");
+  std::shared_ptr<SVMBindings::TrainAutoParallelWorker> worker = std::make_shared<SVMBindings::TrainAutoParallelWorker>(SVM::unwrapSelf(info));
+  if (worker->applyUnwrappers(info)) {
+    return tryCatch.reThrow();
+  }
+  if (worker->onProgress) {
+    return tryCatch.throwError("onProgress is only supported by trainAutoParallelAsync");
+  }
+  std::string err = worker->execute();
+  if (!err.empty()) {
+    return tryCatch.throwError(err);
+  }
+  info.GetReturnValue().Set(worker->getReturnValue());
+}
+
+NAN_METHOD(SVM::TrainAutoParallelAsync) {
+  FF::TryCatch tryCatch("SVM::TrainAutoParallelAsync");
+  if (info.Length() < 1 || !info[info.Length() - 1]->IsFunction()) {
+    return tryCatch.throwError("expected last arg to be a callback function");
+  }
+  v8::Local<v8::Function> cbFunc = v8::Local<v8::Function>::Cast(info[info.Length() - 1]);
+  std::shared_ptr<SVMBindings::TrainAutoParallelWorker> worker = std::make_shared<SVMBindings::TrainAutoParallelWorker>(SVM::unwrapSelf(info));
+  if (worker->applyUnwrappers(info)) {
+    return tryCatch.reThrow();
+  }
+  Nan::AsyncQueueWorker(new SVMBindings::TrainAutoParallelAsyncWorker(
+    new Nan::Callback(cbFunc),
+    worker,
+    "SVM::TrainAutoParallelAsync"
+  ));
+}
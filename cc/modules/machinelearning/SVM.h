@@ -37,16 +37,25 @@ public:
 	static NAN_METHOD(New);
 	static NAN_METHOD(SetParams);
 	static NAN_METHOD(Predict);
+	static NAN_METHOD(PredictAsync);
+	static NAN_METHOD(PredictBatch);
+	static NAN_METHOD(PredictBatchAsync);
 	static NAN_METHOD(GetSupportVectors);
 	static NAN_METHOD(GetUncompressedSupportVectors);
 	static NAN_METHOD(GetDecisionFunction);
 	static NAN_METHOD(CalcError);
 	static NAN_METHOD(Save);
 	static NAN_METHOD(Load);
+	static NAN_METHOD(SaveToBuffer);
+	static NAN_METHOD(SaveToBufferAsync);
+	static NAN_METHOD(LoadFromBuffer);
+	static NAN_METHOD(LoadFromBufferAsync);
 	static NAN_METHOD(Train);
 	static NAN_METHOD(TrainAsync);
 	static NAN_METHOD(TrainAuto);
 	static NAN_METHOD(TrainAutoAsync);
+	static NAN_METHOD(TrainAutoParallel);
+	static NAN_METHOD(TrainAutoParallelAsync);
 };
 
 #endif
\ No newline at end of file
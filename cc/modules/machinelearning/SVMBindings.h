@@ -1,4 +1,6 @@
 #include "SVM.h"
+#include "SVMGridSearch.h"
+#include <future>
 
 #ifndef __FF_SVMBINDINGS_H_
 #define __FF_SVMBINDINGS_H_
@@ -134,6 +136,159 @@ namespace SVMBindings {
   };
   
 
+  /* cross validated grid search as TrainAutoWorker, but the grid points are evaluated in parallel, the
+     async binding reports the progress to onProgress, returning false from onProgress cancels the search */
+  struct TrainAutoParallelWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::SVM> svm;
+
+    TrainAutoParallelWorker(cv::Ptr<cv::ml::SVM> svm) {
+      this->svm = svm;
+    }
+
+    cv::Ptr<cv::ml::TrainData> trainData;
+    SVMGridSearch search;
+    std::shared_ptr<Nan::Callback> onProgress;
+
+    std::string executeCatchCvExceptionWorker() {
+      search.svm = svm;
+      search.trainData = trainData;
+      return search.run();
+    }
+
+    static v8::Local<v8::Object> wrapParams(const SVMGridPoint& params) {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, FF::newString("c"), Nan::New(params.c));
+      Nan::Set(ret, FF::newString("gamma"), Nan::New(params.gamma));
+      Nan::Set(ret, FF::newString("p"), Nan::New(params.p));
+      Nan::Set(ret, FF::newString("nu"), Nan::New(params.nu));
+      Nan::Set(ret, FF::newString("coef0"), Nan::New(params.coef0));
+      Nan::Set(ret, FF::newString("degree"), Nan::New(params.degree));
+      return ret;
+    }
+
+    // params and errors are omitted as long as no grid point has been evaluated
+    static v8::Local<v8::Object> wrapProgress(const SVMGridSearchProgress& progress) {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, FF::newString("numEvaluated"), Nan::New(progress.numEvaluated));
+      Nan::Set(ret, FF::newString("numGridPoints"), Nan::New(progress.numGridPoints));
+      if (progress.numEvaluated == 0) {
+        return ret;
+      }
+      Nan::Set(ret, FF::newString("params"), wrapParams(progress.params));
+      Nan::Set(ret, FF::newString("error"), Nan::New(progress.error));
+      Nan::Set(ret, FF::newString("bestParams"), wrapParams(progress.bestParams));
+      Nan::Set(ret, FF::newString("bestError"), Nan::New(progress.bestError));
+      return ret;
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      if (search.numEvaluated > 0) {
+        ret = wrapParams(search.bestParams);
+        Nan::Set(ret, FF::newString("error"), Nan::New(search.bestError));
+      }
+      Nan::Set(ret, FF::newString("numEvaluated"), Nan::New(search.numEvaluated));
+      Nan::Set(ret, FF::newString("numGridPoints"), Nan::New(search.numGridPoints));
+      Nan::Set(ret, FF::newString("cancelled"), Nan::New(search.cancelled));
+      Nan::Set(ret, FF::newString("earlyStopped"), Nan::New(search.earlyStopped));
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return TrainData::Converter::arg(0, &trainData, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      if (
+        FF::IntConverter::optProp(&search.kFold, "kFold", opts) ||
+        ParamGrid::Converter::optProp(&search.cGrid, "cGrid", opts) ||
+        ParamGrid::Converter::optProp(&search.gammaGrid, "gammaGrid", opts) ||
+        ParamGrid::Converter::optProp(&search.pGrid, "pGrid", opts) ||
+        ParamGrid::Converter::optProp(&search.nuGrid, "nuGrid", opts) ||
+        ParamGrid::Converter::optProp(&search.coeffGrid, "coeffGrid", opts) ||
+        ParamGrid::Converter::optProp(&search.degreeGrid, "degreeGrid", opts) ||
+        FF::BoolConverter::optProp(&search.balanced, "balanced", opts) ||
+        FF::DoubleConverter::optProp(&search.targetError, "targetError", opts)
+      ) {
+        return true;
+      }
+      v8::Local<v8::Value> jsOnProgress = Nan::Get(opts, FF::newString("onProgress")).ToLocalChecked();
+      if (jsOnProgress->IsUndefined()) {
+        return false;
+      }
+      if (!jsOnProgress->IsFunction()) {
+        Nan::ThrowError("expected onProgress to be a function");
+        return true;
+      }
+      onProgress = std::make_shared<Nan::Callback>(v8::Local<v8::Function>::Cast(jsOnProgress));
+      return false;
+    }
+  };
+
+  /* runs TrainAutoParallelWorker on the thread pool, the grid search sends its progress from the threads
+     evaluating the grid points, onProgress is invoked on the main thread. The search waits for the start
+     progress to be handled, such that returning false from it cancels the search before it starts */
+  class TrainAutoParallelAsyncWorker : public Nan::AsyncProgressQueueWorker<SVMGridSearchProgress> {
+  public:
+    std::shared_ptr<TrainAutoParallelWorker> worker;
+    std::string methodName;
+    std::promise<void> startHandled;
+
+    TrainAutoParallelAsyncWorker(Nan::Callback* callback, std::shared_ptr<TrainAutoParallelWorker> worker, std::string methodName)
+      : Nan::AsyncProgressQueueWorker<SVMGridSearchProgress>(callback, "opencv4nodejs:SVM::TrainAutoParallelAsync") {
+      this->worker = worker;
+      this->methodName = methodName;
+    }
+
+    void Execute(const ExecutionProgress& progress) {
+      if (worker->onProgress) {
+        std::future<void> started = startHandled.get_future();
+        worker->search.onProgress = [&progress, &started](const SVMGridSearchProgress& p) {
+          progress.Send(&p, 1);
+          if (p.numEvaluated == 0) {
+            started.wait();
+          }
+        };
+      }
+      std::string err = worker->execute();
+      if (!err.empty()) {
+        SetErrorMessage(err.c_str());
+      }
+    }
+
+    void HandleProgressCallback(const SVMGridSearchProgress* data, size_t count) {
+      Nan::HandleScope scope;
+      for (size_t i = 0; i < count; i++) {
+        v8::Local<v8::Value> argv[] = { TrainAutoParallelWorker::wrapProgress(data[i]) };
+        Nan::MaybeLocal<v8::Value> ret = worker->onProgress->Call(1, argv, async_resource);
+        if (!ret.IsEmpty() && ret.ToLocalChecked()->IsFalse()) {
+          worker->search.cancel = true;
+        }
+        if (data[i].numEvaluated == 0) {
+          startHandled.set_value();
+        }
+      }
+    }
+
+    void HandleOKCallback() {
+      Nan::HandleScope scope;
+      v8::Local<v8::Value> argv[] = { Nan::Null(), worker->getReturnValue() };
+      callback->Call(2, argv, async_resource);
+    }
+
+    void HandleErrorCallback() {
+      Nan::HandleScope scope;
+      v8::Local<v8::Value> argv[] = { Nan::Error((methodName + " - " + ErrorMessage()).c_str()), Nan::Null() };
+      callback->Call(2, argv, async_resource);
+    }
+  };
+
 }
 
 #endif
\ No newline at end of file
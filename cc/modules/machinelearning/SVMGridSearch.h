@@ -0,0 +1,286 @@
+#include <opencv2/core.hpp>
+#include <opencv2/ml.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include "parallelUtils.h"
+
+#ifndef __FF_SVMGRIDSEARCH_H__
+#define __FF_SVMGRIDSEARCH_H__
+
+struct SVMGridPoint {
+	double c;
+	double gamma;
+	double p;
+	double nu;
+	double coef0;
+	double degree;
+};
+
+struct SVMGridSearchProgress {
+	int numEvaluated;
+	int numGridPoints;
+	SVMGridPoint params;
+	double error;
+	// bestParams and bestError are only meaningful if numEvaluated is positive
+	SVMGridPoint bestParams = SVMGridPoint();
+	double bestError;
+};
+
+/* k-fold cross validated grid search over the SVM params, as SVM::trainAuto, but the grid points are
+   evaluated concurrently. Each grid point trains its own SVM instances on folds that are split once up
+   front. The search stops early once the best error reaches targetError or if cancel is set, after
+   which grid points that have not been started are skipped. onProgress is called once with numEvaluated
+   0 before the first grid point is evaluated, such that the search can be cancelled before it starts. */
+class SVMGridSearch {
+public:
+	cv::Ptr<cv::ml::SVM> svm;
+	cv::Ptr<cv::ml::TrainData> trainData;
+	int kFold = 10;
+	cv::ml::ParamGrid cGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::C);
+	cv::ml::ParamGrid gammaGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::GAMMA);
+	cv::ml::ParamGrid pGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::P);
+	cv::ml::ParamGrid nuGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::NU);
+	cv::ml::ParamGrid coeffGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::COEF);
+	cv::ml::ParamGrid degreeGrid = cv::ml::SVM::getDefaultGrid(cv::ml::SVM::DEGREE);
+	bool balanced = false;
+	// a negative target error disables early termination
+	double targetError = -1;
+
+	std::atomic<bool> cancel;
+	// called from the threads evaluating the grid points, calls are serialized
+	std::function<void(const SVMGridSearchProgress&)> onProgress;
+
+	SVMGridPoint bestParams;
+	double bestError = std::numeric_limits<double>::max();
+	int numEvaluated = 0;
+	int numGridPoints = 0;
+	bool earlyStopped = false;
+	bool cancelled = false;
+
+	SVMGridSearch() : cancel(false) {}
+
+	// returns an error message, the svm is trained with the best params unless the search was cancelled
+	std::string run() {
+		std::string err = prepare();
+		if (!err.empty()) {
+			return err;
+		}
+
+		std::mutex mutex;
+		std::atomic<bool> stop(false);
+		numGridPoints = (int)gridPoints.size();
+		if (onProgress) {
+			SVMGridSearchProgress progress = { 0, numGridPoints, SVMGridPoint(), 0, bestParams, bestError };
+			onProgress(progress);
+		}
+		std::string evalError = ParallelUtils::forEachStripe(numGridPoints, [&](int i) {
+			if (stop || cancel) {
+				return;
+			}
+			double error;
+			try {
+				error = evaluate(gridPoints[i], stop);
+			}
+			catch (std::exception&) {
+				// the remaining grid points are skipped once a grid point failed
+				stop = true;
+				throw;
+			}
+			if (error < 0) {
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			numEvaluated++;
+			// ties are resolved by grid order, such that the result does not depend on the scheduling
+			if (error < bestError || (error == bestError && i < bestIdx)) {
+				bestError = error;
+				bestIdx = i;
+				bestParams = gridPoints[i];
+			}
+			if (targetError >= 0 && bestError <= targetError) {
+				earlyStopped = true;
+				stop = true;
+			}
+			if (onProgress) {
+				SVMGridSearchProgress progress = { numEvaluated, numGridPoints, gridPoints[i], error, bestParams, bestError };
+				onProgress(progress);
+			}
+		});
+
+		if (!evalError.empty()) {
+			return evalError;
+		}
+		cancelled = cancel && !earlyStopped && numEvaluated < numGridPoints;
+		if (cancelled) {
+			return "";
+		}
+		setParams(svm, bestParams);
+		svm->train(trainData);
+		return "";
+	}
+
+private:
+	std::vector<SVMGridPoint> gridPoints;
+	int bestIdx = -1;
+	bool isClassification = false;
+	std::vector<cv::Mat> foldTrainSamples, foldTrainResponses, foldTestSamples, foldTestResponses;
+
+	static std::vector<double> gridValues(const cv::ml::ParamGrid& grid, double currentValue, bool isUsed) {
+		std::vector<double> values;
+		if (!isUsed) {
+			values.push_back(currentValue);
+			return values;
+		}
+		values.push_back(grid.minVal);
+		if (grid.logStep <= 1) {
+			return values;
+		}
+		for (double val = grid.minVal * grid.logStep; val < grid.maxVal; val *= grid.logStep) {
+			values.push_back(val);
+		}
+		return values;
+	}
+
+	void setParams(cv::Ptr<cv::ml::SVM> model, const SVMGridPoint& point) {
+		model->setC(point.c);
+		model->setGamma(point.gamma);
+		model->setP(point.p);
+		model->setNu(point.nu);
+		model->setCoef0(point.coef0);
+		model->setDegree(point.degree);
+	}
+
+	std::string prepare() {
+		int svmType = svm->getType();
+		int kernelType = svm->getKernelType();
+		if (svmType == cv::ml::SVM::ONE_CLASS) {
+			return "ONE_CLASS svms can not be cross validated";
+		}
+		if (kernelType == cv::ml::SVM::CUSTOM) {
+			return "svms with a custom kernel can not be cross validated";
+		}
+		const cv::ml::ParamGrid* grids[] = { &cGrid, &gammaGrid, &pGrid, &nuGrid, &coeffGrid, &degreeGrid };
+		for (const cv::ml::ParamGrid* grid : grids) {
+			if (grid->minVal > grid->maxVal || (grid->logStep > 1 && grid->minVal <= 0)) {
+				return "expected each grid to have 0 < minVal <= maxVal";
+			}
+		}
+		isClassification = svmType == cv::ml::SVM::C_SVC || svmType == cv::ml::SVM::NU_SVC;
+
+		cv::Mat samples = trainData->getTrainSamples(cv::ml::ROW_SAMPLE);
+		cv::Mat responses = trainData->getTrainResponses();
+		if (responses.cols != 1) {
+			responses = responses.reshape(1, samples.rows);
+		}
+		if (kFold < 2) {
+			return "expected kFold to be at least 2";
+		}
+		if (samples.rows < kFold) {
+			return "expected at least kFold samples";
+		}
+		responses.convertTo(responses, CV_32F);
+		splitFolds(samples, responses);
+
+		// as SVM::trainAuto, params which do not apply to the svm and kernel type are not searched
+		bool usesC = svmType == cv::ml::SVM::C_SVC || svmType == cv::ml::SVM::EPS_SVR || svmType == cv::ml::SVM::NU_SVR;
+		bool usesGamma = kernelType == cv::ml::SVM::POLY || kernelType == cv::ml::SVM::RBF
+			|| kernelType == cv::ml::SVM::SIGMOID || kernelType == cv::ml::SVM::CHI2;
+		bool usesP = svmType == cv::ml::SVM::EPS_SVR;
+		bool usesNu = svmType == cv::ml::SVM::NU_SVC || svmType == cv::ml::SVM::NU_SVR;
+		bool usesCoef0 = kernelType == cv::ml::SVM::POLY || kernelType == cv::ml::SVM::SIGMOID;
+		bool usesDegree = kernelType == cv::ml::SVM::POLY;
+		for (double c : gridValues(cGrid, svm->getC(), usesC)) {
+			for (double gamma : gridValues(gammaGrid, svm->getGamma(), usesGamma)) {
+				for (double p : gridValues(pGrid, svm->getP(), usesP)) {
+					for (double nu : gridValues(nuGrid, svm->getNu(), usesNu)) {
+						for (double coef0 : gridValues(coeffGrid, svm->getCoef0(), usesCoef0)) {
+							for (double degree : gridValues(degreeGrid, svm->getDegree(), usesDegree)) {
+								SVMGridPoint point = { c, gamma, p, nu, coef0, degree };
+								gridPoints.push_back(point);
+							}
+						}
+					}
+				}
+			}
+		}
+		return "";
+	}
+
+	// samples are shuffled with a fixed seed, balanced folds distribute the samples of each class evenly
+	void splitFolds(const cv::Mat& samples, const cv::Mat& responses) {
+		int numSamples = samples.rows;
+		std::vector<int> order(numSamples);
+		for (int i = 0; i < numSamples; i++) {
+			order[i] = i;
+		}
+		cv::RNG rng(0x12345678);
+		for (int i = numSamples - 1; i > 0; i--) {
+			std::swap(order[i], order[rng.uniform(0, i + 1)]);
+		}
+		if (balanced && isClassification) {
+			std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+				return responses.at<float>(a) < responses.at<float>(b);
+			});
+		}
+		std::vector<int> fold(numSamples);
+		for (int i = 0; i < numSamples; i++) {
+			fold[order[i]] = i % kFold;
+		}
+
+		foldTrainSamples.resize(kFold);
+		foldTrainResponses.resize(kFold);
+		foldTestSamples.resize(kFold);
+		foldTestResponses.resize(kFold);
+		for (int k = 0; k < kFold; k++) {
+			for (int i = 0; i < numSamples; i++) {
+				if (fold[i] == k) {
+					foldTestSamples[k].push_back(samples.row(i));
+					foldTestResponses[k].push_back(responses.row(i));
+				}
+				else {
+					foldTrainSamples[k].push_back(samples.row(i));
+					foldTrainResponses[k].push_back(responses.row(i));
+				}
+			}
+		}
+	}
+
+	// mean error over all folds, classification error rate or mean squared error, -1 if stopped
+	double evaluate(const SVMGridPoint& point, const std::atomic<bool>& stop) {
+		double error = 0;
+		int numTested = 0;
+		for (int k = 0; k < kFold; k++) {
+			if (stop || cancel) {
+				return -1;
+			}
+			cv::Ptr<cv::ml::SVM> model = cv::ml::SVM::create();
+			model->setType(svm->getType());
+			model->setKernel(svm->getKernelType());
+			model->setClassWeights(svm->getClassWeights());
+			model->setTermCriteria(svm->getTermCriteria());
+			setParams(model, point);
+			cv::Mat trainResponses = foldTrainResponses[k];
+			if (isClassification) {
+				foldTrainResponses[k].convertTo(trainResponses, CV_32S);
+			}
+			model->train(foldTrainSamples[k], cv::ml::ROW_SAMPLE, trainResponses);
+
+			cv::Mat predictions;
+			model->predict(foldTestSamples[k], predictions);
+			for (int i = 0; i < predictions.rows; i++) {
+				double diff = predictions.at<float>(i) - foldTestResponses[k].at<float>(i);
+				error += isClassification ? (std::abs(diff) > FLT_EPSILON ? 1 : 0) : diff * diff;
+			}
+			numTested += predictions.rows;
+		}
+		return numTested > 0 ? error / numTested : 0;
+	}
+};
+
+#endif
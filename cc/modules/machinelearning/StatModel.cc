@@ -1,5 +1,7 @@
 #include "StatModel.h"
-#include "Mat.h"
+#include "StatModelBindings.h"
+#include "TrainData.h"
+#include "AlgorithmBufferBindings.h"
 
 Nan::Persistent<v8::FunctionTemplate> StatModel::constructor;
 
@@ -12,11 +14,179 @@ NAN_MODULE_INIT(StatModel::Init) {
 	Nan::Set(target,Nan::New("StatModel").ToLocalChecked(), FF::getFunction(ctor));
 };
 
+void StatModel::Init(v8::Local<v8::FunctionTemplate> ctor) {
+  Nan::SetPrototypeMethod(ctor, "train", Train);
+  Nan::SetPrototypeMethod(ctor, "predict", Predict);
+  Nan::SetPrototypeMethod(ctor, "predictBatch", PredictBatch);
+  Nan::SetPrototypeMethod(ctor, "calcError", CalcError);
+  Nan::SetPrototypeMethod(ctor, "save", Save);
+  Nan::SetPrototypeMethod(ctor, "load", Load);
+  Nan::SetPrototypeMethod(ctor, "saveToBuffer", SaveToBuffer);
+  Nan::SetPrototypeMethod(ctor, "loadFromBuffer", LoadFromBuffer);
+
+  Nan::SetPrototypeMethod(ctor, "trainAsync", TrainAsync);
+  Nan::SetPrototypeMethod(ctor, "predictAsync", PredictAsync);
+  Nan::SetPrototypeMethod(ctor, "predictBatchAsync", PredictBatchAsync);
+  Nan::SetPrototypeMethod(ctor, "calcErrorAsync", CalcErrorAsync);
+  Nan::SetPrototypeMethod(ctor, "saveToBufferAsync", SaveToBufferAsync);
+  Nan::SetPrototypeMethod(ctor, "loadFromBufferAsync", LoadFromBufferAsync);
+};
+
 NAN_METHOD(StatModel::New) {
 	FF::TryCatch tryCatch("StatModel::New");
 	FF_ASSERT_CONSTRUCT_CALL();
-	StatModel* self = new StatModel();
-
-	self->Wrap(info.Holder());
-	info.GetReturnValue().Set(info.Holder());
+	return tryCatch.throwError("StatModel is an abstract class, construct one of the derived models instead");
 };
+
+NAN_METHOD(StatModel::Train) {
+  if (TrainData::hasInstance(info[0])) {
+    FF::SyncBindingBase(
+      std::make_shared<StatModelBindings::TrainFromTrainDataWorker>(StatModel::unwrapThis(info)->getStatModel()),
+      "StatModel::Train",
+      info
+    );
+  }
+  else {
+    FF::SyncBindingBase(
+      std::make_shared<StatModelBindings::TrainFromMatWorker>(StatModel::unwrapThis(info)->getStatModel()),
+      "StatModel::Train",
+      info
+    );
+  }
+}
+
+NAN_METHOD(StatModel::TrainAsync) {
+  if (TrainData::hasInstance(info[0])) {
+    FF::AsyncBindingBase(
+      std::make_shared<StatModelBindings::TrainFromTrainDataWorker>(StatModel::unwrapThis(info)->getStatModel()),
+      "StatModel::TrainAsync",
+      info
+    );
+  }
+  else {
+    FF::AsyncBindingBase(
+      std::make_shared<StatModelBindings::TrainFromMatWorker>(StatModel::unwrapThis(info)->getStatModel()),
+      "StatModel::TrainAsync",
+      info
+    );
+  }
+}
+
+NAN_METHOD(StatModel::Predict) {
+  FF::SyncBindingBase(
+    std::make_shared<StatModelBindings::PredictWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::Predict",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::PredictAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<StatModelBindings::PredictWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::PredictAsync",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::PredictBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<StatModelBindings::PredictBatchWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::PredictBatch",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::PredictBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<StatModelBindings::PredictBatchWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::PredictBatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::CalcError) {
+  FF::SyncBindingBase(
+    std::make_shared<StatModelBindings::CalcErrorWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::CalcError",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::CalcErrorAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<StatModelBindings::CalcErrorWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::CalcErrorAsync",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::Save) {
+	FF::TryCatch tryCatch("StatModel::Save");
+
+	std::string path;
+	if (FF::StringConverter::arg(0, &path, info)) {
+		return tryCatch.reThrow();
+	}
+	try {
+		StatModel::unwrapThis(info)->getStatModel()->save(path);
+	}
+	catch (std::exception &e) {
+		return tryCatch.throwError(e.what());
+	}
+}
+
+NAN_METHOD(StatModel::Load) {
+	FF::TryCatch tryCatch("StatModel::Load");
+
+	std::string path;
+	if (FF::StringConverter::arg(0, &path, info)) {
+		return tryCatch.reThrow();
+	}
+	try {
+		StatModel::unwrapThis(info)->load(path);
+	}
+	catch (std::exception &e) {
+		return tryCatch.throwError(e.what());
+	}
+}
+
+NAN_METHOD(StatModel::SaveToBuffer) {
+  FF::SyncBindingBase(
+    std::make_shared<AlgorithmBufferBindings::SaveToBufferWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::SaveToBuffer",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::SaveToBufferAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<AlgorithmBufferBindings::SaveToBufferWorker>(StatModel::unwrapThis(info)->getStatModel()),
+    "StatModel::SaveToBufferAsync",
+    info
+  );
+}
+
+static std::shared_ptr<AlgorithmBufferBindings::LoadFromBufferWorker<cv::ml::StatModel>> newLoadFromBufferWorker(Nan::NAN_METHOD_ARGS_TYPE info) {
+  StatModel* self = StatModel::unwrapThis(info);
+  return std::make_shared<AlgorithmBufferBindings::LoadFromBufferWorker<cv::ml::StatModel>>(
+    info.This(),
+    self->createStatModel(),
+    [self](cv::Ptr<cv::ml::StatModel> model) { self->setStatModel(model); }
+  );
+}
+
+NAN_METHOD(StatModel::LoadFromBuffer) {
+  FF::SyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "StatModel::LoadFromBuffer",
+    info
+  );
+}
+
+NAN_METHOD(StatModel::LoadFromBufferAsync) {
+  FF::AsyncBindingBase(
+    newLoadFromBufferWorker(info),
+    "StatModel::LoadFromBufferAsync",
+    info
+  );
+}
@@ -1,17 +1,49 @@
+#include "NativeNodeUtils.h"
 #include "macros.h"
 #include <opencv2/ml.hpp>
 
 #ifndef __FF_STATMODEL_H__
 #define __FF_STATMODEL_H__
 
-class StatModel: public Nan::ObjectWrap {
+// base of the ml models, provides train, predict, calcError, save and load for all derived models
+class StatModel : public FF::ObjectWrapBase<StatModel>, public Nan::ObjectWrap {
 public:
-	cv::Ptr<cv::ml::SVM> svm;
+	virtual cv::Ptr<cv::ml::StatModel> getStatModel() = 0;
+	virtual void load(std::string path) = 0;
+	// empty model of the derived type, which loadFromBuffer reads into
+	virtual cv::Ptr<cv::ml::StatModel> createStatModel() = 0;
+	virtual void setStatModel(cv::Ptr<cv::ml::StatModel> model) = 0;
 
 	static NAN_MODULE_INIT(Init);
+	static void Init(v8::Local<v8::FunctionTemplate>);
 	static NAN_METHOD(New);
 
-  static Nan::Persistent<v8::FunctionTemplate> constructor;
+	static NAN_METHOD(Train);
+	static NAN_METHOD(TrainAsync);
+	static NAN_METHOD(Predict);
+	static NAN_METHOD(PredictAsync);
+	static NAN_METHOD(PredictBatch);
+	static NAN_METHOD(PredictBatchAsync);
+	static NAN_METHOD(CalcError);
+	static NAN_METHOD(CalcErrorAsync);
+	static NAN_METHOD(Save);
+	static NAN_METHOD(Load);
+	static NAN_METHOD(SaveToBuffer);
+	static NAN_METHOD(SaveToBufferAsync);
+	static NAN_METHOD(LoadFromBuffer);
+	static NAN_METHOD(LoadFromBufferAsync);
+
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	// loads a model of type TModel, throws if the file does not contain a trained model of that type
+	template<class TModel>
+	static cv::Ptr<TModel> loadModel(std::string path) {
+		cv::Ptr<TModel> model = cv::Algorithm::load<TModel>(path);
+		if (model.empty()) {
+			throw std::runtime_error("failed to load model from " + path);
+		}
+		return model;
+	}
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,273 @@
+#include "NativeNodeUtils.h"
+#include <opencv2/ml.hpp>
+#include "Mat.h"
+#include "TrainData.h"
+#include "CatchCvExceptionWorker.h"
+#include "typedArrayUtils.h"
+#include "parallelUtils.h"
+#include <stdexcept>
+
+#ifndef __FF_STATMODELBINDINGS_H_
+#define __FF_STATMODELBINDINGS_H_
+
+// workers shared by the ml models, predict is const and may run concurrently on one model
+namespace StatModelBindings {
+
+  // splits rows into chunks of chunkSize rows, one chunk per thread if chunkSize is not positive
+  static inline std::vector<cv::Range> getRowChunks(int rows, int chunkSize) {
+    int numThreads = std::max(cv::getNumThreads(), 1);
+    int rowsPerChunk = std::max(chunkSize > 0 ? chunkSize : (rows + numThreads - 1) / numThreads, 1);
+    std::vector<cv::Range> chunks;
+    for (int start = 0; start < rows; start += rowsPerChunk) {
+      chunks.push_back(cv::Range(start, std::min(start + rowsPerChunk, rows)));
+    }
+    return chunks;
+  }
+
+  /* calls func(chunkIdx, rowRange) for each chunk in parallel, func is first called for the first row of
+     chunk 0 on the calling thread, such that invalid input fails fast before the chunks are started, its
+     output is overwritten by chunk 0. The first error of a chunk is rethrown */
+  template<class ChunkFunc>
+  static inline void forEachRowChunk(const std::vector<cv::Range>& chunks, ChunkFunc func) {
+    if (chunks.size() == 0) {
+      return;
+    }
+    func(0, cv::Range(chunks[0].start, chunks[0].start + 1));
+    std::string err = ParallelUtils::forEachStripe((int)chunks.size(), [&](int c) {
+      func(c, chunks[c]);
+    });
+    if (!err.empty()) {
+      throw std::runtime_error(err);
+    }
+  }
+
+  static inline cv::Mat toFloatSamples(const cv::Mat& samples) {
+    if (samples.depth() == CV_32F) {
+      return samples;
+    }
+    cv::Mat floatSamples;
+    samples.convertTo(floatSamples, CV_32F);
+    return floatSamples;
+  }
+
+  struct TrainFromTrainDataWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::StatModel> model;
+
+    TrainFromTrainDataWorker(cv::Ptr<cv::ml::StatModel> model) {
+      this->model = model;
+    }
+
+    cv::Ptr<cv::ml::TrainData> trainData;
+    uint flags = 0;
+
+    bool ret;
+
+    std::string executeCatchCvExceptionWorker() {
+      ret = model->train(trainData, (int)flags);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Nan::New(ret);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return TrainData::Converter::arg(0, &trainData, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::UintConverter::optArg(1, &flags, info);
+    }
+  };
+
+  struct TrainFromMatWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::StatModel> model;
+
+    TrainFromMatWorker(cv::Ptr<cv::ml::StatModel> model) {
+      this->model = model;
+    }
+
+    cv::Mat samples;
+    uint layout;
+    cv::Mat responses;
+
+    bool ret;
+
+    std::string executeCatchCvExceptionWorker() {
+      ret = model->train(samples, (int)layout, responses);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Nan::New(ret);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::Converter::arg(0, &samples, info) ||
+        FF::UintConverter::arg(1, &layout, info) ||
+        Mat::Converter::arg(2, &responses, info)
+      );
+    }
+  };
+
+  struct CalcErrorWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::StatModel> model;
+
+    CalcErrorWorker(cv::Ptr<cv::ml::StatModel> model) {
+      this->model = model;
+    }
+
+    cv::Ptr<cv::ml::TrainData> trainData;
+    bool test;
+
+    float error;
+    cv::Mat responses;
+
+    std::string executeCatchCvExceptionWorker() {
+      error = model->calcError(trainData, test, responses);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, FF::newString("error"), Nan::New((double)error));
+      Nan::Set(ret, FF::newString("responses"), Mat::Converter::wrap(responses));
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        TrainData::Converter::arg(0, &trainData, info) ||
+        FF::BoolConverter::arg(1, &test, info)
+      );
+    }
+  };
+
+  struct PredictWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::StatModel> model;
+
+    PredictWorker(cv::Ptr<cv::ml::StatModel> model) {
+      this->model = model;
+    }
+
+    // a number array is predicted as a single sample
+    cv::Mat samples;
+    uint flags = 0;
+
+    cv::Mat results;
+
+    std::string executeCatchCvExceptionWorker() {
+      model->predict(samples, results, (int)flags);
+      // some models, e.g. LogisticRegression, predict integer labels
+      if (results.depth() != CV_32F) {
+        results.convertTo(results, CV_32F);
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      if (results.cols == 1 && results.rows == 1) {
+        return Nan::New((double)results.at<float>(0, 0));
+      }
+      std::vector<float> resultsVec;
+      results.col(0).copyTo(resultsVec);
+      return FF::FloatArrayConverter::wrap(resultsVec);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!FF::hasArg(info, 0) || (!info[0]->IsArray() && !Mat::hasInstance(info[0]))) {
+        Nan::ThrowError("expected arg 0 to be an ARRAY or an instance of Mat");
+        return true;
+      }
+      if (info[0]->IsArray()) {
+        std::vector<float> sample;
+        if (FF::FloatArrayConverter::arg(0, &sample, info)) {
+          return true;
+        }
+        samples = cv::Mat(sample, true).reshape(1, 1);
+        return false;
+      }
+      return Mat::Converter::arg(0, &samples, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::UintConverter::optArg(1, &flags, info);
+    }
+  };
+
+  /* splits the sample rows into one chunk per thread and predicts the chunks in parallel, the results
+     are returned as a Float32Array in row major order or as a CV_32F Mat with one row per sample */
+  struct PredictBatchWorker : CatchCvExceptionWorker {
+  public:
+    cv::Ptr<cv::ml::StatModel> model;
+
+    PredictBatchWorker(cv::Ptr<cv::ml::StatModel> model) {
+      this->model = model;
+    }
+
+    cv::Mat samples;
+    uint flags = 0;
+    bool rawOutput = false;
+    bool returnMat = false;
+    int chunkSize = 0;
+
+    cv::Mat results;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (samples.rows == 0) {
+        results = cv::Mat(0, 1, CV_32F);
+        return "";
+      }
+      cv::Mat floatSamples = toFloatSamples(samples);
+      int flagsWithOutput = (int)flags | (rawOutput ? cv::ml::StatModel::RAW_OUTPUT : 0);
+      std::vector<cv::Range> chunks = getRowChunks(floatSamples.rows, chunkSize);
+      std::vector<cv::Mat> chunkResults(chunks.size());
+      forEachRowChunk(chunks, [&](int c, const cv::Range& rows) {
+        model->predict(floatSamples.rowRange(rows), chunkResults[c], flagsWithOutput);
+      });
+      cv::vconcat(chunkResults, results);
+      if (results.depth() != CV_32F) {
+        results.convertTo(results, CV_32F);
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      if (returnMat) {
+        return Mat::Converter::wrap(results);
+      }
+      cv::Mat continuous = results.isContinuous() ? results : results.clone();
+      return FF::Float32TypedArrayConverter::wrap(continuous.empty() ? NULL : continuous.ptr<float>(0), continuous.total());
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::Converter::arg(0, &samples, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::UintConverter::optArg(1, &flags, info);
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::UintConverter::optProp(&flags, "flags", opts) ||
+        FF::BoolConverter::optProp(&rawOutput, "rawOutput", opts) ||
+        FF::BoolConverter::optProp(&returnMat, "returnMat", opts) ||
+        FF::IntConverter::optProp(&chunkSize, "chunkSize", opts)
+      );
+    }
+  };
+
+}
+
+#endif
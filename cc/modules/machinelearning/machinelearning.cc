@@ -3,10 +3,22 @@
 #include "ParamGrid.h"
 #include "StatModel.h"
 #include "SVM.h"
+#include "RTrees.h"
+#include "Boost.h"
+#include "KNearest.h"
+#include "LogisticRegression.h"
+#include "NormalBayesClassifier.h"
+#include "ANN_MLP.h"
 
 NAN_MODULE_INIT(MachineLearning::Init) {
 	TrainData::Init(target);
 	ParamGrid::Init(target);
 	StatModel::Init(target);
 	SVM::Init(target);
+	RTrees::Init(target);
+	Boost::Init(target);
+	KNearest::Init(target);
+	LogisticRegression::Init(target);
+	NormalBayesClassifier::Init(target);
+	ANN_MLP::Init(target);
 };
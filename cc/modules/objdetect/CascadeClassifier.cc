@@ -11,6 +11,8 @@ NAN_MODULE_INIT(CascadeClassifier::Init) {
   ctor->SetClassName(FF::newString("CascadeClassifier"));
   instanceTemplate->SetInternalFieldCount(1);
 
+  Nan::SetAccessor(instanceTemplate, FF::newString("numClassifiers"), numClassifiers_getter);
+
   Nan::SetPrototypeMethod(ctor, "detectMultiScale", DetectMultiScale);
   Nan::SetPrototypeMethod(ctor, "detectMultiScaleAsync", DetectMultiScaleAsync);
   Nan::SetPrototypeMethod(ctor, "detectMultiScaleGpu", DetectMultiScaleGpu);
@@ -30,11 +32,15 @@ NAN_METHOD(CascadeClassifier::New) {
 		return tryCatch.reThrow();
 	}
 
-	CascadeClassifier* self = new CascadeClassifier();
-	self->setNativeObject(cv::CascadeClassifier(worker.xmlFilePath));
-	if (worker.applyUnwrappers(info)) {
-		return tryCatch.throwError(std::string("failed to load cascade.xml file: " + worker.xmlFilePath));
+	std::shared_ptr<CascadeClassifierPool> pool;
+	try {
+		pool = std::make_shared<CascadeClassifierPool>(worker.xmlFilePath);
+	} catch (std::exception &e) {
+		return tryCatch.throwError(e.what());
 	}
+
+	CascadeClassifier* self = new CascadeClassifier();
+	self->setNativeObject(pool);
 	self->Wrap(info.Holder());
 	info.GetReturnValue().Set(info.Holder());
 }
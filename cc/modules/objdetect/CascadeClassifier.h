@@ -5,11 +5,12 @@
 #include "Mat.h"
 #include "Rect.h"
 #include "CatchCvExceptionWorker.h"
+#include "CascadeClassifierPool.h"
 
 #ifndef __FF_CASCADECLASSIFIER_H__
 #define __FF_CASCADECLASSIFIER_H__
 
-class CascadeClassifier : public FF::ObjectWrap<CascadeClassifier, cv::CascadeClassifier> {
+class CascadeClassifier : public FF::ObjectWrap<CascadeClassifier, std::shared_ptr<CascadeClassifierPool>> {
 public:
 	static Nan::Persistent<v8::FunctionTemplate> constructor;
 
@@ -17,6 +18,8 @@ public:
 		return "CascadeClassifier";
 	}
 
+	FF_GETTER_CUSTOM(numClassifiers, FF::IntConverter, self->getNumClassifiers());
+
 	static NAN_MODULE_INIT(Init);
 
 	static NAN_METHOD(New);
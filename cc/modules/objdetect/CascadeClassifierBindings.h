@@ -20,11 +20,11 @@ namespace CascadeClassifierBindings {
 
   struct DetectMultiScaleWorker : CatchCvExceptionWorker {
   public:
-    cv::CascadeClassifier classifier;
+    std::shared_ptr<CascadeClassifierPool> pool;
     bool isGpu;
   
-    DetectMultiScaleWorker(cv::CascadeClassifier classifier, bool isGpu = false) {
-      this->classifier = classifier;
+    DetectMultiScaleWorker(std::shared_ptr<CascadeClassifierPool> pool, bool isGpu = false) {
+      this->pool = pool;
       this->isGpu = isGpu;
     }
   
@@ -37,8 +37,19 @@ namespace CascadeClassifierBindings {
   
     std::vector<cv::Rect> objectRects;
     std::vector<int> numDetections;
+    int numScales = 0;
+    double timeMs = 0;
   
     std::string executeCatchCvExceptionWorker() {
+      int64 start = cv::getTickCount();
+      CascadeClassifierPool::Lease lease(pool);
+      detect(lease.get());
+      timeMs = 1000 * (double)(cv::getTickCount() - start) / cv::getTickFrequency();
+      numScales = pool->getNumScales(img.size(), scaleFactor, minSize, maxSize);
+      return "";
+    }
+
+    virtual void detect(cv::CascadeClassifier& classifier) {
       if (isGpu) {
         cv::UMat oclMat = img.getUMat(cv::ACCESS_READ);
         classifier.detectMultiScale(oclMat, objectRects, scaleFactor, (int)minNeighbors, (int)flags, minSize, maxSize);
@@ -46,7 +57,11 @@ namespace CascadeClassifierBindings {
       else {
         classifier.detectMultiScale(img, objectRects, numDetections, scaleFactor, (int)minNeighbors, (int)flags, minSize, maxSize);
       }
-      return "";
+    }
+
+    void setStats(v8::Local<v8::Object> ret) {
+      Nan::Set(ret, FF::newString("numScales"), FF::IntConverter::wrap(numScales));
+      Nan::Set(ret, FF::newString("timeMs"), FF::DoubleConverter::wrap(timeMs));
     }
   
     v8::Local<v8::Value> getReturnValue() {
@@ -57,6 +72,7 @@ namespace CascadeClassifierBindings {
         v8::Local<v8::Object> ret = Nan::New<v8::Object>();
         Nan::Set(ret, FF::newString("objects"), Rect::ArrayWithCastConverter<cv::Rect>::wrap(objectRects));
         Nan::Set(ret, FF::newString("numDetections"), FF::IntArrayConverter::wrap(numDetections));
+        setStats(ret);
         return ret;
       }
     }
@@ -93,12 +109,12 @@ namespace CascadeClassifierBindings {
   
   struct DetectMultiScaleWithRejectLevelsWorker : public DetectMultiScaleWorker {
   public:
-    DetectMultiScaleWithRejectLevelsWorker(cv::CascadeClassifier classifier, bool isGpu = false) : DetectMultiScaleWorker(classifier, isGpu) {}
+    DetectMultiScaleWithRejectLevelsWorker(std::shared_ptr<CascadeClassifierPool> pool, bool isGpu = false) : DetectMultiScaleWorker(pool, isGpu) {}
   
     std::vector<int> rejectLevels;
     std::vector<double> levelWeights;
   
-    std::string executeCatchCvExceptionWorker() {
+    void detect(cv::CascadeClassifier& classifier) {
       if (isGpu) {
         cv::UMat oclMat = img.getUMat(cv::ACCESS_READ);
         classifier.detectMultiScale(oclMat, objectRects, rejectLevels, levelWeights, scaleFactor, (int)minNeighbors, (int)flags, minSize, maxSize, true);
@@ -106,7 +122,6 @@ namespace CascadeClassifierBindings {
       else {
         classifier.detectMultiScale(img, objectRects, rejectLevels, levelWeights, scaleFactor, (int)minNeighbors, (int)flags, minSize, maxSize, true);
       }
-      return "";
     }
   
     v8::Local<v8::Value> getReturnValue() {
@@ -114,6 +129,7 @@ namespace CascadeClassifierBindings {
       Nan::Set(ret, FF::newString("objects"), Rect::ArrayWithCastConverter<cv::Rect>::wrap(objectRects));
       Nan::Set(ret, FF::newString("rejectLevels"), FF::IntArrayConverter::wrap(rejectLevels));
       Nan::Set(ret, FF::newString("levelWeights"), FF::DoubleArrayConverter::wrap(levelWeights));
+      setStats(ret);
       return ret;
     }
   };
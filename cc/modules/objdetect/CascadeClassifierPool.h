@@ -0,0 +1,129 @@
+#include <opencv2/core.hpp>
+#include <opencv2/objdetect.hpp>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#ifndef __FF_CASCADECLASSIFIERPOOL_H__
+#define __FF_CASCADECLASSIFIERPOOL_H__
+
+/* cv::CascadeClassifier keeps per detection buffers in its implementation, which copies of the handle
+   share, such that concurrent detections on one classifier are not safe. The pool hands out one
+   classifier per concurrent call, clones are parsed from the cascade xml kept in memory and are
+   returned to the pool when the call finishes. */
+class CascadeClassifierPool {
+public:
+	class Lease {
+	public:
+		Lease(std::shared_ptr<CascadeClassifierPool> pool) {
+			this->pool = pool;
+			classifier = pool->acquire();
+		}
+
+		~Lease() {
+			pool->release(classifier);
+		}
+
+		cv::CascadeClassifier& get() {
+			return *classifier;
+		}
+
+	private:
+		std::shared_ptr<CascadeClassifierPool> pool;
+		std::shared_ptr<cv::CascadeClassifier> classifier;
+
+		Lease(const Lease&);
+		Lease& operator=(const Lease&);
+	};
+
+	// throws if the file is not a valid cascade
+	CascadeClassifierPool(const std::string& xmlFilePath) {
+		this->xmlFilePath = xmlFilePath;
+		std::shared_ptr<cv::CascadeClassifier> classifier = std::make_shared<cv::CascadeClassifier>();
+		if (!classifier->load(xmlFilePath)) {
+			throw std::runtime_error("failed to load cascade.xml file: " + xmlFilePath);
+		}
+		originalWindowSize = classifier->getOriginalWindowSize();
+		idle.push_back(classifier);
+		numClassifiers = 1;
+
+		// cascades in the old haar format can only be loaded from file
+		std::ifstream file(xmlFilePath.c_str(), std::ios::binary);
+		std::stringstream content;
+		content << file.rdbuf();
+		xmlContent = content.str();
+		cv::CascadeClassifier probe;
+		isNewFormat = readFromMemory(probe);
+	}
+
+	cv::Size getOriginalWindowSize() {
+		return originalWindowSize;
+	}
+
+	int getNumClassifiers() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return numClassifiers;
+	}
+
+	// number of image scales detectMultiScale evaluates, mirrors the scale loop of cv::CascadeClassifier
+	int getNumScales(cv::Size imgSize, double scaleFactor, cv::Size minSize, cv::Size maxSize) {
+		if (maxSize.height == 0 || maxSize.width == 0) {
+			maxSize = imgSize;
+		}
+		int numScales = 0;
+		for (double factor = 1; scaleFactor > 1; factor *= scaleFactor) {
+			cv::Size windowSize(cvRound(originalWindowSize.width * factor), cvRound(originalWindowSize.height * factor));
+			if (windowSize.width > maxSize.width || windowSize.height > maxSize.height
+				|| windowSize.width > imgSize.width || windowSize.height > imgSize.height) {
+				break;
+			}
+			if (windowSize.width < minSize.width || windowSize.height < minSize.height) {
+				continue;
+			}
+			numScales++;
+		}
+		return numScales;
+	}
+
+private:
+	std::string xmlFilePath;
+	std::string xmlContent;
+	bool isNewFormat;
+	cv::Size originalWindowSize;
+
+	std::mutex mutex;
+	std::vector<std::shared_ptr<cv::CascadeClassifier>> idle;
+	int numClassifiers;
+
+	bool readFromMemory(cv::CascadeClassifier& classifier) {
+		cv::FileStorage fs(xmlContent, cv::FileStorage::READ | cv::FileStorage::MEMORY);
+		return fs.isOpened() && classifier.read(fs.getFirstTopLevelNode());
+	}
+
+	std::shared_ptr<cv::CascadeClassifier> acquire() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (idle.size() > 0) {
+				std::shared_ptr<cv::CascadeClassifier> classifier = idle.back();
+				idle.pop_back();
+				return classifier;
+			}
+			numClassifiers++;
+		}
+		std::shared_ptr<cv::CascadeClassifier> classifier = std::make_shared<cv::CascadeClassifier>();
+		if (!(isNewFormat && readFromMemory(*classifier)) && !classifier->load(xmlFilePath)) {
+			std::lock_guard<std::mutex> lock(mutex);
+			numClassifiers--;
+			throw std::runtime_error("failed to load cascade.xml file: " + xmlFilePath);
+		}
+		return classifier;
+	}
+
+	void release(std::shared_ptr<cv::CascadeClassifier> classifier) {
+		std::lock_guard<std::mutex> lock(mutex);
+		idle.push_back(classifier);
+	}
+};
+
+#endif
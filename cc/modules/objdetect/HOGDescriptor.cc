@@ -29,6 +29,8 @@ NAN_MODULE_INIT(HOGDescriptor::Init) {
 
   Nan::SetPrototypeMethod(ctor, "compute", Compute);
   Nan::SetPrototypeMethod(ctor, "computeAsync", ComputeAsync);
+  Nan::SetPrototypeMethod(ctor, "computeBatch", ComputeBatch);
+  Nan::SetPrototypeMethod(ctor, "computeBatchAsync", ComputeBatchAsync);
   Nan::SetPrototypeMethod(ctor, "computeGradient", ComputeGradient);
   Nan::SetPrototypeMethod(ctor, "computeGradientAsync", ComputeGradientAsync);
   Nan::SetPrototypeMethod(ctor, "detect", Detect);
@@ -37,6 +39,10 @@ NAN_MODULE_INIT(HOGDescriptor::Init) {
   Nan::SetPrototypeMethod(ctor, "detectROIAsync", DetectROIAsync);
   Nan::SetPrototypeMethod(ctor, "detectMultiScale", DetectMultiScale);
   Nan::SetPrototypeMethod(ctor, "detectMultiScaleAsync", DetectMultiScaleAsync);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScaleBatch", DetectMultiScaleBatch);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScaleBatchAsync", DetectMultiScaleBatchAsync);
+  Nan::SetPrototypeMethod(ctor, "computeFeaturePyramid", ComputeFeaturePyramid);
+  Nan::SetPrototypeMethod(ctor, "computeFeaturePyramidAsync", ComputeFeaturePyramidAsync);
   Nan::SetPrototypeMethod(ctor, "detectMultiScaleROI", DetectMultiScaleROI);
   Nan::SetPrototypeMethod(ctor, "detectMultiScaleROIAsync", DetectMultiScaleROIAsync);
   Nan::SetPrototypeMethod(ctor, "groupRectangles", GroupRectangles);
@@ -135,6 +141,22 @@ NAN_METHOD(HOGDescriptor::ComputeAsync) {
   );
 }
 
+NAN_METHOD(HOGDescriptor::ComputeBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::ComputeBatchWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::ComputeBatch",
+    info
+  );
+}
+
+NAN_METHOD(HOGDescriptor::ComputeBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::ComputeBatchWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::ComputeBatchAsync",
+    info
+  );
+}
+
 NAN_METHOD(HOGDescriptor::ComputeGradient) {
   FF::SyncBindingBase(
     std::make_shared<HOGDescriptorBindings::ComputeGradientWorker>(HOGDescriptor::unwrapSelf(info)),
@@ -199,6 +221,38 @@ NAN_METHOD(HOGDescriptor::DetectMultiScaleAsync) {
   );
 }
 
+NAN_METHOD(HOGDescriptor::DetectMultiScaleBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::DetectMultiScaleBatchWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::DetectMultiScaleBatch",
+    info
+  );
+}
+
+NAN_METHOD(HOGDescriptor::DetectMultiScaleBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::DetectMultiScaleBatchWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::DetectMultiScaleBatchAsync",
+    info
+  );
+}
+
+NAN_METHOD(HOGDescriptor::ComputeFeaturePyramid) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::ComputeFeaturePyramidWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::ComputeFeaturePyramid",
+    info
+  );
+}
+
+NAN_METHOD(HOGDescriptor::ComputeFeaturePyramidAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGDescriptorBindings::ComputeFeaturePyramidWorker>(HOGDescriptor::unwrapSelf(info)),
+    "HOGDescriptor::ComputeFeaturePyramidAsync",
+    info
+  );
+}
+
 NAN_METHOD(HOGDescriptor::DetectMultiScaleROI) {
   FF::SyncBindingBase(
     std::make_shared<HOGDescriptorBindings::DetectMultiScaleROIWorker>(HOGDescriptor::unwrapSelf(info)),
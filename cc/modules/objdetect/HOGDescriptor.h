@@ -43,6 +43,8 @@ public:
 	static NAN_METHOD(Load);
 	static NAN_METHOD(Compute);
 	static NAN_METHOD(ComputeAsync);
+	static NAN_METHOD(ComputeBatch);
+	static NAN_METHOD(ComputeBatchAsync);
 	static NAN_METHOD(ComputeGradient);
 	static NAN_METHOD(ComputeGradientAsync);
 	static NAN_METHOD(Detect);
@@ -51,6 +53,10 @@ public:
 	static NAN_METHOD(DetectROIAsync);
 	static NAN_METHOD(DetectMultiScale);
 	static NAN_METHOD(DetectMultiScaleAsync);
+	static NAN_METHOD(DetectMultiScaleBatch);
+	static NAN_METHOD(DetectMultiScaleBatchAsync);
+	static NAN_METHOD(ComputeFeaturePyramid);
+	static NAN_METHOD(ComputeFeaturePyramidAsync);
 	static NAN_METHOD(DetectMultiScaleROI);
 	static NAN_METHOD(DetectMultiScaleROIAsync);
 	static NAN_METHOD(GroupRectangles);
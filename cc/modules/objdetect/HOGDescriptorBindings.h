@@ -1,4 +1,6 @@
 #include "HOGDescriptor.h"
+#include "HOGFeaturePyramid.h"
+#include "parallelUtils.h"
 
 #ifndef __FF_HOGDESCRIPTORBINDINGS_H_
 #define __FF_HOGDESCRIPTORBINDINGS_H_
@@ -115,6 +117,166 @@ namespace HOGDescriptorBindings {
     }
   };
 
+  /* computes the descriptors of many images or image locations into one CV_32F Mat with one row per window,
+     rows are ordered by sample and window, samples are computed in parallel and each writes its rows in place */
+  struct ComputeBatchWorker : CatchCvExceptionWorker  {
+  public:
+    std::shared_ptr<cv::HOGDescriptor> hog;
+
+    ComputeBatchWorker(std::shared_ptr<cv::HOGDescriptor> hog) {
+      this->hog = hog;
+    }
+
+    struct Sample {
+      cv::Mat img;
+      std::vector<cv::Point2i> locations;
+    };
+
+    std::vector<Sample> samples;
+    cv::Size2d winStride;
+    cv::Size2d padding;
+
+    cv::Mat descriptors;
+
+    // number of windows HOGDescriptor::compute extracts from a sample, -1 if the image is smaller than a window
+    int getNumWindows(const Sample& sample, cv::Size stride) {
+      if (sample.locations.size() > 0) {
+        return (int)sample.locations.size();
+      }
+      cv::Size cacheStride(gcd(stride.width, hog->blockStride.width), gcd(stride.height, hog->blockStride.height));
+      cv::Size paddedImgSize(
+        sample.img.cols + 2 * (int)cv::alignSize(std::max((int)padding.width, 0), cacheStride.width),
+        sample.img.rows + 2 * (int)cv::alignSize(std::max((int)padding.height, 0), cacheStride.height)
+      );
+      if (paddedImgSize.width < hog->winSize.width || paddedImgSize.height < hog->winSize.height) {
+        return -1;
+      }
+      return ((paddedImgSize.width - hog->winSize.width) / stride.width + 1)
+        * ((paddedImgSize.height - hog->winSize.height) / stride.height + 1);
+    }
+
+    static int gcd(int a, int b) {
+      while (b > 0) {
+        int r = a % b;
+        a = b;
+        b = r;
+      }
+      return a;
+    }
+
+    std::string executeCatchCvExceptionWorker() {
+      // HOGDescriptor::compute defaults to a window stride of one cell
+      cv::Size stride = winStride.area() == 0 ? hog->cellSize : cv::Size(winStride);
+      if (stride.width <= 0 || stride.height <= 0) {
+        return "expected winStride to be positive";
+      }
+      std::string err = HOGFeaturePyramidState::validateBlockLayout(*hog);
+      if (!err.empty()) {
+        return err;
+      }
+      int descriptorSize = (int)hog->getDescriptorSize();
+      std::vector<int> rowOffsets(samples.size() + 1, 0);
+      for (size_t i = 0; i < samples.size(); i++) {
+        if (samples[i].img.type() != CV_8UC1 && samples[i].img.type() != CV_8UC3) {
+          return "expected images to be of type CV_8UC1 or CV_8UC3";
+        }
+        err = validateLocations(samples[i], stride, (int)i);
+        if (!err.empty()) {
+          return err;
+        }
+        int numWindows = getNumWindows(samples[i], stride);
+        if (numWindows < 0) {
+          return "expected image " + std::to_string(i) + " to be at least of size winSize";
+        }
+        rowOffsets[i + 1] = rowOffsets[i] + numWindows;
+      }
+
+      descriptors = cv::Mat(rowOffsets[samples.size()], descriptorSize, CV_32F);
+      return ParallelUtils::forEachStripe((int)samples.size(), [&](int i) {
+        std::vector<float> buf;
+        hog->compute(samples[i].img, buf, stride, padding, samples[i].locations);
+        size_t expectedSize = (size_t)(rowOffsets[i + 1] - rowOffsets[i]) * descriptorSize;
+        if (buf.size() != expectedSize) {
+          throw std::runtime_error("unexpected number of descriptors for sample " + std::to_string(i));
+        }
+        if (expectedSize > 0) {
+          memcpy(descriptors.ptr<float>(rowOffsets[i]), buf.data(), expectedSize * sizeof(float));
+        }
+      });
+    }
+
+    // windows at the given locations have to lie inside the padded image, the padding is aligned as in getNumWindows
+    std::string validateLocations(const Sample& sample, cv::Size stride, int sampleIdx) {
+      cv::Size cacheStride(gcd(stride.width, hog->blockStride.width), gcd(stride.height, hog->blockStride.height));
+      int padX = (int)cv::alignSize(std::max((int)padding.width, 0), cacheStride.width);
+      int padY = (int)cv::alignSize(std::max((int)padding.height, 0), cacheStride.height);
+      for (const cv::Point2i& pt : sample.locations) {
+        if (pt.x < -padX || pt.y < -padY || pt.x + hog->winSize.width > sample.img.cols + padX
+          || pt.y + hog->winSize.height > sample.img.rows + padY) {
+          return "expected locations of sample " + std::to_string(sampleIdx) + " to lie inside the padded image";
+        }
+      }
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Mat::Converter::wrap(descriptors);
+    }
+
+    bool unwrapSample(v8::Local<v8::Value> jsSample, Sample& sample) {
+      if (Mat::hasInstance(jsSample)) {
+        return Mat::Converter::unwrapTo(&sample.img, jsSample);
+      }
+      if (!jsSample->IsObject()) {
+        Nan::ThrowError("expected samples to be images or objects { image, locations }");
+        return true;
+      }
+      v8::Local<v8::Object> jsObj = jsSample->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        Mat::Converter::prop(&sample.img, "image", jsObj) ||
+        Point2::ArrayWithCastConverter<cv::Point2i>::optProp(&sample.locations, "locations", jsObj)
+      );
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      if (!FF::hasArg(info, 0) || !info[0]->IsObject()) {
+        Nan::ThrowError("expected arg 0 to be an array of images or an object { image, locations }");
+        return true;
+      }
+      if (!info[0]->IsArray()) {
+        samples.resize(1);
+        return unwrapSample(info[0], samples[0]);
+      }
+      v8::Local<v8::Array> jsSamples = v8::Local<v8::Array>::Cast(info[0]);
+      samples.resize(jsSamples->Length());
+      for (uint i = 0; i < jsSamples->Length(); i++) {
+        if (unwrapSample(Nan::Get(jsSamples, i).ToLocalChecked(), samples[i])) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Size::Converter::optArg(1, &winStride, info) ||
+        Size::Converter::optArg(2, &padding, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1) && !Size::hasInstance(info[1]);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        Size::Converter::optProp(&winStride, "winStride", opts) ||
+        Size::Converter::optProp(&padding, "padding", opts)
+      );
+    }
+  };
+
   struct ComputeGradientWorker : public CatchCvExceptionWorker {
   public:
     std::shared_ptr<cv::HOGDescriptor> self;
@@ -348,6 +510,106 @@ namespace HOGDescriptorBindings {
     }
   };
 
+  // runs detectMultiScale for each image in parallel, nested parallel loops of the detector run sequentially
+  struct DetectMultiScaleBatchWorker : public DetectMultiScaleWorker {
+  public:
+    DetectMultiScaleBatchWorker(std::shared_ptr<cv::HOGDescriptor> self) : DetectMultiScaleWorker(self) {}
+
+    std::vector<cv::Mat> images;
+
+    std::vector<std::vector<cv::Rect>> batchLocations;
+    std::vector<std::vector<double>> batchWeights;
+
+    std::string executeCatchCvExceptionWorker() {
+      for (const cv::Mat& image : images) {
+        if (image.type() != CV_8UC1 && image.type() != CV_8UC3) {
+          return "expected images to be of type CV_8UC1 or CV_8UC3";
+        }
+      }
+      batchLocations.resize(images.size());
+      batchWeights.resize(images.size());
+      return ParallelUtils::forEachStripe((int)images.size(), [&](int i) {
+        self->detectMultiScale(images[i], batchLocations[i], batchWeights[i], hitThreshold, winStride, padding, scale, finalThreshold, useMeanshiftGrouping);
+      });
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(images.size());
+      for (size_t i = 0; i < images.size(); i++) {
+        v8::Local<v8::Object> jsResult = Nan::New<v8::Object>();
+        Nan::Set(jsResult, Nan::New("foundLocations").ToLocalChecked(), Rect::ArrayWithCastConverter<cv::Rect>::wrap(batchLocations[i]));
+        Nan::Set(jsResult, Nan::New("foundWeights").ToLocalChecked(), FF::DoubleArrayConverter::wrap(batchWeights[i]));
+        Nan::Set(ret, i, jsResult);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::ArrayConverter::arg(0, &images, info)
+      );
+    }
+  };
+
+  struct ComputeFeaturePyramidWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<cv::HOGDescriptor> self;
+    ComputeFeaturePyramidWorker(std::shared_ptr<cv::HOGDescriptor> self) {
+      this->self = self;
+      nlevels = self->nlevels;
+    }
+
+    cv::Mat img;
+    double scale = 1.05;
+    int nlevels;
+    std::vector<double> scales;
+
+    std::shared_ptr<HOGFeaturePyramidState> pyramid;
+
+    std::string executeCatchCvExceptionWorker() {
+      if (img.type() != CV_8UC1 && img.type() != CV_8UC3) {
+        return "expected img to be of type CV_8UC1 or CV_8UC3";
+      }
+      pyramid = std::make_shared<HOGFeaturePyramidState>(*self);
+      std::string err = HOGFeaturePyramidState::validateBlockLayout(*self);
+      if (!err.empty()) {
+        return err;
+      }
+      pyramid->compute(img, scales, scale, nlevels);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return HOGFeaturePyramid::Converter::wrap(pyramid);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Mat::Converter::arg(0, &img, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(1, &scale, info) ||
+        FF::IntConverter::optArg(2, &nlevels, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&scale, "scale", opts) ||
+        FF::IntConverter::optProp(&nlevels, "nlevels", opts) ||
+        FF::DoubleArrayConverter::optProp(&scales, "scales", opts)
+      );
+    }
+  };
+
   struct DetectMultiScaleROIWorker : public CatchCvExceptionWorker {
   public:
     std::shared_ptr<cv::HOGDescriptor> self;
@@ -0,0 +1,101 @@
+#include "HOGFeaturePyramid.h"
+#include "HOGFeaturePyramidBindings.h"
+
+Nan::Persistent<v8::FunctionTemplate> HOGFeaturePyramid::constructor;
+
+NAN_MODULE_INIT(HOGFeaturePyramid::Init) {
+  v8::Local<v8::FunctionTemplate> ctor = Nan::New<v8::FunctionTemplate>(HOGFeaturePyramid::New);
+  v8::Local<v8::ObjectTemplate> instanceTemplate = ctor->InstanceTemplate();
+
+  constructor.Reset(ctor);
+  ctor->SetClassName(FF::newString("HOGFeaturePyramid"));
+  instanceTemplate->SetInternalFieldCount(1);
+
+  Nan::SetAccessor(instanceTemplate, FF::newString("numLevels"), numLevels_getter);
+  Nan::SetAccessor(instanceTemplate, FF::newString("scales"), scales_getter);
+
+  Nan::SetPrototypeMethod(ctor, "detect", Detect);
+  Nan::SetPrototypeMethod(ctor, "detectAsync", DetectAsync);
+  Nan::SetPrototypeMethod(ctor, "detectROI", DetectROI);
+  Nan::SetPrototypeMethod(ctor, "detectROIAsync", DetectROIAsync);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScale", DetectMultiScale);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScaleAsync", DetectMultiScaleAsync);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScaleROI", DetectMultiScaleROI);
+  Nan::SetPrototypeMethod(ctor, "detectMultiScaleROIAsync", DetectMultiScaleROIAsync);
+
+  Nan::Set(target, FF::newString("HOGFeaturePyramid"), FF::getFunction(ctor));
+};
+
+// pyramids are computed by HOGDescriptor.computeFeaturePyramid, a constructed pyramid has no levels
+NAN_METHOD(HOGFeaturePyramid::New) {
+  FF::TryCatch tryCatch("HOGFeaturePyramid::New");
+  FF_ASSERT_CONSTRUCT_CALL();
+  HOGFeaturePyramid* self = new HOGFeaturePyramid();
+  self->setNativeObject(std::make_shared<HOGFeaturePyramidState>());
+  self->Wrap(info.Holder());
+  info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(HOGFeaturePyramid::Detect) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::Detect",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectAsync",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectROI) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectROIWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectROI",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectROIAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectROIWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectROIAsync",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectMultiScale) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectMultiScaleWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectMultiScale",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectMultiScaleAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectMultiScaleWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectMultiScaleAsync",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectMultiScaleROI) {
+  FF::SyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectMultiScaleROIWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectMultiScaleROI",
+    info
+  );
+}
+
+NAN_METHOD(HOGFeaturePyramid::DetectMultiScaleROIAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<HOGFeaturePyramidBindings::DetectMultiScaleROIWorker>(HOGFeaturePyramid::unwrapSelf(info)),
+    "HOGFeaturePyramid::DetectMultiScaleROIAsync",
+    info
+  );
+}
@@ -0,0 +1,40 @@
+#include "macros.h"
+#include <opencv2/core.hpp>
+#include <opencv2/objdetect.hpp>
+#include "Size.h"
+#include "Mat.h"
+#include "Rect.h"
+#include "Point.h"
+#include "DetectionROI.h"
+#include "CatchCvExceptionWorker.h"
+#include "HOGFeaturePyramidState.h"
+
+#ifndef __FF_HOGFEATUREPYRAMID_H__
+#define __FF_HOGFEATUREPYRAMID_H__
+
+// created by HOGDescriptor.computeFeaturePyramid, the pyramid is immutable and can be queried concurrently
+class HOGFeaturePyramid : public FF::ObjectWrap<HOGFeaturePyramid, std::shared_ptr<HOGFeaturePyramidState>> {
+public:
+	static Nan::Persistent<v8::FunctionTemplate> constructor;
+
+	static const char* getClassName() {
+		return "HOGFeaturePyramid";
+	}
+
+	FF_GETTER_CUSTOM(numLevels, FF::IntConverter, self->getNumLevels());
+	FF_GETTER_CUSTOM(scales, FF::DoubleArrayConverter, self->getScales());
+
+	static NAN_MODULE_INIT(Init);
+
+	static NAN_METHOD(New);
+	static NAN_METHOD(Detect);
+	static NAN_METHOD(DetectAsync);
+	static NAN_METHOD(DetectROI);
+	static NAN_METHOD(DetectROIAsync);
+	static NAN_METHOD(DetectMultiScale);
+	static NAN_METHOD(DetectMultiScaleAsync);
+	static NAN_METHOD(DetectMultiScaleROI);
+	static NAN_METHOD(DetectMultiScaleROIAsync);
+};
+
+#endif
@@ -0,0 +1,254 @@
+#include "HOGFeaturePyramid.h"
+
+#ifndef __FF_HOGFEATUREPYRAMIDBINDINGS_H_
+#define __FF_HOGFEATUREPYRAMIDBINDINGS_H_
+
+namespace HOGFeaturePyramidBindings {
+
+  static inline cv::Size getWinStride(std::shared_ptr<HOGFeaturePyramidState> self, cv::Size2d winStride) {
+    return winStride.area() == 0 ? self->hog.blockStride : cv::Size(winStride);
+  }
+
+  struct DetectWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<HOGFeaturePyramidState> self;
+    DetectWorker(std::shared_ptr<HOGFeaturePyramidState> self) {
+      this->self = self;
+    }
+
+    double hitThreshold = 0;
+    cv::Size2d winStride = cv::Size2d();
+    double scale = 1;
+
+    std::vector<cv::Point> foundLocations;
+    std::vector<double> weights;
+
+    std::string executeCatchCvExceptionWorker() {
+      cv::Size stride = getWinStride(self, winStride);
+      std::string err = self->validate(stride);
+      if (!err.empty()) {
+        return err;
+      }
+      int levelIdx = self->findLevel(scale);
+      if (levelIdx < 0) {
+        return "HOGFeaturePyramid::Detect - no pyramid level for scale " + std::to_string(scale);
+      }
+      self->detect(levelIdx, foundLocations, weights, hitThreshold, stride);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("foundLocations").ToLocalChecked(), Point2::ArrayWithCastConverter<cv::Point2i>::wrap(foundLocations));
+      Nan::Set(ret, Nan::New("weights").ToLocalChecked(), FF::DoubleArrayConverter::wrap(weights));
+      return ret;
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(0, &hitThreshold, info) ||
+        Size::Converter::optArg(1, &winStride, info) ||
+        FF::DoubleConverter::optArg(2, &scale, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 0);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&hitThreshold, "hitThreshold", opts) ||
+        Size::Converter::optProp(&winStride, "winStride", opts) ||
+        FF::DoubleConverter::optProp(&scale, "scale", opts)
+      );
+    }
+  };
+
+  struct DetectROIWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<HOGFeaturePyramidState> self;
+    DetectROIWorker(std::shared_ptr<HOGFeaturePyramidState> self) {
+      this->self = self;
+    }
+
+    std::vector<cv::Point> locations;
+    double hitThreshold = 0;
+    double scale = 1;
+
+    std::vector<cv::Point> foundLocations;
+    std::vector<double> confidences;
+
+    std::string executeCatchCvExceptionWorker() {
+      std::string err = self->validate(self->hog.blockStride);
+      if (!err.empty()) {
+        return err;
+      }
+      int levelIdx = self->findLevel(scale);
+      if (levelIdx < 0) {
+        return "HOGFeaturePyramid::DetectROI - no pyramid level for scale " + std::to_string(scale);
+      }
+      for (const cv::Point& pt : locations) {
+        if (!self->isOnGrid(pt)) {
+          return "HOGFeaturePyramid::DetectROI - expected locations to be multiples of blockStride";
+        }
+      }
+      self->detectROI(levelIdx, locations, foundLocations, confidences, hitThreshold);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("foundLocations").ToLocalChecked(), Point2::ArrayWithCastConverter<cv::Point2i>::wrap(foundLocations));
+      Nan::Set(ret, Nan::New("confidences").ToLocalChecked(), FF::DoubleArrayConverter::wrap(confidences));
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        Point2::ArrayWithCastConverter<cv::Point2i>::arg(0, &locations, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(1, &hitThreshold, info) ||
+        FF::DoubleConverter::optArg(2, &scale, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&hitThreshold, "hitThreshold", opts) ||
+        FF::DoubleConverter::optProp(&scale, "scale", opts)
+      );
+    }
+  };
+
+  struct DetectMultiScaleWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<HOGFeaturePyramidState> self;
+    DetectMultiScaleWorker(std::shared_ptr<HOGFeaturePyramidState> self) {
+      this->self = self;
+    }
+
+    double hitThreshold = 0;
+    cv::Size2d winStride = cv::Size2d();
+    double finalThreshold = 2.0;
+    bool useMeanshiftGrouping = false;
+
+    std::vector<cv::Rect> foundLocations;
+    std::vector<double> foundWeights;
+
+    std::string executeCatchCvExceptionWorker() {
+      cv::Size stride = getWinStride(self, winStride);
+      std::string err = self->validate(stride);
+      if (!err.empty()) {
+        return err;
+      }
+      self->detectMultiScale(foundLocations, foundWeights, hitThreshold, stride, finalThreshold, useMeanshiftGrouping);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Object> ret = Nan::New<v8::Object>();
+      Nan::Set(ret, Nan::New("foundLocations").ToLocalChecked(), Rect::ArrayWithCastConverter<cv::Rect>::wrap(foundLocations));
+      Nan::Set(ret, Nan::New("foundWeights").ToLocalChecked(), FF::DoubleArrayConverter::wrap(foundWeights));
+      return ret;
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(0, &hitThreshold, info) ||
+        Size::Converter::optArg(1, &winStride, info) ||
+        FF::DoubleConverter::optArg(2, &finalThreshold, info) ||
+        FF::BoolConverter::optArg(3, &useMeanshiftGrouping, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 0);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[0]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&hitThreshold, "hitThreshold", opts) ||
+        Size::Converter::optProp(&winStride, "winStride", opts) ||
+        FF::DoubleConverter::optProp(&finalThreshold, "finalThreshold", opts) ||
+        FF::BoolConverter::optProp(&useMeanshiftGrouping, "useMeanshiftGrouping", opts)
+      );
+    }
+  };
+
+  struct DetectMultiScaleROIWorker : public CatchCvExceptionWorker {
+  public:
+    std::shared_ptr<HOGFeaturePyramidState> self;
+    DetectMultiScaleROIWorker(std::shared_ptr<HOGFeaturePyramidState> self) {
+      this->self = self;
+    }
+
+    std::vector<cv::DetectionROI> locations;
+    double hitThreshold = 0;
+    int groupThreshold = 0;
+
+    std::vector<cv::Rect> foundLocations;
+
+    std::string executeCatchCvExceptionWorker() {
+      std::string err = self->validate(self->hog.blockStride);
+      if (!err.empty()) {
+        return err;
+      }
+      for (const cv::DetectionROI& roi : locations) {
+        if (self->findLevel(roi.scale) < 0) {
+          return "HOGFeaturePyramid::DetectMultiScaleROI - no pyramid level for scale " + std::to_string(roi.scale);
+        }
+        for (const cv::Point& pt : roi.locations) {
+          if (!self->isOnGrid(pt)) {
+            return "HOGFeaturePyramid::DetectMultiScaleROI - expected locations to be multiples of blockStride";
+          }
+        }
+      }
+      self->detectMultiScaleROI(locations, foundLocations, hitThreshold, groupThreshold);
+      return "";
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      return Rect::ArrayWithCastConverter<cv::Rect>::wrap(foundLocations);
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        DetectionROI::ArrayConverter::arg(0, &locations, info)
+      );
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::DoubleConverter::optArg(1, &hitThreshold, info) ||
+        FF::IntConverter::optArg(2, &groupThreshold, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::DoubleConverter::optProp(&hitThreshold, "hitThreshold", opts) ||
+        FF::IntConverter::optProp(&groupThreshold, "groupThreshold", opts)
+      );
+    }
+  };
+
+}
+
+#endif
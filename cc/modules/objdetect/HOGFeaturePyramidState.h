@@ -0,0 +1,268 @@
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include "parallelUtils.h"
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#ifndef __FF_HOGFEATUREPYRAMIDSTATE_H__
+#define __FF_HOGFEATUREPYRAMIDSTATE_H__
+
+struct HOGFeaturePyramidLevel {
+	double scale;
+	cv::Size imgSize;
+	// number of blocks along x and y on the block stride grid
+	cv::Size numBlocks;
+	// normalized block histograms, one row per block in row major order of the block grid
+	cv::Mat blocks;
+};
+
+/* block histograms of every level of an image pyramid, computed once per frame. HOG normalizes each
+   block on its own, such that the descriptor of any detection window on the block stride grid is the
+   concatenation of the block histograms it covers. Detections query the cached blocks instead of
+   recomputing gradients and histograms for each call. Gradients are computed without padding, as
+   with the default padding of the HOGDescriptor detect methods. */
+class HOGFeaturePyramidState {
+public:
+	cv::HOGDescriptor hog;
+	std::vector<HOGFeaturePyramidLevel> levels;
+
+	HOGFeaturePyramidState() {}
+
+	HOGFeaturePyramidState(const cv::HOGDescriptor& hog) {
+		hog.copyTo(this->hog);
+	}
+
+	// levels are computed for the given scales or for scale^i, until the image is smaller than a window
+	void compute(const cv::Mat& img, std::vector<double> scales, double scale, int nlevels) {
+		if (scales.size() == 0) {
+			double levelScale = 1;
+			for (int i = 0; i < nlevels; i++) {
+				if (cvRound(img.cols / levelScale) < hog.winSize.width || cvRound(img.rows / levelScale) < hog.winSize.height) {
+					break;
+				}
+				scales.push_back(levelScale);
+				if (scale <= 1) {
+					break;
+				}
+				levelScale *= scale;
+			}
+		}
+		for (double levelScale : scales) {
+			if (levelScale <= 0) {
+				throw std::runtime_error("HOGFeaturePyramid - expected scales to be positive");
+			}
+		}
+
+		levels.resize(scales.size());
+		std::string err = ParallelUtils::forEachStripe((int)levels.size(), [&](int i) {
+			computeLevel(img, scales[i], levels[i]);
+		});
+		if (!err.empty()) {
+			levels.clear();
+			throw std::runtime_error(err);
+		}
+	}
+
+	int getNumLevels() {
+		return (int)levels.size();
+	}
+
+	std::vector<double> getScales() {
+		std::vector<double> scales;
+		for (const HOGFeaturePyramidLevel& level : levels) {
+			scales.push_back(level.scale);
+		}
+		return scales;
+	}
+
+	// index of the level with the given scale, -1 if no level is within 1% of scale
+	int findLevel(double scale) {
+		int best = -1;
+		for (int i = 0; i < (int)levels.size(); i++) {
+			if (best < 0 || std::abs(levels[i].scale - scale) < std::abs(levels[best].scale - scale)) {
+				best = i;
+			}
+		}
+		return (best >= 0 && std::abs(levels[best].scale - scale) <= 0.01 * scale) ? best : -1;
+	}
+
+	// error message if the blocks do not tile the window of hog, HOGDescriptor asserts on these
+	static std::string validateBlockLayout(const cv::HOGDescriptor& hog) {
+		if (hog.cellSize.width <= 0 || hog.cellSize.height <= 0 || hog.blockStride.width <= 0 || hog.blockStride.height <= 0) {
+			return "expected cellSize and blockStride to be positive";
+		}
+		if (hog.blockSize.width % hog.cellSize.width != 0 || hog.blockSize.height % hog.cellSize.height != 0) {
+			return "expected blockSize to be a multiple of cellSize";
+		}
+		if (hog.blockSize.width > hog.winSize.width || hog.blockSize.height > hog.winSize.height
+			|| (hog.winSize.width - hog.blockSize.width) % hog.blockStride.width != 0
+			|| (hog.winSize.height - hog.blockSize.height) % hog.blockStride.height != 0) {
+			return "expected blocks to tile winSize with blockStride";
+		}
+		return "";
+	}
+
+	// error message if the svm detector or the window stride do not fit the block layout
+	std::string validate(cv::Size winStride) {
+		size_t descriptorSize = hog.getDescriptorSize();
+		if (hog.svmDetector.size() != descriptorSize && hog.svmDetector.size() != descriptorSize + 1) {
+			return "HOGFeaturePyramid - expected svm detector of size " + std::to_string(descriptorSize + 1);
+		}
+		if (winStride.width % hog.blockStride.width != 0 || winStride.height % hog.blockStride.height != 0) {
+			return "HOGFeaturePyramid - expected winStride to be a multiple of blockStride";
+		}
+		return "";
+	}
+
+	bool isOnGrid(cv::Point pt) {
+		return pt.x >= 0 && pt.y >= 0 && pt.x % hog.blockStride.width == 0 && pt.y % hog.blockStride.height == 0;
+	}
+
+	// svm response of the window with top left corner pt, pt has to be on the block stride grid
+	double score(const HOGFeaturePyramidLevel& level, cv::Point pt) {
+		cv::Size windowBlocks = getWindowBlocks();
+		int bx = pt.x / hog.blockStride.width;
+		int by = pt.y / hog.blockStride.height;
+		if (bx + windowBlocks.width > level.numBlocks.width || by + windowBlocks.height > level.numBlocks.height) {
+			return -std::numeric_limits<double>::infinity();
+		}
+		int blockHistogramSize = level.blocks.cols;
+		size_t descriptorSize = hog.getDescriptorSize();
+		double s = hog.svmDetector.size() > descriptorSize ? hog.svmDetector[descriptorSize] : 0;
+		const float* svm = &hog.svmDetector[0];
+		// window descriptors concatenate their blocks in column major order
+		for (int j = 0; j < windowBlocks.width; j++) {
+			for (int i = 0; i < windowBlocks.height; i++) {
+				const float* block = level.blocks.ptr<float>((by + i) * level.numBlocks.width + bx + j);
+				const float* weights = svm + (j * windowBlocks.height + i) * blockHistogramSize;
+				for (int k = 0; k < blockHistogramSize; k++) {
+					s += weights[k] * block[k];
+				}
+			}
+		}
+		return s;
+	}
+
+	void detect(int levelIdx, std::vector<cv::Point>& foundLocations, std::vector<double>& weights,
+		double hitThreshold, cv::Size winStride) {
+		const HOGFeaturePyramidLevel& level = levels[levelIdx];
+		int numX = (level.imgSize.width - hog.winSize.width) / winStride.width + 1;
+		int numY = (level.imgSize.height - hog.winSize.height) / winStride.height + 1;
+		if (numX <= 0 || numY <= 0) {
+			return;
+		}
+		std::vector<std::vector<cv::Point>> rowLocations(numY);
+		std::vector<std::vector<double>> rowWeights(numY);
+		std::string err = ParallelUtils::forEachStripe(numY, [&](int y) {
+			for (int x = 0; x < numX; x++) {
+				cv::Point pt(x * winStride.width, y * winStride.height);
+				double s = score(level, pt);
+				if (s >= hitThreshold) {
+					rowLocations[y].push_back(pt);
+					rowWeights[y].push_back(s);
+				}
+			}
+		});
+		if (!err.empty()) {
+			throw std::runtime_error(err);
+		}
+		for (int y = 0; y < numY; y++) {
+			foundLocations.insert(foundLocations.end(), rowLocations[y].begin(), rowLocations[y].end());
+			weights.insert(weights.end(), rowWeights[y].begin(), rowWeights[y].end());
+		}
+	}
+
+	void detectROI(int levelIdx, const std::vector<cv::Point>& locations, std::vector<cv::Point>& foundLocations,
+		std::vector<double>& confidences, double hitThreshold) {
+		const HOGFeaturePyramidLevel& level = levels[levelIdx];
+		confidences.resize(locations.size());
+		for (size_t i = 0; i < locations.size(); i++) {
+			confidences[i] = score(level, locations[i]);
+			if (confidences[i] >= hitThreshold) {
+				foundLocations.push_back(locations[i]);
+			}
+		}
+	}
+
+	void detectMultiScale(std::vector<cv::Rect>& foundLocations, std::vector<double>& foundWeights,
+		double hitThreshold, cv::Size winStride, double finalThreshold, bool useMeanshiftGrouping) {
+		std::vector<std::vector<cv::Rect>> levelRects(levels.size());
+		std::vector<std::vector<double>> levelWeights(levels.size());
+		for (size_t l = 0; l < levels.size(); l++) {
+			std::vector<cv::Point> locations;
+			detect((int)l, locations, levelWeights[l], hitThreshold, winStride);
+			cv::Size scaledWinSize(cvRound(hog.winSize.width * levels[l].scale), cvRound(hog.winSize.height * levels[l].scale));
+			for (const cv::Point& pt : locations) {
+				levelRects[l].push_back(cv::Rect(cvRound(pt.x * levels[l].scale), cvRound(pt.y * levels[l].scale),
+					scaledWinSize.width, scaledWinSize.height));
+			}
+		}
+		std::vector<double> foundScales;
+		for (size_t l = 0; l < levels.size(); l++) {
+			foundLocations.insert(foundLocations.end(), levelRects[l].begin(), levelRects[l].end());
+			foundWeights.insert(foundWeights.end(), levelWeights[l].begin(), levelWeights[l].end());
+			foundScales.insert(foundScales.end(), levelRects[l].size(), levels[l].scale);
+		}
+		if (useMeanshiftGrouping) {
+			cv::groupRectangles_meanshift(foundLocations, foundWeights, foundScales, finalThreshold, hog.winSize);
+		}
+		else {
+			hog.groupRectangles(foundLocations, foundWeights, (int)finalThreshold, 0.2);
+		}
+	}
+
+	// stores the confidences of each location in rois, as HOGDescriptor::detectMultiScaleROI
+	void detectMultiScaleROI(std::vector<cv::DetectionROI>& rois, std::vector<cv::Rect>& foundLocations,
+		double hitThreshold, int groupThreshold) {
+		for (cv::DetectionROI& roi : rois) {
+			int levelIdx = findLevel(roi.scale);
+			std::vector<cv::Point> dets;
+			roi.confidences.clear();
+			detectROI(levelIdx, roi.locations, dets, roi.confidences, hitThreshold);
+			cv::Size scaledWinSize(cvRound(hog.winSize.width * roi.scale), cvRound(hog.winSize.height * roi.scale));
+			for (const cv::Point& pt : dets) {
+				foundLocations.push_back(cv::Rect(cvRound(pt.x * roi.scale), cvRound(pt.y * roi.scale),
+					scaledWinSize.width, scaledWinSize.height));
+			}
+		}
+		cv::groupRectangles(foundLocations, groupThreshold, 0.2);
+	}
+
+private:
+	cv::Size getWindowBlocks() {
+		return cv::Size(
+			(hog.winSize.width - hog.blockSize.width) / hog.blockStride.width + 1,
+			(hog.winSize.height - hog.blockSize.height) / hog.blockStride.height + 1
+		);
+	}
+
+	void computeLevel(const cv::Mat& img, double scale, HOGFeaturePyramidLevel& level) {
+		level.scale = scale;
+		level.imgSize = cv::Size(cvRound(img.cols / scale), cvRound(img.rows / scale));
+		cv::Mat levelImg = img;
+		if (level.imgSize != img.size()) {
+			cv::resize(img, levelImg, level.imgSize, 0, 0, cv::INTER_LINEAR);
+		}
+
+		// a descriptor with a single block per window yields the normalized histogram of every block
+		cv::HOGDescriptor blockHog(hog.blockSize, hog.blockSize, hog.blockStride, hog.cellSize, hog.nbins,
+			hog.derivAperture, hog.getWinSigma(), hog.histogramNormType, hog.L2HysThreshold, hog.gammaCorrection,
+			hog.nlevels, hog.signedGradient);
+		level.numBlocks = cv::Size(0, 0);
+		level.blocks = cv::Mat(0, (int)blockHog.getDescriptorSize(), CV_32F);
+		if (level.imgSize.width < hog.blockSize.width || level.imgSize.height < hog.blockSize.height) {
+			return;
+		}
+		std::vector<float> descriptors;
+		blockHog.compute(levelImg, descriptors, hog.blockStride, cv::Size(0, 0));
+		level.numBlocks = cv::Size(
+			(level.imgSize.width - hog.blockSize.width) / hog.blockStride.width + 1,
+			(level.imgSize.height - hog.blockSize.height) / hog.blockStride.height + 1
+		);
+		level.blocks = cv::Mat(descriptors, true).reshape(1, level.numBlocks.area());
+	}
+};
+
+#endif
@@ -1,10 +1,12 @@
 #include "objdetect.h"
 #include "CascadeClassifier.h"
 #include "HOGDescriptor.h"
+#include "HOGFeaturePyramid.h"
 #include "DetectionROI.h"
 
 NAN_MODULE_INIT(Objdetect::Init) {
 	CascadeClassifier::Init(target);
 	HOGDescriptor::Init(target);
+	HOGFeaturePyramid::Init(target);
 	DetectionROI::Init(target);
 };
\ No newline at end of file
@@ -17,6 +17,8 @@ NAN_MODULE_INIT(OCRHMMDecoder::Init) {
   Nan::SetPrototypeMethod(ctor, "runAsync", RunAsync);
   Nan::SetPrototypeMethod(ctor, "runWithInfo", RunWithInfo);
   Nan::SetPrototypeMethod(ctor, "runWithInfoAsync", RunWithInfoAsync);
+  Nan::SetPrototypeMethod(ctor, "runBatch", RunBatch);
+  Nan::SetPrototypeMethod(ctor, "runBatchAsync", RunBatchAsync);
 
   Nan::Set(target,FF::newString("OCRHMMDecoder"), FF::getFunction(ctor));
 };
@@ -31,15 +33,23 @@ NAN_METHOD(OCRHMMDecoder::New) {
 	}
 
 	OCRHMMDecoder* self = new OCRHMMDecoder();
-	self->setNativeObject(cv::text::OCRHMMDecoder::create(
-		worker.classifier,
-		worker.vocabulary,
-		worker.transition_probabilities_table,
-		worker.emission_probabilities_table
+	cv::Ptr<cv::text::OCRHMMDecoder::ClassifierCallback> classifier = worker.classifier;
+	std::string vocabulary = worker.vocabulary;
+	cv::Mat transition_probabilities_table = worker.transition_probabilities_table;
+	cv::Mat emission_probabilities_table = worker.emission_probabilities_table;
+	int mode = worker.mode;
+	self->createDecoder = [=]() {
+		return cv::text::OCRHMMDecoder::create(
+			classifier,
+			vocabulary,
+			transition_probabilities_table,
+			emission_probabilities_table
 #if CV_MINOR_VERSION > 0
-		, worker.mode
+			, mode
 #endif
-	));
+		);
+	};
+	self->setNativeObject(self->createDecoder());
 
 	self->Wrap(info.Holder());
 	info.GetReturnValue().Set(info.Holder());
@@ -77,4 +87,20 @@ NAN_METHOD(OCRHMMDecoder::RunWithInfoAsync) {
   );
 }
 
+NAN_METHOD(OCRHMMDecoder::RunBatch) {
+  FF::SyncBindingBase(
+    std::make_shared<OCRHMMDecoderBindings::RunBatchWorker>(OCRHMMDecoder::unwrapThis(info)->createDecoder),
+    "OCRHMMDecoder::RunBatch",
+    info
+  );
+}
+
+NAN_METHOD(OCRHMMDecoder::RunBatchAsync) {
+  FF::AsyncBindingBase(
+    std::make_shared<OCRHMMDecoderBindings::RunBatchWorker>(OCRHMMDecoder::unwrapThis(info)->createDecoder),
+    "OCRHMMDecoder::RunBatchAsync",
+    info
+  );
+}
+
 #endif
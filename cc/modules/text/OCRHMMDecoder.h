@@ -5,6 +5,7 @@
 #include "Mat.h"
 #include "Rect.h"
 #include <opencv2/text.hpp>
+#include <functional>
 
 #ifndef __FF_OCRHMMDECODER_H__
 #define __FF_OCRHMMDECODER_H__
@@ -17,6 +18,9 @@ public:
 		return "OCRHMMDecoder";
 	}
 
+	// creates a decoder sharing the classifier and probability tables, used for decoding concurrently
+	std::function<cv::Ptr<cv::text::OCRHMMDecoder>()> createDecoder;
+
 	static NAN_MODULE_INIT(Init);
 
 	static NAN_METHOD(New);
@@ -24,6 +28,8 @@ public:
 	static NAN_METHOD(RunAsync);
 	static NAN_METHOD(RunWithInfo);
 	static NAN_METHOD(RunWithInfoAsync);
+	static NAN_METHOD(RunBatch);
+	static NAN_METHOD(RunBatchAsync);
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "OCRHMMDecoder.h"
+#include "parallelUtils.h"
 
 #ifndef __FF_OCRHMMDECODERBINDINGS_H_
 #define __FF_OCRHMMDECODERBINDINGS_H_
@@ -133,7 +134,82 @@ namespace OCRHMMDecoderBindings {
       );
     }
   };
-  
+
+  /* decodes the crops concurrently, the crops are distributed over one decoder per thread, which share
+     the classifier and probability tables, since a decoder must not be run concurrently */
+  struct RunBatchWorker : public CatchCvExceptionWorker {
+  public:
+    std::function<cv::Ptr<cv::text::OCRHMMDecoder>()> createDecoder;
+
+    RunBatchWorker(std::function<cv::Ptr<cv::text::OCRHMMDecoder>()> createDecoder) {
+      this->createDecoder = createDecoder;
+    }
+
+    std::vector<cv::Mat> imgs;
+    int component_level = 0;
+    int concurrency = 0;
+
+    struct Result {
+      std::string output_text;
+      std::vector<cv::Rect> component_rects;
+      std::vector<std::string> component_texts;
+      std::vector<float> component_confidences;
+    };
+
+    std::vector<Result> results;
+
+    std::string executeCatchCvExceptionWorker() {
+      results.resize(imgs.size());
+      if (imgs.size() == 0) {
+        return "";
+      }
+      int numStripes = ParallelUtils::getNumStripes((int)imgs.size(), concurrency);
+      return ParallelUtils::forEachStripe(numStripes, [&](int s) {
+        cv::Ptr<cv::text::OCRHMMDecoder> decoder = createDecoder();
+        for (size_t i = s; i < imgs.size(); i += numStripes) {
+          Result& result = results[i];
+          decoder->run(imgs[i], result.output_text, &result.component_rects, &result.component_texts,
+            &result.component_confidences, component_level);
+        }
+      });
+    }
+
+    v8::Local<v8::Value> getReturnValue() {
+      v8::Local<v8::Array> ret = Nan::New<v8::Array>(results.size());
+      for (size_t i = 0; i < results.size(); i++) {
+        v8::Local<v8::Object> jsResult = Nan::New<v8::Object>();
+        Nan::Set(jsResult, FF::newString("outputText"), FF::StringConverter::wrap(results[i].output_text));
+        Nan::Set(jsResult, FF::newString("rects"), Rect::ArrayWithCastConverter<cv::Rect>::wrap(results[i].component_rects));
+        Nan::Set(jsResult, FF::newString("words"), FF::StringArrayConverter::wrap(results[i].component_texts));
+        Nan::Set(jsResult, FF::newString("confidences"), FF::FloatArrayConverter::wrap(results[i].component_confidences));
+        Nan::Set(ret, i, jsResult);
+      }
+      return ret;
+    }
+
+    bool unwrapRequiredArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return Mat::ArrayConverter::arg(0, &imgs, info);
+    }
+
+    bool unwrapOptionalArgs(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return (
+        FF::IntConverter::optArg(1, &component_level, info) ||
+        FF::IntConverter::optArg(2, &concurrency, info)
+      );
+    }
+
+    bool hasOptArgsObject(Nan::NAN_METHOD_ARGS_TYPE info) {
+      return FF::isArgObject(info, 1);
+    }
+
+    bool unwrapOptionalArgsFromOpts(Nan::NAN_METHOD_ARGS_TYPE info) {
+      v8::Local<v8::Object> opts = info[1]->ToObject(Nan::GetCurrentContext()).ToLocalChecked();
+      return (
+        FF::IntConverter::optProp(&component_level, "componentLevel", opts) ||
+        FF::IntConverter::optProp(&concurrency, "concurrency", opts)
+      );
+    }
+  };
 
 }
 
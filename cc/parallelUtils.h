@@ -0,0 +1,44 @@
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#ifndef __FF_PARALLELUTILS_H__
+#define __FF_PARALLELUTILS_H__
+
+/* helpers for running the work of a batch worker with cv::parallel_for_. Exceptions thrown from within
+   parallel_for_ are not propagated to the caller on all backends (with some backends they terminate the
+   process), hence the body of each stripe is run inside a try block and the message of the first error
+   is returned to the worker instead. */
+namespace ParallelUtils {
+
+  // number of stripes to split numItems items into, concurrency if positive, otherwise one per thread
+  static inline int getNumStripes(int numItems, int concurrency) {
+    int numThreads = concurrency > 0 ? concurrency : std::max(cv::getNumThreads(), 1);
+    return std::min(numItems, numThreads);
+  }
+
+  // calls func(stripeIdx) for each of the numStripes stripes in parallel, returns the first error or ""
+  template<class StripeFunc>
+  static inline std::string forEachStripe(int numStripes, StripeFunc func) {
+    std::mutex mutex;
+    std::string err;
+    cv::parallel_for_(cv::Range(0, numStripes), [&](const cv::Range& range) {
+      for (int s = range.start; s < range.end; s++) {
+        try {
+          func(s);
+        }
+        catch (std::exception& e) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (err.empty()) {
+            err = e.what();
+          }
+        }
+      }
+    }, numStripes);
+    return err;
+  }
+
+}
+
+#endif
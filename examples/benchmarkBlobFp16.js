@@ -0,0 +1,37 @@
+const path = require('path');
+const cv = require('../');
+
+// compares CV_32F against CV_16F blobs from blobFromImages, optionally including a forward pass of
+// a tensorflow model given as first argument: node benchmarkBlobFp16.js <frozen_graph.pb>
+if (cv.CV_16F === undefined) {
+  console.log('CV_16F blobs require OpenCV 4');
+  process.exit(0);
+}
+
+const batchSize = 16;
+const size = new cv.Size(300, 300);
+const image = cv.imread(path.resolve(__dirname, '../data/Lenna.png'));
+const images = Array(batchSize).fill(image);
+const modelPath = process.argv[2];
+const net = modelPath ? cv.readNetFromTensorflow(modelPath) : null;
+
+const timeIt = (name, fn) => {
+  // warm up the thread pool
+  fn();
+  const start = process.hrtime();
+  const result = fn();
+  const diff = process.hrtime(start);
+  console.log(`${name}: ${(diff[0] * 1e3 + diff[1] / 1e6).toFixed(1)} ms`);
+  return result;
+};
+
+[['fp32', cv.CV_32F], ['fp16', cv.CV_16F]].forEach(([name, ddepth]) => {
+  const blob = timeIt(`blobFromImages ${name}`, () => cv.blobFromImages(images, { size, ddepth }));
+  console.log(`blob ${name}: ${blob.getData().length} bytes`);
+  if (net) {
+    timeIt(`setInput and forward ${name}`, () => {
+      net.setInput(blob);
+      return net.forward();
+    });
+  }
+});
@@ -0,0 +1,32 @@
+const crypto = require('crypto');
+const cv = require('../');
+
+// compares matchKnnBruteForceHammingBlocked against cv::BFMatcher on random 256 bit descriptors
+const numQuery = 1000;
+const numTrain = 100000;
+const descriptorBytes = 32;
+const k = 2;
+
+const randomDescriptors = rows =>
+  new cv.Mat(crypto.randomBytes(rows * descriptorBytes), rows, descriptorBytes, cv.CV_8U);
+
+const query = randomDescriptors(numQuery);
+const train = randomDescriptors(numTrain);
+
+const timeIt = (name, fn) => {
+  // warm up the thread pool
+  fn();
+  const start = process.hrtime();
+  const result = fn();
+  const diff = process.hrtime(start);
+  console.log(`${name}: ${(diff[0] * 1e3 + diff[1] / 1e6).toFixed(1)} ms`);
+  return result;
+};
+
+const expected = timeIt('matchKnnBruteForceHamming', () => cv.matchKnnBruteForceHamming(query, train, k));
+const blocked = timeIt('matchKnnBruteForceHammingBlocked', () => cv.matchKnnBruteForceHammingBlocked(query, train, k));
+
+const numMismatches = expected.filter((matches, i) =>
+  matches.some((match, j) => match.distance !== blocked[i][j].distance)
+).length;
+console.log(`queries with different distances: ${numMismatches}`);
@@ -64,63 +64,36 @@ const classifyImg = img => {
   const layerOutputs = net.forward(layerNames);
   console.timeEnd("net.forward");
 
-  let boxes = [];
-  let confidences = [];
-  let classIDs = [];
-
-  layerOutputs.forEach(mat => {
-    const output = mat.getDataAsArray();
-    output.forEach(detection => {
-      const scores = detection.slice(5);
-      const classId = scores.indexOf(Math.max(...scores));
-      const confidence = scores[classId];
-
-      if (confidence > minConfidence) {
-        const box = detection.slice(0, 4);
-
-        const centerX = parseInt(box[0] * imgWidth);
-        const centerY = parseInt(box[1] * imgHeight);
-        const width = parseInt(box[2] * imgWidth);
-        const height = parseInt(box[3] * imgHeight);
-
-        const x = parseInt(centerX - width / 2);
-        const y = parseInt(centerY - height / 2);
-
-        boxes.push(new cv.Rect(x, y, width, height));
-        confidences.push(confidence);
-        classIDs.push(classId);
-
-        const indices = cv.NMSBoxes(
-          boxes,
-          confidences,
-          minConfidence,
-          nmsThreshold
-        );
-
-        indices.forEach(i => {
-          const rect = boxes[i];
-
-          const pt1 = new cv.Point(rect.x, rect.y);
-          const pt2 = new cv.Point(rect.x + rect.width, rect.y + rect.height);
-          const rectColor = new cv.Vec(255, 0, 0);
-          const rectThickness = 2;
-          const rectLineType = cv.LINE_8;
-
-          // draw the rect for the object
-          img.drawRectangle(pt1, pt2, rectColor, rectThickness, rectLineType);
-
-          const text = labels[classIDs[i]];
-          const org = new cv.Point(rect.x, rect.y + 15);
-          const fontFace = cv.FONT_HERSHEY_SIMPLEX;
-          const fontScale = 0.5;
-          const textColor = new cv.Vec(123, 123, 255);
-          const thickness = 2;
-
-          // put text on the object
-          img.putText(text, org, fontFace, fontScale, textColor, thickness);
-        });
-      }
-    });
+  // decode the raw outputs and apply non maximum suppression natively,
+  // boxes are packed as [x, y, width, height] per detection
+  const { boxes, classIds } = cv.decodeDetections(layerOutputs, {
+    format: "yolo",
+    confThreshold: minConfidence,
+    nmsThreshold,
+    inputSize: new cv.Size(imgWidth, imgHeight)
+  });
+
+  classIds.forEach((classId, i) => {
+    const [x, y, width, height] = boxes.subarray(4 * i, 4 * i + 4).map(Math.round);
+
+    const pt1 = new cv.Point(x, y);
+    const pt2 = new cv.Point(x + width, y + height);
+    const rectColor = new cv.Vec(255, 0, 0);
+    const rectThickness = 2;
+    const rectLineType = cv.LINE_8;
+
+    // draw the rect for the object
+    img.drawRectangle(pt1, pt2, rectColor, rectThickness, rectLineType);
+
+    const text = labels[classId];
+    const org = new cv.Point(x, y + 15);
+    const fontFace = cv.FONT_HERSHEY_SIMPLEX;
+    const fontScale = 0.5;
+    const textColor = new cv.Vec(123, 123, 255);
+    const thickness = 2;
+
+    // put text on the object
+    img.putText(text, org, fontFace, fontScale, textColor, thickness);
   });
 
   cv.imshow("Darknet YOLO Object Detection", img);
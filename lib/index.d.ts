@@ -20,10 +20,15 @@ export * from './typings/FaceRecognizer.d';
 export * from './typings/EigenFaceRecognizer.d';
 export * from './typings/LBPHFaceRecognizer.d';
 export * from './typings/FisherFaceRecognizer.d';
+export * from './typings/FaceGallery.d';
 export * from './typings/KeyPointDetector.d';
 export * from './typings/FeatureDetector.d';
 export * from './typings/AGASTDetector.d';
 export * from './typings/BFMatcher.d';
+export * from './typings/DescriptorIndex.d';
+export * from './typings/BOWKMeansTrainer.d';
+export * from './typings/BOWImgDescriptorExtractor.d';
+export * from './typings/BOWIndex.d';
 export * from './typings/AKAZEDetector.d';
 export * from './typings/BRISKDetector.d';
 export * from './typings/DescriptorMatch.d';
@@ -42,9 +47,18 @@ export * from './typings/TrainData.d';
 export * from './typings/CascadeClassifier.d';
 export * from './typings/DetectionROI.d';
 export * from './typings/HOGDescriptor.d';
+export * from './typings/HOGFeaturePyramid.d';
 export * from './typings/OCRHMMClassifier.d';
 export * from './typings/MultiTracker.d';
+export * from './typings/StatModel.d';
+export * from './typings/DTreesParams.d';
 export * from './typings/SVM.d';
+export * from './typings/RTrees.d';
+export * from './typings/Boost.d';
+export * from './typings/KNearest.d';
+export * from './typings/LogisticRegression.d';
+export * from './typings/NormalBayesClassifier.d';
+export * from './typings/ANN_MLP.d';
 export * from './typings/OCRHMMDecoder.d';
 export * from './typings/TrackerBoostingParams.d';
 export * from './typings/TrackerGOTURN.d';
@@ -0,0 +1,34 @@
+import { Mat } from './Mat.d';
+import { TermCriteria } from './TermCriteria.d';
+import { StatModel } from './StatModel.d';
+
+export interface ANN_MLPParams {
+  layerSizes?: number[];
+  activationFunction?: number;
+  activationParam1?: number;
+  activationParam2?: number;
+  trainMethod?: number;
+  termCriteria?: TermCriteria;
+  backpropWeightScale?: number;
+  backpropMomentumScale?: number;
+  rpropDW0?: number;
+  rpropDWPlus?: number;
+  rpropDWMinus?: number;
+  rpropDWMin?: number;
+  rpropDWMax?: number;
+}
+
+export class ANN_MLP extends StatModel {
+  readonly layerSizes: Mat;
+  readonly trainMethod: number;
+  readonly termCriteria: TermCriteria;
+  readonly backpropWeightScale: number;
+  readonly backpropMomentumScale: number;
+  readonly rpropDW0: number;
+  readonly rpropDWPlus: number;
+  readonly rpropDWMinus: number;
+  readonly rpropDWMin: number;
+  readonly rpropDWMax: number;
+  constructor(layerSizes?: number[], activationFunction?: number, trainMethod?: number);
+  constructor(params: ANN_MLPParams);
+}
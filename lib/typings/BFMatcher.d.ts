@@ -1,5 +1,6 @@
 import {Mat} from "./Mat";
-import {DescriptorMatch} from "./DescriptorMatch";
+import {DescriptorMatch, PackedDescriptorMatches, MatchKnnBatchOptions, ImageMatchScore, MatchFilterOptions} from "./DescriptorMatch";
+import {DescriptorIndex} from "./DescriptorIndex";
 
 export class BFMatcher {
     constructor(normType: number, crossCheck?: boolean);
@@ -8,4 +9,20 @@ export class BFMatcher {
     matchAsync(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
     knnMatch(descriptors1: Mat, descriptors2: Mat, k: number): Array<[DescriptorMatch]|[any]>;
     knnMatchAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<Array<[DescriptorMatch]|[any]>>;
+    match(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+    matchAsync(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+    knnMatch(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+    knnMatchAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+    match(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+    matchAsync(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+    knnMatch(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+    knnMatchAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+    radiusMatch(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+    radiusMatch(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+    radiusMatch(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+    radiusMatchAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+    radiusMatchAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+    radiusMatchAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+    knnMatchBatch(queryDescriptors: Mat, trainDescriptors: Mat[] | DescriptorIndex, opts?: MatchKnnBatchOptions): ImageMatchScore[];
+    knnMatchBatchAsync(queryDescriptors: Mat, trainDescriptors: Mat[] | DescriptorIndex, opts?: MatchKnnBatchOptions): Promise<ImageMatchScore[]>;
 }
@@ -0,0 +1,14 @@
+import { Mat } from './Mat.d';
+import { KeyPoint } from './KeyPoint.d';
+import { FeatureDetector } from './FeatureDetector.d';
+
+export class BOWImgDescriptorExtractor {
+  readonly vocabulary: Mat;
+  readonly descriptorSize: number;
+  constructor(detector: FeatureDetector, vocabulary?: Mat);
+  setVocabulary(vocabulary: Mat): void;
+  compute(img: Mat, keyPoints?: KeyPoint[] | Float32Array): Mat;
+  computeAsync(img: Mat, keyPoints?: KeyPoint[] | Float32Array): Promise<Mat>;
+  computeFromDescriptors(descriptors: Mat): Mat;
+  computeFromDescriptorsAsync(descriptors: Mat): Promise<Mat>;
+}
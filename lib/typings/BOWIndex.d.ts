@@ -0,0 +1,18 @@
+import { Mat } from './Mat.d';
+
+export interface BOWIndexResult {
+  imageId: number;
+  score: number;
+}
+
+export class BOWIndex {
+  readonly vocabularySize: number;
+  readonly numImages: number;
+  readonly imageIds: number[];
+  constructor(vocabularySize: number);
+  add(imageId: number, histogram: Mat): void;
+  remove(imageId: number): boolean;
+  clear(): void;
+  query(histogram: Mat, topK?: number): BOWIndexResult[];
+  queryAsync(histogram: Mat, topK?: number): Promise<BOWIndexResult[]>;
+}
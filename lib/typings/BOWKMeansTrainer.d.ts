@@ -0,0 +1,21 @@
+import { Mat } from './Mat.d';
+import { TermCriteria } from './TermCriteria.d';
+
+export interface BOWKMeansTrainerParams {
+  termCriteria?: TermCriteria;
+  attempts?: number;
+  flags?: number;
+}
+
+export class BOWKMeansTrainer {
+  readonly clusterCount: number;
+  readonly attempts: number;
+  readonly flags: number;
+  readonly descriptorsCount: number;
+  constructor(clusterCount: number, termCriteria?: TermCriteria, attempts?: number, flags?: number);
+  constructor(clusterCount: number, params: BOWKMeansTrainerParams);
+  add(descriptors: Mat): void;
+  clear(): void;
+  cluster(): Mat;
+  clusterAsync(): Promise<Mat>;
+}
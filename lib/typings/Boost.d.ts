@@ -0,0 +1,17 @@
+import { StatModel } from './StatModel.d';
+import { DTreesParams } from './DTreesParams.d';
+
+export class Boost extends StatModel {
+  readonly maxCategories: number;
+  readonly maxDepth: number;
+  readonly minSampleCount: number;
+  readonly cvFolds: number;
+  readonly useSurrogates: boolean;
+  readonly use1SERule: boolean;
+  readonly truncatePrunedTree: boolean;
+  readonly regressionAccuracy: number;
+  readonly boostType: number;
+  readonly weakCount: number;
+  readonly weightTrimRate: number;
+  constructor(params?: DTreesParams & { boostType?: number, weakCount?: number, weightTrimRate?: number });
+}
@@ -0,0 +1,10 @@
+export interface DTreesParams {
+  maxCategories?: number;
+  maxDepth?: number;
+  minSampleCount?: number;
+  cvFolds?: number;
+  useSurrogates?: boolean;
+  use1SERule?: boolean;
+  truncatePrunedTree?: boolean;
+  regressionAccuracy?: number;
+}
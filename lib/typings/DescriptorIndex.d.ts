@@ -0,0 +1,40 @@
+import { Mat } from './Mat.d';
+import { DescriptorMatch, PackedDescriptorMatches } from './DescriptorMatch.d';
+
+export interface DescriptorIndexParams {
+  algorithm?: 'kdtree' | 'lsh' | 'bruteforce';
+  normType?: number;
+  trees?: number;
+  checks?: number;
+  eps?: number;
+  tableNumber?: number;
+  keySize?: number;
+  multiProbeLevel?: number;
+}
+
+export class DescriptorIndex {
+  readonly algorithm: string;
+  readonly isTrained: boolean;
+  readonly numImages: number;
+  readonly numDescriptors: number;
+  readonly imageIds: number[];
+  constructor(algorithm?: 'kdtree' | 'lsh' | 'bruteforce');
+  constructor(params: DescriptorIndexParams);
+  add(descriptors: Mat, imageId?: number): void;
+  add(descriptors: Mat[], imageIds?: number[]): void;
+  clear(): void;
+  train(): void;
+  trainAsync(): Promise<void>;
+  knnMatch(queryDescriptors: Mat, k: number): DescriptorMatch[][];
+  knnMatch(queryDescriptors: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+  knnMatchAsync(queryDescriptors: Mat, k: number): Promise<DescriptorMatch[][]>;
+  knnMatchAsync(queryDescriptors: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+  radiusMatch(queryDescriptors: Mat, maxDistance: number, opts?: { maxResults?: number, packed?: false }): DescriptorMatch[][];
+  radiusMatch(queryDescriptors: Mat, maxDistance: number, opts: { maxResults?: number, packed: true }): PackedDescriptorMatches;
+  radiusMatchAsync(queryDescriptors: Mat, maxDistance: number, opts?: { maxResults?: number, packed?: false }): Promise<DescriptorMatch[][]>;
+  radiusMatchAsync(queryDescriptors: Mat, maxDistance: number, opts: { maxResults?: number, packed: true }): Promise<PackedDescriptorMatches>;
+  save(path: string): void;
+  saveAsync(path: string): Promise<void>;
+  load(path: string): void;
+  loadAsync(path: string): Promise<void>;
+}
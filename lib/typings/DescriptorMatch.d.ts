@@ -1,5 +1,44 @@
+import { Mat } from './Mat.d';
+import { KeyPoint } from './KeyPoint.d';
+
 export class DescriptorMatch {
   readonly queryIdx: number;
   readonly trainIdx: number;
   readonly distance: number;
 }
+
+export interface PackedDescriptorMatches {
+  queryIdx: Int32Array;
+  trainIdx: Int32Array;
+  imgIdx: Int32Array;
+  distance: Float32Array;
+}
+
+export interface MatchKnnBatchOptions {
+  k?: number;
+  ratio?: number;
+  crossCheck?: boolean;
+  maxDistance?: number;
+  topK?: number;
+  minMatches?: number;
+  normType?: number;
+  queryKeyPoints?: KeyPoint[] | Float32Array;
+  trainKeyPoints?: Array<KeyPoint[] | Float32Array>;
+  ransacReprojThreshold?: number;
+  packed?: boolean;
+}
+
+export interface ImageMatchScore {
+  imgIdx: number;
+  imageId: number;
+  numInliers: number;
+  matches: DescriptorMatch[] | PackedDescriptorMatches;
+  homography?: Mat;
+}
+
+export interface MatchFilterOptions {
+  // ratio test against the second best match, requires knnMatch with k >= 2 or radiusMatch, match throws if ratio < 1
+  ratio?: number;
+  crossCheck?: boolean;
+  maxDistance?: number;
+}
@@ -0,0 +1,28 @@
+import { Mat } from './Mat.d';
+
+export interface FaceGalleryMatch {
+  id: number;
+  distance: number;
+}
+
+export class FaceGallery {
+  readonly dims: number;
+  readonly metric: string;
+  readonly numEmbeddings: number;
+  readonly numIds: number;
+  constructor(dims: number, metric?: string);
+  constructor(dims: number, opts: { metric?: string });
+  add(id: number, embeddings: Mat): void;
+  add(ids: number[], embeddings: Mat): void;
+  remove(id: number): number;
+  remove(ids: number[]): number;
+  clear(): void;
+  query(queries: Mat, topK?: number): FaceGalleryMatch[][];
+  query(queries: Mat, opts: { topK?: number }): FaceGalleryMatch[][];
+  queryAsync(queries: Mat, topK?: number): Promise<FaceGalleryMatch[][]>;
+  queryAsync(queries: Mat, opts: { topK?: number }): Promise<FaceGalleryMatch[][]>;
+  save(file: string): void;
+  saveAsync(file: string): Promise<void>;
+  load(file: string): void;
+  loadAsync(file: string): Promise<void>;
+}
@@ -1,10 +1,27 @@
 import { Mat } from './Mat';
+import { SaveToBufferOptions } from './StatModel';
+
+export interface FaceRecognizerBatchResult {
+  labels: number[];
+  confidences: number[];
+  nearest?: { label: number, confidence: number }[][];
+}
 
 export class FaceRecognizer {
   load(file: string): void;
+  loadFromBuffer(buf: Buffer): void;
+  loadFromBufferAsync(buf: Buffer): Promise<void>;
   predict(img: Mat): { label: number, confidence: number };
   predictAsync(img: Mat): Promise<{ label: number, confidence: number }>;
+  predictBatch(imgs: Mat[], topK?: number): FaceRecognizerBatchResult;
+  predictBatch(imgs: Mat[], opts: { topK?: number }): FaceRecognizerBatchResult;
+  predictBatchAsync(imgs: Mat[], topK?: number): Promise<FaceRecognizerBatchResult>;
+  predictBatchAsync(imgs: Mat[], opts: { topK?: number }): Promise<FaceRecognizerBatchResult>;
   save(file: string): void;
+  saveToBuffer(format?: string): Buffer;
+  saveToBuffer(opts: SaveToBufferOptions): Buffer;
+  saveToBufferAsync(format?: string): Promise<Buffer>;
+  saveToBufferAsync(opts: SaveToBufferOptions): Promise<Buffer>;
   train(trainImages: Mat[], labels: number[]): void;
   trainAsync(trainImages: Mat[], labels: number[]): Promise<void>;
 }
\ No newline at end of file
@@ -2,6 +2,18 @@ import { Mat } from "./Mat.d";
 import { Rect } from "./Rect.d";
 import { Point2 } from "./Point2.d";
 
+export interface FacemarkFrame {
+  image: Mat;
+  faces: Rect[];
+}
+
+// landmarks holds packed x, y coordinates face after face, counts the number of landmarks of each face
+export interface FacemarkFrameResult {
+  landmarks: Float32Array;
+  counts: number[];
+  fitted: boolean;
+}
+
 export class Facemark {
   addTrainingSample(image: Mat, landmarks: number[][]): boolean;
   addTrainingSampleAsync(image: Mat, landmarks: number[][]): Promise<boolean>;
@@ -14,6 +26,10 @@ export class Facemark {
   trainingAsync(): Promise<void>;
   fit(image: Mat, faces: Rect[]): Point2[][];
   fitAsync(image: Mat, faces: Rect[]): Promise<Point2[][]>;
+  fitBatch(frames: FacemarkFrame[], concurrency?: number): FacemarkFrameResult[];
+  fitBatch(frames: FacemarkFrame[], opts: { concurrency?: number }): FacemarkFrameResult[];
+  fitBatchAsync(frames: FacemarkFrame[], concurrency?: number): Promise<FacemarkFrameResult[]>;
+  fitBatchAsync(frames: FacemarkFrame[], opts: { concurrency?: number }): Promise<FacemarkFrameResult[]>;
   save(file: string): void;
   load(file: string): void;
 }
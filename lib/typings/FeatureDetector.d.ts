@@ -2,7 +2,23 @@ import { KeyPointDetector } from './KeyPointDetector';
 import { KeyPoint } from './KeyPoint.d';
 import { Mat } from './Mat.d';
 
+export interface DetectGridOptions {
+  rows?: number;
+  cols?: number;
+  maxPerCell?: number;
+  overlap?: number;
+  dedupRadius?: number;
+}
+
 export class FeatureDetector extends KeyPointDetector {
-  compute(image: Mat, keypoints: KeyPoint[]): Mat;
-  computeAsync(image: Mat, keypoints: KeyPoint[]): Promise<Mat>;
+  compute(image: Mat, keypoints: KeyPoint[] | Float32Array): Mat;
+  computeAsync(image: Mat, keypoints: KeyPoint[] | Float32Array): Promise<Mat>;
+  detectAndCompute(image: Mat, mask?: Mat, retainBest?: number): { keyPoints: KeyPoint[], descriptors: Mat };
+  detectAndCompute(image: Mat, opts: { mask?: Mat, retainBest?: number, packed?: boolean }): { keyPoints: KeyPoint[] | Float32Array, descriptors: Mat };
+  detectAndComputeAsync(image: Mat, mask?: Mat, retainBest?: number): Promise<{ keyPoints: KeyPoint[], descriptors: Mat }>;
+  detectAndComputeAsync(image: Mat, opts: { mask?: Mat, retainBest?: number, packed?: boolean }): Promise<{ keyPoints: KeyPoint[] | Float32Array, descriptors: Mat }>;
+  detectGrid(image: Mat, opts?: DetectGridOptions & { packed?: false }): KeyPoint[];
+  detectGrid(image: Mat, opts: DetectGridOptions & { packed: true }): Float32Array;
+  detectGridAsync(image: Mat, opts?: DetectGridOptions & { packed?: false }): Promise<KeyPoint[]>;
+  detectGridAsync(image: Mat, opts: DetectGridOptions & { packed: true }): Promise<Float32Array>;
 }
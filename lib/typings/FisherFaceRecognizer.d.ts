@@ -1,5 +1,8 @@
 import { FaceRecognizer } from './FaceRecognizer';
+import { Mat } from './Mat.d';
 
 export class FisherFaceRecognizer extends FaceRecognizer {
   constructor(num_components?: number, threshold?: number);
+  project(images: Mat[]): Mat;
+  projectAsync(images: Mat[]): Promise<Mat>;
 }
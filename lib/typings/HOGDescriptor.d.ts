@@ -2,6 +2,7 @@ import { Mat } from './Mat.d';
 import { Size } from './Size.d';
 import { Rect } from './Rect.d';
 import { Point2 } from './Point2.d';
+import { HOGFeaturePyramid } from './HOGFeaturePyramid.d';
 
 export class HOGDescriptor {
   readonly winSize: Size;
@@ -21,12 +22,22 @@ export class HOGDescriptor {
   checkDetectorSize(): boolean;
   compute(img: Mat, winStride?: Size, padding?: Size, locations?: Point2[]): number[];
   computeAsync(img: Mat, winStride?: Size, padding?: Size, locations?: Point2[]): Promise<number[]>;
+  computeBatch(samples: Mat[] | { image: Mat, locations?: Point2[] }[] | { image: Mat, locations?: Point2[] }, winStride?: Size, padding?: Size): Mat;
+  computeBatch(samples: Mat[] | { image: Mat, locations?: Point2[] }[] | { image: Mat, locations?: Point2[] }, opts: { winStride?: Size, padding?: Size }): Mat;
+  computeBatchAsync(samples: Mat[] | { image: Mat, locations?: Point2[] }[] | { image: Mat, locations?: Point2[] }, winStride?: Size, padding?: Size): Promise<Mat>;
+  computeBatchAsync(samples: Mat[] | { image: Mat, locations?: Point2[] }[] | { image: Mat, locations?: Point2[] }, opts: { winStride?: Size, padding?: Size }): Promise<Mat>;
   computeGradient(img: Mat, paddingTL?: Size, paddingBR?: Size): { grad: Mat, angleOfs: Mat };
   computeGradientAsync(img: Mat, paddingTL?: Size, paddingBR?: Size): Promise<{ grad: Mat, angleOfs: Mat }>;
   detect(img: Mat, hitThreshold?: number, winStride?: Size, padding?: Size, searchLocations?: Point2[]): { foundLocations: Point2[], weights: number[] };
   detectAsync(img: Mat, hitThreshold?: number, winStride?: Size, padding?: Size, searchLocations?: Point2[]): Promise<{ foundLocations: Point2[], weights: number[] }>;
   detectMultiScale(img: Mat, hitThreshold?: number, winStride?: Size, padding?: Size, scale?: number, finalThreshold?: number, useMeanshiftGrouping?: boolean): { foundLocations: Rect[], foundWeights: number[] };
   detectMultiScaleAsync(img: Mat, hitThreshold?: number, winStride?: Size, padding?: Size, scale?: number, finalThreshold?: number, useMeanshiftGrouping?: boolean): Promise<{ foundLocations: Rect[], foundWeights: number[] }>;
+  detectMultiScaleBatch(images: Mat[], hitThreshold?: number, winStride?: Size, padding?: Size, scale?: number, finalThreshold?: number, useMeanshiftGrouping?: boolean): { foundLocations: Rect[], foundWeights: number[] }[];
+  detectMultiScaleBatchAsync(images: Mat[], hitThreshold?: number, winStride?: Size, padding?: Size, scale?: number, finalThreshold?: number, useMeanshiftGrouping?: boolean): Promise<{ foundLocations: Rect[], foundWeights: number[] }[]>;
+  computeFeaturePyramid(img: Mat, scale?: number, nlevels?: number): HOGFeaturePyramid;
+  computeFeaturePyramid(img: Mat, opts: { scale?: number, nlevels?: number, scales?: number[] }): HOGFeaturePyramid;
+  computeFeaturePyramidAsync(img: Mat, scale?: number, nlevels?: number): Promise<HOGFeaturePyramid>;
+  computeFeaturePyramidAsync(img: Mat, opts: { scale?: number, nlevels?: number, scales?: number[] }): Promise<HOGFeaturePyramid>;
   detectMultiScaleROI(img: Mat, hitThreshold?: number, groupThreshold?: number): Rect[];
   detectMultiScaleROIAsync(img: Mat, hitThreshold?: number, groupThreshold?: number): Promise<Rect[]>;
   detectROI(img: Mat, locations: Point2[], hitThreshold?: number, winStride?: Size, padding?: Size): { foundLocations: Point2[], confidences: number[] };
@@ -0,0 +1,17 @@
+import { Size } from './Size.d';
+import { Rect } from './Rect.d';
+import { Point2 } from './Point2.d';
+import { DetectionROI } from './DetectionROI.d';
+
+export class HOGFeaturePyramid {
+  readonly numLevels: number;
+  readonly scales: number[];
+  detect(hitThreshold?: number, winStride?: Size, scale?: number): { foundLocations: Point2[], weights: number[] };
+  detectAsync(hitThreshold?: number, winStride?: Size, scale?: number): Promise<{ foundLocations: Point2[], weights: number[] }>;
+  detectROI(locations: Point2[], hitThreshold?: number, scale?: number): { foundLocations: Point2[], confidences: number[] };
+  detectROIAsync(locations: Point2[], hitThreshold?: number, scale?: number): Promise<{ foundLocations: Point2[], confidences: number[] }>;
+  detectMultiScale(hitThreshold?: number, winStride?: Size, finalThreshold?: number, useMeanshiftGrouping?: boolean): { foundLocations: Rect[], foundWeights: number[] };
+  detectMultiScaleAsync(hitThreshold?: number, winStride?: Size, finalThreshold?: number, useMeanshiftGrouping?: boolean): Promise<{ foundLocations: Rect[], foundWeights: number[] }>;
+  detectMultiScaleROI(locations: DetectionROI[], hitThreshold?: number, groupThreshold?: number): Rect[];
+  detectMultiScaleROIAsync(locations: DetectionROI[], hitThreshold?: number, groupThreshold?: number): Promise<Rect[]>;
+}
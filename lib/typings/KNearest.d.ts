@@ -0,0 +1,14 @@
+import { Mat } from './Mat.d';
+import { StatModel } from './StatModel.d';
+
+export class KNearest extends StatModel {
+  readonly defaultK: number;
+  readonly emax: number;
+  readonly algorithmType: number;
+  constructor(defaultK?: number, isClassifier?: boolean);
+  constructor(params: { defaultK?: number, isClassifier?: boolean, emax?: number, algorithmType?: number });
+  findNearest(samples: Mat, k: number, chunkSize?: number): { results: Mat, neighborResponses: Mat, dists: Mat };
+  findNearest(samples: Mat, k: number, opts: { chunkSize?: number }): { results: Mat, neighborResponses: Mat, dists: Mat };
+  findNearestAsync(samples: Mat, k: number, chunkSize?: number): Promise<{ results: Mat, neighborResponses: Mat, dists: Mat }>;
+  findNearestAsync(samples: Mat, k: number, opts: { chunkSize?: number }): Promise<{ results: Mat, neighborResponses: Mat, dists: Mat }>;
+}
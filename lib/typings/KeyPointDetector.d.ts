@@ -4,4 +4,6 @@ import { Mat } from './Mat.d';
 export class KeyPointDetector {
   detect(image: Mat): KeyPoint[];
   detectAsync(image: Mat): Promise<KeyPoint[]>;
+  detect(image: Mat, opts: { packed: true }): Float32Array;
+  detectAsync(image: Mat, opts: { packed: true }): Promise<Float32Array>;
 }
@@ -1,5 +1,8 @@
+import { Mat } from './Mat';
 import { FaceRecognizer } from './FaceRecognizer';
 
 export class LBPHFaceRecognizer extends FaceRecognizer {
   constructor(radius?: number, neighbors?: number, grid_x?: number, grid_y?: number, threshold?: number);
+  update(trainImages: Mat[], labels: number[]): void;
+  updateAsync(trainImages: Mat[], labels: number[]): Promise<void>;
 }
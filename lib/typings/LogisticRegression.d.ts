@@ -0,0 +1,14 @@
+import { Mat } from './Mat.d';
+import { TermCriteria } from './TermCriteria.d';
+import { StatModel } from './StatModel.d';
+
+export class LogisticRegression extends StatModel {
+  readonly learningRate: number;
+  readonly iterations: number;
+  readonly regularization: number;
+  readonly trainMethod: number;
+  readonly miniBatchSize: number;
+  readonly termCriteria: TermCriteria;
+  readonly learntThetas: Mat;
+  constructor(params?: { learningRate?: number, iterations?: number, regularization?: number, trainMethod?: number, miniBatchSize?: number, termCriteria?: TermCriteria });
+}
@@ -1,10 +1,15 @@
 import { Mat } from './Mat.d';
 
 export class Net {
+  clone(): Net;
+  cloneAsync(): Promise<Net>;
   forward(inputName?: string): Mat;
   forward(outBlobNames?: string[]): Mat[];
   forwardAsync(inputName?: string): Promise<Mat>;
   forwardAsync(outBlobNames?: string[]): Promise<Mat[]>;
   setInput(blob: Mat, inputName?: string): void;
   setInputAsync(blob: Mat, inputName?: string): Promise<void>;
+  // leaves zero filled inputs set, call setInput before the next forward
+  warmup(inputShapes: number[] | number[][], inputNames?: string[]): void;
+  warmupAsync(inputShapes: number[] | number[][], inputNames?: string[]): Promise<void>;
 }
@@ -0,0 +1,10 @@
+import { Mat } from './Mat.d';
+import { StatModel } from './StatModel.d';
+
+export class NormalBayesClassifier extends StatModel {
+  constructor();
+  predictProb(samples: Mat, flags?: number): { outputs: Mat, outputProbs: Mat };
+  predictProb(samples: Mat, opts: { flags?: number, chunkSize?: number }): { outputs: Mat, outputProbs: Mat };
+  predictProbAsync(samples: Mat, flags?: number): Promise<{ outputs: Mat, outputProbs: Mat }>;
+  predictProbAsync(samples: Mat, opts: { flags?: number, chunkSize?: number }): Promise<{ outputs: Mat, outputProbs: Mat }>;
+}
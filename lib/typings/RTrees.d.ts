@@ -0,0 +1,24 @@
+import { Mat } from './Mat.d';
+import { TermCriteria } from './TermCriteria.d';
+import { StatModel } from './StatModel.d';
+import { DTreesParams } from './DTreesParams.d';
+
+export class RTrees extends StatModel {
+  readonly maxCategories: number;
+  readonly maxDepth: number;
+  readonly minSampleCount: number;
+  readonly cvFolds: number;
+  readonly useSurrogates: boolean;
+  readonly use1SERule: boolean;
+  readonly truncatePrunedTree: boolean;
+  readonly regressionAccuracy: number;
+  readonly calculateVarImportance: boolean;
+  readonly activeVarCount: number;
+  readonly termCriteria: TermCriteria;
+  readonly varImportance: Mat;
+  constructor(params?: DTreesParams & { calculateVarImportance?: boolean, activeVarCount?: number, termCriteria?: TermCriteria });
+  getVotes(samples: Mat, flags?: number): Mat;
+  getVotes(samples: Mat, opts: { flags?: number, chunkSize?: number }): Mat;
+  getVotesAsync(samples: Mat, flags?: number): Promise<Mat>;
+  getVotesAsync(samples: Mat, opts: { flags?: number, chunkSize?: number }): Promise<Mat>;
+}
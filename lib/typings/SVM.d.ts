@@ -1,6 +1,47 @@
 import { Mat } from './Mat.d';
 import { TrainData } from './TrainData.d';
 import { ParamGrid } from './ParamGrid.d';
+import { SaveToBufferOptions } from './StatModel.d';
+
+export interface SVMParams {
+  c: number;
+  gamma: number;
+  p: number;
+  nu: number;
+  coef0: number;
+  degree: number;
+}
+
+// the first progress is reported with numEvaluated 0 and without params and errors
+export interface TrainAutoParallelProgress {
+  numEvaluated: number;
+  numGridPoints: number;
+  params?: SVMParams;
+  error?: number;
+  bestParams?: SVMParams;
+  bestError?: number;
+}
+
+// the params and the error are omitted if the search was cancelled before a grid point was evaluated
+export interface TrainAutoParallelResult extends Partial<SVMParams> {
+  error?: number;
+  numEvaluated: number;
+  numGridPoints: number;
+  cancelled: boolean;
+  earlyStopped: boolean;
+}
+
+export interface TrainAutoParallelOptions {
+  kFold?: number;
+  cGrid?: ParamGrid;
+  gammaGrid?: ParamGrid;
+  pGrid?: ParamGrid;
+  nuGrid?: ParamGrid;
+  coeffGrid?: ParamGrid;
+  degreeGrid?: ParamGrid;
+  balanced?: boolean;
+  targetError?: number;
+}
 
 export class SVM {
   readonly c: number;
@@ -19,9 +60,23 @@ export class SVM {
   getSupportVectors(): Mat;
   getDecisionFunction(): { rho: number, alpha: Mat, svidx: Mat };
   load(file: string): void;
+  loadFromBuffer(buf: Buffer): void;
+  loadFromBufferAsync(buf: Buffer): Promise<void>;
   predict(sample: number[], flags?: number): number;
   predict(samples: Mat, flags?: number): number[];
+  predictAsync(sample: number[], flags?: number): Promise<number>;
+  predictAsync(samples: Mat, flags?: number): Promise<number[]>;
+  predictBatch(samples: Mat, flags?: number): Float32Array;
+  predictBatch(samples: Mat, opts: { flags?: number, rawOutput?: boolean, returnMat?: false, chunkSize?: number }): Float32Array;
+  predictBatch(samples: Mat, opts: { flags?: number, rawOutput?: boolean, returnMat: true, chunkSize?: number }): Mat;
+  predictBatchAsync(samples: Mat, flags?: number): Promise<Float32Array>;
+  predictBatchAsync(samples: Mat, opts: { flags?: number, rawOutput?: boolean, returnMat?: false, chunkSize?: number }): Promise<Float32Array>;
+  predictBatchAsync(samples: Mat, opts: { flags?: number, rawOutput?: boolean, returnMat: true, chunkSize?: number }): Promise<Mat>;
   save(file: string): void;
+  saveToBuffer(format?: string): Buffer;
+  saveToBuffer(opts: SaveToBufferOptions): Buffer;
+  saveToBufferAsync(format?: string): Promise<Buffer>;
+  saveToBufferAsync(opts: SaveToBufferOptions): Promise<Buffer>;
   setParams(c?: number, coef0?: number, degree?: number, gamma?: number, nu?: number, p?: number, kernelType?: number, classWeights?: Mat): void;
   train(trainData: TrainData, flags?: number): boolean;
   train(samples: Mat, layout: number, responses: Mat): boolean;
@@ -29,4 +84,6 @@ export class SVM {
   trainAsync(samples: Mat, layout: number, responses: Mat): Promise<boolean>;
   trainAuto(trainData: TrainData, kFold?: number, cGrid?: ParamGrid, gammaGrid?: ParamGrid, pGrid?: ParamGrid, nuGrid?: ParamGrid, coeffGrid?: ParamGrid, degreeGrid?: ParamGrid, balanced?: boolean): Mat;
   trainAutoAsync(trainData: TrainData, kFold?: number, cGrid?: ParamGrid, gammaGrid?: ParamGrid, pGrid?: ParamGrid, nuGrid?: ParamGrid, coeffGrid?: ParamGrid, degreeGrid?: ParamGrid, balanced?: boolean): Promise<Mat>;
+  trainAutoParallel(trainData: TrainData, opts?: TrainAutoParallelOptions): TrainAutoParallelResult;
+  trainAutoParallelAsync(trainData: TrainData, opts?: TrainAutoParallelOptions & { onProgress?: (progress: TrainAutoParallelProgress) => boolean | void }): Promise<TrainAutoParallelResult>;
 }
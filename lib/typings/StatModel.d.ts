@@ -0,0 +1,42 @@
+import { Mat } from './Mat.d';
+import { TrainData } from './TrainData.d';
+
+export interface PredictBatchOptions {
+  flags?: number;
+  rawOutput?: boolean;
+  chunkSize?: number;
+}
+
+export interface SaveToBufferOptions {
+  format?: 'xml' | 'yaml' | 'json';
+}
+
+export class StatModel {
+  readonly varCount: number;
+  readonly isTrained: boolean;
+  readonly isClassifier: boolean;
+  calcError(trainData: TrainData, test: boolean): { error: number, responses: Mat };
+  calcErrorAsync(trainData: TrainData, test: boolean): Promise<{ error: number, responses: Mat }>;
+  load(file: string): void;
+  loadFromBuffer(buf: Buffer): void;
+  loadFromBufferAsync(buf: Buffer): Promise<void>;
+  predict(sample: number[], flags?: number): number;
+  predict(samples: Mat, flags?: number): number[];
+  predictAsync(sample: number[], flags?: number): Promise<number>;
+  predictAsync(samples: Mat, flags?: number): Promise<number[]>;
+  predictBatch(samples: Mat, flags?: number): Float32Array;
+  predictBatch(samples: Mat, opts: PredictBatchOptions & { returnMat?: false }): Float32Array;
+  predictBatch(samples: Mat, opts: PredictBatchOptions & { returnMat: true }): Mat;
+  predictBatchAsync(samples: Mat, flags?: number): Promise<Float32Array>;
+  predictBatchAsync(samples: Mat, opts: PredictBatchOptions & { returnMat?: false }): Promise<Float32Array>;
+  predictBatchAsync(samples: Mat, opts: PredictBatchOptions & { returnMat: true }): Promise<Mat>;
+  save(file: string): void;
+  saveToBuffer(format?: string): Buffer;
+  saveToBuffer(opts: SaveToBufferOptions): Buffer;
+  saveToBufferAsync(format?: string): Promise<Buffer>;
+  saveToBufferAsync(opts: SaveToBufferOptions): Promise<Buffer>;
+  train(trainData: TrainData, flags?: number): boolean;
+  train(samples: Mat, layout: number, responses: Mat): boolean;
+  trainAsync(trainData: TrainData, flags?: number): Promise<boolean>;
+  trainAsync(samples: Mat, layout: number, responses: Mat): Promise<boolean>;
+}
@@ -33,6 +33,11 @@ export const CV_64FC1: number;
 export const CV_64FC2: number;
 export const CV_64FC3: number;
 export const CV_64FC4: number;
+export const CV_16F: number;
+export const CV_16FC1: number;
+export const CV_16FC2: number;
+export const CV_16FC3: number;
+export const CV_16FC4: number;
 
 export const ADAPTIVE_THRESH_GAUSSIAN_C: number;
 export const ADAPTIVE_THRESH_MEAN_C: number;
@@ -591,6 +596,45 @@ export const ml: {
     NU: number;
     P: number;
   }
+
+  DTrees: {
+    PREDICT_AUTO: number;
+    PREDICT_SUM: number;
+    PREDICT_MAX_VOTE: number;
+  }
+
+  Boost: {
+    DISCRETE: number;
+    REAL: number;
+    LOGIT: number;
+    GENTLE: number;
+  }
+
+  KNearest: {
+    BRUTE_FORCE: number;
+    KDTREE: number;
+  }
+
+  LogisticRegression: {
+    REG_DISABLE: number;
+    REG_L1: number;
+    REG_L2: number;
+    BATCH: number;
+    MINI_BATCH: number;
+  }
+
+  ANN_MLP: {
+    BACKPROP: number;
+    RPROP: number;
+    IDENTITY: number;
+    SIGMOID_SYM: number;
+    GAUSSIAN: number;
+    RELU?: number;
+    LEAKYRELU?: number;
+    UPDATE_WEIGHTS: number;
+    NO_INPUT_SCALE: number;
+    NO_OUTPUT_SCALE: number;
+  }
 }
 
 export const statModel: {
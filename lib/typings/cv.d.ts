@@ -6,8 +6,10 @@ import { Vec4 } from './Vec4.d';
 import { Point2 } from './Point2.d';
 import { Point3 } from './Point3.d';
 import { KeyPoint } from './KeyPoint.d';
-import { DescriptorMatch } from './DescriptorMatch.d';
+import { DescriptorMatch, PackedDescriptorMatches, MatchKnnBatchOptions, ImageMatchScore, MatchFilterOptions } from './DescriptorMatch.d';
+import { DescriptorIndex } from './DescriptorIndex.d';
 import { Rect } from './Rect.d';
+import { RotatedRect } from './RotatedRect.d';
 import { TermCriteria } from './TermCriteria.d';
 import { OCRHMMClassifier } from './OCRHMMClassifier.d';
 import { Net } from './Net.d';
@@ -18,12 +20,52 @@ export interface HistAxes {
   ranges: number[];
 }
 
+export interface LetterboxScaleInfo {
+  scale: number;
+  padLeft: number;
+  padTop: number;
+}
+
+export interface DecodeDetectionsOptions {
+  format?: 'yolo' | 'ssd';
+  confThreshold?: number;
+  nmsThreshold?: number;
+  classAware?: boolean;
+  topK?: number;
+  inputSize?: Size;
+  inputScaleInfo?: LetterboxScaleInfo | LetterboxScaleInfo[];
+  batchSize?: number;
+}
+
+export interface DecodedDetections {
+  boxes: Float32Array;
+  scores: Float32Array;
+  classIds: Int32Array;
+}
+
 export function applyColorMap(src: Mat, colormap: number | Mat): Mat;
 export function blobFromImage(image: Mat, scaleFactor?: number, size?: Size, mean?: Vec3, swapRB?: boolean, crop?: boolean, ddepth?: number): Mat;
 export function blobFromImageAsync(image: Mat, scaleFactor?: number, size?: Size, mean?: Vec3, swapRB?: boolean, crop?: boolean, ddepth?: number): Promise<Mat>;
 export function blobFromImages(image: Mat[], scaleFactor?: number, size?: Size, mean?: Vec3, swapRB?: boolean, crop?: boolean, ddepth?: number): Mat;
 export function blobFromImagesAsync(image: Mat[], scaleFactor?: number, size?: Size, mean?: Vec3, swapRB?: boolean, crop?: boolean, ddepth?: number): Promise<Mat>;
-export function NMSBoxes(bboxes: Rect[], scores: number[], scoreThreshold: number, nmsThreshold: number): number[];
+export function blobFromImageLetterbox(image: Mat, size: Size, scalefactor?: number, mean?: Vec3, std?: Vec3, swapRB?: boolean, padValue?: number, layout?: string, interpolation?: number, ddepth?: number): { blob: Mat, scaleInfo: LetterboxScaleInfo };
+export function blobFromImageLetterboxAsync(image: Mat, size: Size, scalefactor?: number, mean?: Vec3, std?: Vec3, swapRB?: boolean, padValue?: number, layout?: string, interpolation?: number, ddepth?: number): Promise<{ blob: Mat, scaleInfo: LetterboxScaleInfo }>;
+export function blobFromImagesLetterbox(images: Mat[], size: Size, scalefactor?: number, mean?: Vec3, std?: Vec3, swapRB?: boolean, padValue?: number, layout?: string, interpolation?: number, ddepth?: number): { blob: Mat, scaleInfo: LetterboxScaleInfo[] };
+export function blobFromImagesLetterboxAsync(images: Mat[], size: Size, scalefactor?: number, mean?: Vec3, std?: Vec3, swapRB?: boolean, padValue?: number, layout?: string, interpolation?: number, ddepth?: number): Promise<{ blob: Mat, scaleInfo: LetterboxScaleInfo[] }>;
+export function NMSBoxes(bboxes: Rect[], scores: number[], scoreThreshold: number, nmsThreshold: number, topK?: number): number[];
+export function NMSBoxes(bboxes: Float32Array, scores: Float32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Int32Array;
+export function NMSBoxesAsync(bboxes: Rect[], scores: number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Promise<number[]>;
+export function NMSBoxesAsync(bboxes: Float32Array, scores: Float32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Promise<Int32Array>;
+export function NMSBoxesBatched(bboxes: Float32Array, scores: Float32Array | number[], classIds: Int32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Int32Array;
+export function NMSBoxesBatchedAsync(bboxes: Float32Array, scores: Float32Array | number[], classIds: Int32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Promise<Int32Array>;
+export function NMSBoxesRotated(bboxes: RotatedRect[], scores: number[], scoreThreshold: number, nmsThreshold: number, topK?: number): number[];
+export function NMSBoxesRotated(bboxes: Float32Array, scores: Float32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Int32Array;
+export function NMSBoxesRotatedAsync(bboxes: RotatedRect[], scores: number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Promise<number[]>;
+export function NMSBoxesRotatedAsync(bboxes: Float32Array, scores: Float32Array | number[], scoreThreshold: number, nmsThreshold: number, topK?: number): Promise<Int32Array>;
+export function decodeDetections(outputs: Mat | Mat[], opts?: DecodeDetectionsOptions): DecodedDetections;
+export function decodeDetectionsAsync(outputs: Mat | Mat[], opts?: DecodeDetectionsOptions): Promise<DecodedDetections>;
+export function decodeDetectionsBatch(outputs: Mat | Mat[], opts?: DecodeDetectionsOptions): DecodedDetections[];
+export function decodeDetectionsBatchAsync(outputs: Mat | Mat[], opts?: DecodeDetectionsOptions): Promise<DecodedDetections[]>;
 export function calcHist(img: Mat, histAxes: HistAxes[], mask?: Mat): Mat;
 export function calibrateCamera(objectPoints: Point3[], imagePoints: Point2[], imageSize: Size, cameraMatrix: Mat, distCoeffs: number[], flags?: number, criteria?: TermCriteria): { returnValue: number, rvecs: Vec3[], tvecs: Vec3[], distCoeffs: number[] };
 export function calibrateCameraAsync(objectPoints: Point3[], imagePoints: Point2[], imageSize: Size, cameraMatrix: Mat, distCoeffs: number[], flags?: number, criteria?: TermCriteria): Promise<{ returnValue: number, rvecs: Vec3[], tvecs: Vec3[], distCoeffs: number[] }>;
@@ -40,8 +82,8 @@ export function createOCRHMMTransitionsTable(vocabulary: string, lexicon: string
 export function createOCRHMMTransitionsTableAsync(vocabulary: string, lexicon: string[]): Promise<Mat>;
 export function destroyAllWindows() :void;
 export function destroyWindow(winName: string) :void;
-export function drawKeyPoints(img: Mat, keyPoints: KeyPoint[]): Mat;
-export function drawMatches(img1: Mat, img2: Mat, keyPoints1: KeyPoint[], keyPoints2: KeyPoint[], matches: DescriptorMatch[]): Mat;
+export function drawKeyPoints(img: Mat, keyPoints: KeyPoint[] | Float32Array): Mat;
+export function drawMatches(img1: Mat, img2: Mat, keyPoints1: KeyPoint[] | Float32Array, keyPoints2: KeyPoint[] | Float32Array, matches: DescriptorMatch[] | PackedDescriptorMatches): Mat;
 export function estimateAffine2D(from: Point2[], to: Point2[], method?: number, ransacReprojThreshold?: number, maxIters?: number, confidence?: number, refineIters?: number): { out: Mat, inliers: Mat };
 export function estimateAffine2DAsync(from: Point2[], to: Point2[], method?: number, ransacReprojThreshold?: number, maxIters?: number, confidence?: number, refineIters?: number): Promise<{ out: Mat, inliers: Mat }>;
 export function estimateAffine3D(src: Point3[], dst: Point3[], ransacThreshold?: number, confidence?: number): { returnValue: number, out: Mat, inliers: Mat };
@@ -85,29 +127,119 @@ export function loadOCRHMMClassifierCNNAsync(file: string): Promise<OCRHMMClassi
 export function loadOCRHMMClassifierNM(file: string): OCRHMMClassifier;
 export function loadOCRHMMClassifierNMAsync(file: string): Promise<OCRHMMClassifier>;
 export function matchBruteForce(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchBruteForce(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchBruteForce(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchBruteForceAsync(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchBruteForceAsync(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchBruteForceAsync(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchBruteForceHamming(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchBruteForceHamming(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchBruteForceHamming(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchBruteForceL1(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchBruteForceL1(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchBruteForceL1(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchBruteForceSL2(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchBruteForceSL2(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchBruteForceSL2(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchFlannBased(descriptors1: Mat, descriptors2: Mat): DescriptorMatch[];
+export function matchFlannBased(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): PackedDescriptorMatches;
+export function matchFlannBased(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat): Promise<DescriptorMatch[]>;
+export function matchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function matchKnnBatch(queryDescriptors: Mat, trainDescriptors: Mat[] | DescriptorIndex, opts?: MatchKnnBatchOptions): ImageMatchScore[];
+export function matchKnnBatchAsync(queryDescriptors: Mat, trainDescriptors: Mat[] | DescriptorIndex, opts?: MatchKnnBatchOptions): Promise<ImageMatchScore[]>;
 export function matchKnnBruteForce(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForce(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForce(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnBruteForceAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnBruteForceAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchKnnBruteForceHamming(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForceHamming(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForceHamming(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function matchKnnBruteForceHammingBlocked(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForceHammingBlocked(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForceHammingBlockedAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceHammingBlockedAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
 export function matchKnnBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchKnnBruteForceL1(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForceL1(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForceL1(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchKnnBruteForceSL2(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnBruteForceSL2(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnBruteForceSL2(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function matchKnnFlannBased(descriptors1: Mat, descriptors2: Mat, k: number): DescriptorMatch[][];
+export function matchKnnFlannBased(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): PackedDescriptorMatches;
+export function matchKnnFlannBased(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
 export function matchKnnFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, k: number): Promise<DescriptorMatch[][]>;
+export function matchKnnFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function matchKnnFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, k: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchBruteForce(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchBruteForce(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchBruteForce(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchBruteForceAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchBruteForceAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchBruteForceAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchBruteForceHamming(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchBruteForceHamming(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchBruteForceHamming(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchBruteForceHammingAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchBruteForceHammingLut(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchBruteForceHammingLutAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchBruteForceL1(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchBruteForceL1(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchBruteForceL1(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchBruteForceL1Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchBruteForceSL2(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchBruteForceSL2(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchBruteForceSL2(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchBruteForceSL2Async(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
+export function radiusMatchFlannBased(descriptors1: Mat, descriptors2: Mat, maxDistance: number): DescriptorMatch[][];
+export function radiusMatchFlannBased(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): PackedDescriptorMatches;
+export function radiusMatchFlannBased(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): DescriptorMatch[];
+export function radiusMatchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number): Promise<DescriptorMatch[][]>;
+export function radiusMatchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { packed: true }): Promise<PackedDescriptorMatches>;
+export function radiusMatchFlannBasedAsync(descriptors1: Mat, descriptors2: Mat, maxDistance: number, opts: { filterMatches: MatchFilterOptions, packed?: false }): Promise<DescriptorMatch[]>;
 export function partition(data: Point2[], predicate: (pt1: Point2, pt2: Point2) => boolean): { labels: number[], numLabels: number };
 export function partition(data: Point3[], predicate: (pt1: Point3, pt2: Point3) => boolean): { labels: number[], numLabels: number };
 export function partition(data: Vec2[], predicate: (vec1: Vec2, vec2: Vec2) => boolean): { labels: number[], numLabels: number };
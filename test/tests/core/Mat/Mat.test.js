@@ -158,6 +158,34 @@ describe('Mat', () => {
     });
   });
 
+  if (cv.CV_16F !== undefined) {
+    describe('half precision', () => {
+      const halfData = [
+        [0, 0.5, -1.5],
+        [2, 1024, -0.25]
+      ];
+
+      it('should initialize CV_16FC1 from js array', () => {
+        const mat = new cv.Mat(halfData, cv.CV_16FC1);
+        assertMetaData(mat)(2, 3, cv.CV_16FC1);
+        assertDataDeepEquals(halfData, mat.getDataAsArray());
+      });
+
+      it('should fill CV_16FC3 with vector', () => {
+        const mat = new cv.Mat(2, 2, cv.CV_16FC3, [0.5, 1, 2]);
+        expect(mat.at(1, 1).x).to.equal(0.5);
+        expect(mat.at(1, 1).z).to.equal(2);
+      });
+
+      it('should convert between CV_32F and CV_16F', () => {
+        const mat = new cv.Mat(halfData, cv.CV_32F).convertTo(cv.CV_16F);
+        assertMetaData(mat)(2, 3, cv.CV_16FC1);
+        expect(mat.getData().length).to.equal(2 * 3 * 2);
+        assertDataDeepEquals(halfData, mat.convertTo(cv.CV_32F).getDataAsArray());
+      });
+    });
+  }
+
   describe('norm', () => {
     it('should calculate default normal value if no args passed', () => {
       const mat = new cv.Mat([
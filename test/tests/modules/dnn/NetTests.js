@@ -37,4 +37,19 @@ module.exports = (getTestImg) => {
       expectOutput
     });
   });
+
+  describe('clone', () => {
+    it('should throw if net has not been read from a model file', () => {
+      expect(() => new cv.Net().clone()).to.throw('can not be cloned');
+    });
+
+    it('cloneAsync should reject if net has not been read from a model file', (done) => {
+      new cv.Net().cloneAsync()
+        .then(() => done(new Error('expected cloneAsync to reject')))
+        .catch((err) => {
+          expect(err.message).to.contain('can not be cloned');
+          done();
+        });
+    });
+  });
 };
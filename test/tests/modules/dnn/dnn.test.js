@@ -80,6 +80,187 @@ describe('dnn', () => {
         ]),
         expectOutput
       });
+
+      if (cv.version.major > 3 && cv.CV_16F !== undefined) {
+        it('should return a half precision blob', () => {
+          const blob = cv.blobFromImage(testImg, { size: new cv.Size(3, 3), ddepth: cv.CV_16F });
+          expect(blob.depth).to.equal(cv.CV_16F);
+          expect(blob.sizes).to.deep.equal([1, 3, 3, 3]);
+        });
+
+        it('should return half precision blobs for a batch', () => {
+          const blob = cv.blobFromImages([testImg, testImg], { size: new cv.Size(3, 3), ddepth: cv.CV_16F });
+          expect(blob.depth).to.equal(cv.CV_16F);
+          expect(blob.sizes).to.deep.equal([2, 3, 3, 3]);
+        });
+      }
+    });
+  });
+
+  describe('blobFromImageLetterbox', () => {
+    const size = new cv.Size(64, 48);
+
+    const getOptionalArgsMap = () => ([
+      ['scalefactor', 1 / 255],
+      ['mean', new cv.Vec(0.5, 0.5, 0.5)],
+      ['std', new cv.Vec(0.2, 0.2, 0.2)],
+      ['swapRB', false],
+      ['padValue', 114],
+      ['layout', 'NHWC']
+    ]);
+
+    const expectScaleInfo = (scaleInfo) => {
+      expect(scaleInfo).to.have.property('scale').to.be.a('number').above(0);
+      expect(scaleInfo).to.have.property('padLeft').to.be.a('number');
+      expect(scaleInfo).to.have.property('padTop').to.be.a('number');
+    };
+
+    describe('blobFromImageLetterbox', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'blobFromImageLetterbox',
+        getRequiredArgs: () => ([
+          testImg,
+          size
+        ]),
+        getOptionalArgsMap,
+        expectOutput: (res) => {
+          expect(res).to.have.property('blob').to.be.instanceOf(cv.Mat);
+          expectScaleInfo(res.scaleInfo);
+        }
+      });
+    });
+
+    describe('blobFromImagesLetterbox', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'blobFromImagesLetterbox',
+        getRequiredArgs: () => ([
+          [testImg, testImg],
+          size
+        ]),
+        getOptionalArgsMap,
+        expectOutput: (res) => {
+          expect(res).to.have.property('blob').to.be.instanceOf(cv.Mat);
+          expect(res.scaleInfo).to.be.an('array').lengthOf(2);
+          res.scaleInfo.forEach(expectScaleInfo);
+        }
+      });
+    });
+
+    it('should write NCHW blob with letterbox padding', () => {
+      const img = new cv.Mat(10, 20, cv.CV_8UC3, [255, 255, 255]);
+      const { blob, scaleInfo } = cv.blobFromImageLetterbox(img, new cv.Size(40, 40), 1, new cv.Vec(0, 0, 0), new cv.Vec(1, 1, 1), true, 0);
+      expect(blob.sizes).to.deep.equal([1, 3, 40, 40]);
+      expect(scaleInfo.scale).to.equal(2);
+      expect(scaleInfo.padLeft).to.equal(0);
+      expect(scaleInfo.padTop).to.equal(10);
+      expect(blob.at([0, 0, 0, 0])).to.equal(0);
+      expect(blob.at([0, 0, 20, 20])).to.equal(255);
+    });
+
+    it('should write NHWC blob', () => {
+      const { blob } = cv.blobFromImagesLetterbox([testImg, testImg], size, { layout: 'NHWC' });
+      expect(blob.sizes).to.deep.equal([2, 48, 64, 3]);
+    });
+
+    if (cv.CV_16F !== undefined) {
+      it('should write half precision blob', () => {
+        const { blob } = cv.blobFromImageLetterbox(testImg, size, { ddepth: cv.CV_16F });
+        expect(blob.depth).to.equal(cv.CV_16F);
+        expect(blob.sizes).to.deep.equal([1, 3, 48, 64]);
+      });
+    }
+
+    it('should throw on invalid layout', () => {
+      expect(() => cv.blobFromImageLetterbox(testImg, size, { layout: 'CHW' })).to.throw('expected layout');
+    });
+  });
+
+  describe('decodeDetections', () => {
+    // [cx, cy, w, h, objectness, class0, class1]
+    const getYoloOutput = () => new cv.Mat([
+      [0.5, 0.5, 0.2, 0.2, 0.9, 0.1, 0.9],
+      [0.51, 0.5, 0.2, 0.2, 0.8, 0.1, 0.8],
+      [0.2, 0.2, 0.1, 0.1, 0.9, 0.7, 0.1],
+      [0.8, 0.8, 0.1, 0.1, 0.1, 0.1, 0.2]
+    ], cv.CV_32F);
+
+    // [imageId, classId, confidence, left, top, right, bottom]
+    const getSsdOutput = () => new cv.Mat([
+      [0, 1, 0.9, 0.1, 0.1, 0.3, 0.3],
+      [0, 1, 0.8, 0.11, 0.1, 0.31, 0.3],
+      [1, 2, 0.7, 0.5, 0.5, 0.6, 0.6],
+      [1, 2, 0.1, 0.5, 0.5, 0.6, 0.6]
+    ], cv.CV_32F);
+
+    const expectDetections = (res, numDetections) => {
+      expect(res).to.have.property('boxes').to.be.instanceOf(Float32Array).lengthOf(4 * numDetections);
+      expect(res).to.have.property('scores').to.be.instanceOf(Float32Array).lengthOf(numDetections);
+      expect(res).to.have.property('classIds').to.be.instanceOf(Int32Array).lengthOf(numDetections);
+    };
+
+    describe('decodeDetections', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'decodeDetections',
+        getRequiredArgs: () => ([
+          [getYoloOutput()]
+        ]),
+        getOptionalArgsMap: () => ([
+          ['format', 'yolo'],
+          ['confThreshold', 0.5],
+          ['nmsThreshold', 0.4],
+          ['classAware', true],
+          ['topK', 10],
+          ['inputSize', new cv.Size(100, 100)]
+        ]),
+        expectOutput: res => expectDetections(res, 2)
+      });
+    });
+
+    describe('decodeDetectionsBatch', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'decodeDetectionsBatch',
+        getRequiredArgs: () => ([
+          getSsdOutput()
+        ]),
+        getOptionalArgsMap: () => ([
+          ['format', 'ssd'],
+          ['confThreshold', 0.5],
+          ['nmsThreshold', 0.4]
+        ]),
+        expectOutput: (res) => {
+          expect(res).to.be.an('array').lengthOf(2);
+          expectDetections(res[0], 1);
+          expectDetections(res[1], 1);
+        }
+      });
+    });
+
+    it('should map boxes back through the letterbox scale info', () => {
+      const { boxes, classIds } = cv.decodeDetections(getYoloOutput(), {
+        inputSize: new cv.Size(100, 100),
+        inputScaleInfo: { scale: 0.5, padLeft: 0, padTop: 10 }
+      });
+      expect(Array.from(classIds)).to.deep.equal([1, 0]);
+      expect(boxes[0]).to.be.closeTo(80, 0.001);
+      expect(boxes[1]).to.be.closeTo(60, 0.001);
+      expect(boxes[2]).to.be.closeTo(40, 0.001);
+    });
+
+    it('should suppress across classes if classAware is false', () => {
+      const res = cv.decodeDetections(getSsdOutput(), { format: 'ssd', classAware: false, nmsThreshold: 0.01 });
+      expectDetections(res, 2);
+    });
+
+    it('should throw on unknown format', () => {
+      expect(() => cv.decodeDetections(getYoloOutput(), { format: 'rcnn' })).to.throw('expected format');
+    });
+
+    it('should throw if batchSize exceeds the images of the outputs', () => {
+      expect(() => cv.decodeDetectionsBatch(getYoloOutput(), { batchSize: 3 })).to.throw('to be divisible by the number of images');
     });
   });
 
@@ -88,7 +269,6 @@ describe('dnn', () => {
       generateAPITests({
         getDut: () => cv,
         methodName: 'NMSBoxes',
-        hasAsync: false,
         getRequiredArgs: () => ([
           [new cv.Rect(0, 0, 1, 1)],
           [1],
@@ -100,6 +280,100 @@ describe('dnn', () => {
           expect(res[0]).to.be.equal(0);
         },
       });
+
+      it('should accept packed boxes and scores', () => {
+        const boxes = new Float32Array([0, 0, 10, 10, 1, 1, 10, 10, 50, 50, 10, 10]);
+        const scores = new Float32Array([0.8, 0.9, 0.7]);
+        const res = cv.NMSBoxes(boxes, scores, 0.5, 0.4);
+        expect(res).to.be.instanceOf(Int32Array);
+        expect(Array.from(res)).to.deep.equal([1, 2]);
+      });
+
+      it('should throw if number of boxes and scores differ', () => {
+        expect(() => cv.NMSBoxes(new Float32Array([0, 0, 10, 10]), [0.5, 0.5], 0.5, 0.4)).to.throw('expected 4 box values per score');
+      });
+    });
+
+    describe('NMSBoxesBatched', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'NMSBoxesBatched',
+        getRequiredArgs: () => ([
+          new Float32Array([0, 0, 10, 10, 1, 1, 10, 10, 0, 0, 10, 10]),
+          new Float32Array([0.8, 0.9, 0.7]),
+          new Int32Array([0, 0, 1]),
+          0.5,
+          0.4
+        ]),
+        getOptionalArgsMap: () => ([
+          ['topK', 10]
+        ]),
+        expectOutput: (res) => {
+          expect(res).to.be.instanceOf(Int32Array);
+          expect(Array.from(res)).to.deep.equal([1, 2]);
+        }
+      });
+    });
+
+    it('should apply topK to the kept boxes for Rects and packed boxes', () => {
+      const rects = [new cv.Rect(0, 0, 10, 10), new cv.Rect(1, 1, 10, 10), new cv.Rect(50, 50, 10, 10)];
+      const packed = new Float32Array([0, 0, 10, 10, 1, 1, 10, 10, 50, 50, 10, 10]);
+      const scores = [0.8, 0.9, 0.7];
+      expect(cv.NMSBoxes(rects, scores, 0.5, 0.4, 1)).to.deep.equal([1]);
+      expect(Array.from(cv.NMSBoxes(packed, scores, 0.5, 0.4, 1))).to.deep.equal([1]);
+    });
+
+    it('should keep the same packed boxes as cv::dnn::NMSBoxes keeps Rects', () => {
+      // deterministic pseudo random boxes, overlapping each other, with some scores equal to the threshold
+      let seed = 42;
+      const next = (max) => {
+        seed = (seed * 16807) % 2147483647;
+        return seed % max;
+      };
+      const rects = [];
+      const packed = [];
+      const scores = [];
+      for (let i = 0; i < 200; i++) {
+        const rect = new cv.Rect(next(100), next(100), 1 + next(30), 1 + next(30));
+        rects.push(rect);
+        packed.push(rect.x, rect.y, rect.width, rect.height);
+        scores.push(i % 10 === 0 ? 0.5 : next(1000) / 1000);
+      }
+      [0.3, 0.5, 0.7].forEach((nmsThreshold) => {
+        const expected = cv.NMSBoxes(rects, scores, 0.5, nmsThreshold);
+        expected.forEach(idx => expect(scores[idx]).to.be.above(0.5));
+        expect(Array.from(cv.NMSBoxes(new Float32Array(packed), scores, 0.5, nmsThreshold))).to.deep.equal(expected);
+      });
+    });
+
+    (cv.version.major > 3 || cv.version.minor > 4 || (cv.version.minor > 3 && cv.version.subminor > 1) ? describe : describe.skip)('NMSBoxesRotated', () => {
+      generateAPITests({
+        getDut: () => cv,
+        methodName: 'NMSBoxesRotated',
+        getRequiredArgs: () => ([
+          [
+            new cv.RotatedRect(new cv.Point2(10, 10), new cv.Size(10, 5), 30),
+            new cv.RotatedRect(new cv.Point2(10, 10), new cv.Size(10, 5), 32)
+          ],
+          [0.8, 0.9],
+          0.5,
+          0.4
+        ]),
+        getOptionalArgsMap: () => ([
+          ['topK', 10]
+        ]),
+        expectOutput: (res) => {
+          expect(res).to.be.instanceOf(Array);
+          expect(res).to.deep.equal([1]);
+        }
+      });
+
+      it('should accept packed rotated boxes', () => {
+        const boxes = new Float32Array([10, 10, 10, 5, 30, 10, 10, 10, 5, 32, 50, 50, 10, 5, 0]);
+        const res = cv.NMSBoxesRotated(boxes, [0.8, 0.9, 0.7], 0.5, 0.4);
+        expect(res).to.be.instanceOf(Int32Array);
+        expect(Array.from(res)).to.deep.equal([1, 2]);
+      });
     });
   }
 });
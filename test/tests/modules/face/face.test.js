@@ -1,8 +1,11 @@
+const { expect } = require('chai');
+
 const cv = global.dut;
 const { readTestImage } = global.utils;
 const recognizerTests = require('./recognizerTests');
 const facemarkTests = require('./facemarkTests');
 const facemarkStructsTests = require('./facemarkStructsTests');
+const faceGalleryTests = require('./faceGalleryTests');
 
 describe('face', () => {
   if (!cv.xmodules.face) {
@@ -32,6 +35,52 @@ describe('face', () => {
     const args = ['radius', 'neighbors', 'grid_x', 'grid_y'];
     const values = [2, 16, 16, 16];
     recognizerTests(() => testImg, args, values, cv.LBPHFaceRecognizer);
+
+    describe('update', () => {
+      let grayImg;
+      let flippedImg;
+
+      before(() => {
+        grayImg = testImg.bgrToGray();
+        flippedImg = grayImg.flip(0);
+      });
+
+      it('should add identities without retraining', () => {
+        const recognizer = new cv.LBPHFaceRecognizer();
+        recognizer.train([grayImg], [1]);
+        recognizer.update([flippedImg], [2]);
+        expect(recognizer.predict(grayImg).label).to.equal(1);
+        expect(recognizer.predict(flippedImg).label).to.equal(2);
+      });
+
+      it('updateAsync should add identities without retraining', () => {
+        const recognizer = new cv.LBPHFaceRecognizer();
+        recognizer.train([grayImg], [1]);
+        return recognizer.updateAsync([flippedImg], [2]).then(() => {
+          expect(recognizer.predict(flippedImg).label).to.equal(2);
+        });
+      });
+
+      it('updateAsync should not race with predictBatchAsync', () => {
+        const recognizer = new cv.LBPHFaceRecognizer();
+        recognizer.train([grayImg], [1]);
+        const images = Array(16).fill(grayImg);
+        return Promise.all([
+          recognizer.predictBatchAsync(images),
+          recognizer.updateAsync([flippedImg], [2]),
+          recognizer.predictBatchAsync(images)
+        ]).then((results) => {
+          results.filter(res => res).forEach((res) => {
+            expect(res.labels).to.deep.equal(Array(16).fill(1));
+          });
+          expect(recognizer.predict(flippedImg).label).to.equal(2);
+        });
+      });
+    });
+  });
+
+  describe('FaceGallery', () => {
+    faceGalleryTests(() => testImg);
   });
 
   if (cv.version.minor >= 4) {
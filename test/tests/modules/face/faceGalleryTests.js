@@ -0,0 +1,184 @@
+const { expect } = require('chai');
+const fs = require('fs');
+
+const cv = global.dut;
+const { assertPropsWithValue, clearTmpData, getTmpDataFilePath } = global.utils;
+
+module.exports = (getTestImg) => {
+  const dims = 4;
+  const embeddings = new cv.Mat([
+    [1, 0, 0, 0],
+    [0, 1, 0, 0],
+    [0, 0, 1, 0],
+    [0, 0, 2, 1]
+  ], cv.CV_32F);
+  const query = new cv.Mat([[0, 0, 3, 0]], cv.CV_32F);
+
+  const makeGallery = (metric) => {
+    const gallery = new cv.FaceGallery(dims, metric);
+    gallery.add([1, 2, 3, 3], embeddings);
+    return gallery;
+  };
+
+  it('should throw on unknown metric', () => {
+    expect(() => new cv.FaceGallery(dims, 'foo')).to.throw("expected metric to be one of 'cosine' or 'l2'");
+  });
+
+  it('should throw on embedding size mismatch', () => {
+    expect(() => new cv.FaceGallery(dims).add(1, new cv.Mat(1, 2, cv.CV_32F, 0)))
+      .to.throw(`expected embeddings with ${dims} cols`);
+  });
+
+  it('should be constructable with opts', () => {
+    assertPropsWithValue(new cv.FaceGallery(dims, { metric: 'l2' }))({ dims, metric: 'l2' });
+  });
+
+  it('should add embeddings', () => {
+    assertPropsWithValue(makeGallery())({ dims, metric: 'cosine', numEmbeddings: 4, numIds: 3 });
+  });
+
+  it('should find nearest id by cosine distance', () => {
+    const res = makeGallery().query(query);
+    expect(res).to.be.an('array').lengthOf(1);
+    expect(res[0][0].id).to.equal(3);
+    expect(res[0][0].distance).to.be.closeTo(0, 0.0001);
+  });
+
+  it('should find nearest id by l2 distance', () => {
+    const res = makeGallery('l2').query(query);
+    expect(res[0][0].id).to.equal(3);
+    expect(res[0][0].distance).to.be.closeTo(Math.sqrt(2), 0.0001);
+  });
+
+  it('should return at most topK distinct ids', () => {
+    const res = makeGallery().query(query, { topK: 2 });
+    expect(res[0]).to.be.an('array').lengthOf(2);
+    expect(res[0][0].id).to.not.equal(res[0][1].id);
+  });
+
+  it('should remove all embeddings of an id', () => {
+    const gallery = makeGallery();
+    expect(gallery.remove(3)).to.equal(2);
+    expect(gallery.remove(3)).to.equal(0);
+    assertPropsWithValue(gallery)({ numEmbeddings: 2, numIds: 2 });
+    expect(gallery.query(query)[0].some(match => match.id === 3)).to.equal(false);
+  });
+
+  it('queryAsync', () => {
+    const gallery = makeGallery();
+    return gallery.queryAsync(query, 1).then((res) => {
+      expect(res[0]).to.be.an('array').lengthOf(1);
+      expect(res[0][0].id).to.equal(3);
+    });
+  });
+
+  it('should index eigenface projections', () => {
+    const grayImg = getTestImg().bgrToGray();
+    const faces = [grayImg, grayImg.flip(0), grayImg.flip(1)];
+    const recognizer = new cv.EigenFaceRecognizer();
+    recognizer.train(faces, [1, 2, 3]);
+    const projections = recognizer.project(faces);
+    const gallery = new cv.FaceGallery(projections.cols, 'l2');
+    gallery.add([1, 2, 3], projections);
+    const res = gallery.query(recognizer.project([faces[1]]), 1);
+    expect(res[0][0].id).to.equal(2);
+    expect(res[0][0].distance).to.be.closeTo(0, 0.001);
+  });
+
+  describe('multiple segments', () => {
+    // more rows than the 4096 rows of a segment, row r holds id r and a distinct point of a 64 x 64 grid,
+    // small integer coordinates keep the l2 distances exact in float
+    const numRows = 5000;
+    const rowEmbedding = r => [r % 64, Math.floor(r / 64), 0, 0];
+    const makeLargeGallery = () => {
+      const rows = [];
+      const ids = [];
+      for (let r = 0; r < numRows; r++) {
+        rows.push(rowEmbedding(r));
+        ids.push(r);
+      }
+      const gallery = new cv.FaceGallery(dims, 'l2');
+      gallery.add(ids, new cv.Mat(rows, cv.CV_32F));
+      return gallery;
+    };
+    const queryRow = r => new cv.Mat([rowEmbedding(r)], cv.CV_32F);
+
+    it('should move the last row of the last segment into a removed row of the first segment', () => {
+      const gallery = makeLargeGallery();
+      expect(gallery.remove(0)).to.equal(1);
+      assertPropsWithValue(gallery)({ numEmbeddings: numRows - 1, numIds: numRows - 1 });
+      const moved = gallery.query(queryRow(numRows - 1), 1)[0][0];
+      expect(moved.id).to.equal(numRows - 1);
+      expect(moved.distance).to.equal(0);
+      expect(gallery.query(queryRow(0), 1)[0][0].id).to.equal(1);
+    });
+
+    it('should drop the last segment once it is empty', () => {
+      const gallery = makeLargeGallery();
+      gallery.remove(0);
+      const ids = [];
+      for (let id = 4096; id < numRows - 1; id++) {
+        ids.push(id);
+      }
+      expect(gallery.remove(ids)).to.equal(ids.length);
+      assertPropsWithValue(gallery)({ numEmbeddings: 4096 });
+      expect(gallery.query(queryRow(numRows - 1), 1)[0][0]).to.deep.equal({ id: numRows - 1, distance: 0 });
+      expect(gallery.query(queryRow(4095), 1)[0][0]).to.deep.equal({ id: 4095, distance: 0 });
+    });
+
+    it('queries should see the gallery before or after a concurrent remove', () => {
+      const gallery = makeLargeGallery();
+      const pending = [];
+      for (let i = 0; i < 8; i++) {
+        pending.push(gallery.queryAsync(new cv.Mat([rowEmbedding(0), rowEmbedding(numRows - 1)], cv.CV_32F), 1));
+      }
+      // removing id 0 copies the first and the last segment if a query still holds them
+      gallery.remove(0);
+      return Promise.all(pending).then((results) => {
+        results.forEach((res) => {
+          const nearestToZero = res[0][0];
+          expect([0, 1]).to.include(nearestToZero.id);
+          expect(nearestToZero.distance).to.equal(nearestToZero.id);
+          expect(res[1][0]).to.deep.equal({ id: numRows - 1, distance: 0 });
+        });
+        expect(gallery.query(queryRow(0), 1)[0][0].id).to.equal(1);
+      });
+    });
+  });
+
+  describe('save and load', () => {
+    beforeEach(() => { clearTmpData(); });
+    afterEach(() => { clearTmpData(); });
+
+    it('should save and load from file', () => {
+      const file = getTmpDataFilePath('testGallery.bin');
+      makeGallery('l2').save(file);
+      const gallery = new cv.FaceGallery(1);
+      gallery.load(file);
+      assertPropsWithValue(gallery)({ dims, metric: 'l2', numEmbeddings: 4, numIds: 3 });
+      expect(gallery.query(query)[0][0].id).to.equal(3);
+    });
+
+    it('should replace an existing file', () => {
+      const file = getTmpDataFilePath('testGallery.bin');
+      makeGallery('l2').save(file);
+      const small = new cv.FaceGallery(dims, 'l2');
+      small.add(7, new cv.Mat([[0, 0, 0, 1]], cv.CV_32F));
+      small.save(file);
+      expect(fs.existsSync(`${file}.tmp`)).to.equal(false);
+      const gallery = new cv.FaceGallery(1);
+      gallery.load(file);
+      assertPropsWithValue(gallery)({ numEmbeddings: 1, numIds: 1 });
+    });
+
+    it('saveAsync and loadAsync', () => {
+      const file = getTmpDataFilePath('testGallery.bin');
+      const gallery = new cv.FaceGallery(dims);
+      return makeGallery().saveAsync(file)
+        .then(() => gallery.loadAsync(file))
+        .then(() => {
+          assertPropsWithValue(gallery)({ numEmbeddings: 4, numIds: 3 });
+        });
+    });
+  });
+};
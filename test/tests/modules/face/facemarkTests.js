@@ -1,3 +1,6 @@
+const fs = require('fs');
+const path = require('path');
+
 const cv = global.dut;
 const { generateAPITests, clearTmpData, getTmpDataFilePath } = global.utils;
 const { expect } = require('chai');
@@ -125,6 +128,75 @@ module.exports = (getTestImg, Facemark, FacemarkParams) => {
       });
     });
 
+    describe('fitBatch', () => {
+      const getFrames = () => [{ image: testImg, faces: [] }, { image: testImg, faces: [] }];
+
+      it('should return packed landmarks for each frame', () => {
+        const res = facemark.fitBatch(getFrames());
+        expect(res).to.be.an('array').lengthOf(2);
+        res.forEach((frame) => {
+          expect(frame).to.have.property('landmarks').to.be.instanceOf(Float32Array).lengthOf(0);
+          expect(frame).to.have.property('counts').to.be.an('array').lengthOf(0);
+          expect(frame).to.have.property('fitted').to.be.true;
+        });
+      });
+
+      it('should throw if frames are not objects { image, faces }', () => {
+        expect(() => facemark.fitBatch([testImg])).to.throw();
+      });
+
+      it('fitBatchAsync', () => facemark.fitBatchAsync(getFrames(), { concurrency: 2 }).then((res) => {
+        expect(res).to.be.an('array').lengthOf(2);
+      }));
+
+      const modelFile = path.resolve(__dirname, '../../../../data/face/lbfmodel.yaml');
+      (Facemark === cv.FacemarkLBF && fs.existsSync(modelFile) ? describe : describe.skip)('with a loaded model', () => {
+        let lbf;
+        let faces;
+        let expected;
+
+        before(() => {
+          lbf = new Facemark();
+          lbf.loadModel(modelFile);
+          faces = new cv.CascadeClassifier(cv.HAAR_FRONTALFACE_DEFAULT).detectMultiScale(testImg).objects;
+          expected = lbf.fit(testImg, faces);
+        });
+
+        const expectSameAsFit = (frame) => {
+          expect(frame.fitted).to.be.true;
+          expect(frame.counts).to.deep.equal(expected.map(points => points.length));
+          const packed = [].concat(...expected.map(points => [].concat(...points.map(pt => [pt.x, pt.y]))));
+          expect(frame.landmarks.length).to.equal(packed.length);
+          packed.forEach((val, i) => expect(frame.landmarks[i]).to.be.closeTo(val, 1e-3));
+        };
+
+        it('should detect faces in the test image', () => {
+          expect(faces).to.be.an('array').lengthOf.above(0);
+        });
+
+        it('should return the same landmarks as fit for each frame', () => {
+          const frames = Array(4).fill({ image: testImg, faces });
+          const res = lbf.fitBatch(frames, { concurrency: 2 });
+          expect(res).to.be.an('array').lengthOf(4);
+          res.forEach(expectSameAsFit);
+        });
+
+        it('should fit with more concurrent stripes than replicas', () => {
+          const frames = Array(8).fill({ image: testImg, faces });
+          const res = lbf.fitBatch(frames, { concurrency: 64 });
+          expect(res).to.be.an('array').lengthOf(8);
+          res.forEach(expectSameAsFit);
+        });
+
+        it('fitBatchAsync should return the same landmarks as fit', () =>
+          lbf.fitBatchAsync([{ image: testImg, faces }]).then((res) => {
+            expect(res).to.be.an('array').lengthOf(1);
+            expectSameAsFit(res[0]);
+          })
+        );
+      });
+    });
+
     describe('save and load', () => {
       beforeEach(() => {
         clearTmpData();
@@ -1,4 +1,5 @@
 const { generateAPITests, clearTmpData, getTmpDataFilePath } = global.utils;
+const fs = require('fs');
 const { expect } = require('chai');
 
 module.exports = (getTestImg, args, values, Recognizer) => {
@@ -66,6 +67,46 @@ module.exports = (getTestImg, args, values, Recognizer) => {
       });
     });
 
+    describe('predictBatch', () => {
+      it('should return the same labels and confidences as predict', () => {
+        const expected = recognizer.predict(testImg);
+        const res = recognizer.predictBatch([testImg, testImg, testImg]);
+        expect(res).to.have.property('labels').to.be.an('array').lengthOf(3);
+        expect(res).to.have.property('confidences').to.be.an('array').lengthOf(3);
+        expect(res).to.not.have.property('nearest');
+        res.labels.forEach(label => expect(label).to.equal(expected.label));
+        res.confidences.forEach(confidence => expect(confidence).to.equal(expected.confidence));
+      });
+
+      it('should return the topK nearest labels of each face', () => {
+        const res = recognizer.predictBatch([testImg, testImg], { topK: 1 });
+        expect(res).to.have.property('nearest').to.be.an('array').lengthOf(2);
+        res.nearest.forEach((nearest, i) => {
+          expect(nearest).to.be.an('array').lengthOf(1);
+          expect(nearest[0]).to.have.property('label').to.equal(res.labels[i]);
+          expect(nearest[0]).to.have.property('confidence').to.equal(res.confidences[i]);
+        });
+      });
+
+      it('should return empty arrays for no faces', () => {
+        const res = recognizer.predictBatch([]);
+        expect(res.labels).to.be.an('array').lengthOf(0);
+        expect(res.confidences).to.be.an('array').lengthOf(0);
+      });
+
+      it('predictBatchAsync should return the same labels as predict', () => {
+        const expected = recognizer.predict(testImg);
+        return recognizer.predictBatchAsync([testImg, testImg], 2).then((res) => {
+          expect(res.labels).to.deep.equal([expected.label, expected.label]);
+          expect(res.nearest).to.be.an('array').lengthOf(2);
+          res.nearest.forEach((nearest) => {
+            expect(nearest).to.be.an('array').lengthOf(2);
+            expect(nearest[0].confidence).to.be.at.most(nearest[1].confidence);
+          });
+        });
+      });
+    });
+
     describe('save and load', () => {
       beforeEach(() => { clearTmpData(); });
       afterEach(() => { clearTmpData(); });
@@ -76,6 +117,42 @@ module.exports = (getTestImg, args, values, Recognizer) => {
         const recognizerNew = new Recognizer();
         recognizerNew.load(file);
       });
+
+      it('should save to and load from a buffer', () => {
+        const recognizerNew = new Recognizer();
+        recognizerNew.loadFromBuffer(recognizer.saveToBuffer());
+        expect(recognizerNew.predict(testImg)).to.deep.equal(recognizer.predict(testImg));
+      });
+
+      it('should save to and load from a buffer asynchronously', () => {
+        const recognizerNew = new Recognizer();
+        return recognizer.saveToBufferAsync({ format: 'yaml' })
+          .then(buf => recognizerNew.loadFromBufferAsync(buf))
+          .then(() => {
+            expect(recognizerNew.predict(testImg)).to.deep.equal(recognizer.predict(testImg));
+          });
+      });
+
+      it('should load a buffer read from a saved file', () => {
+        const file = getTmpDataFilePath('testRecognizer.xml');
+        recognizer.save(file);
+        const recognizerNew = new Recognizer();
+        recognizerNew.loadFromBuffer(fs.readFileSync(file));
+        expect(recognizerNew.predict(testImg)).to.deep.equal(recognizer.predict(testImg));
+      });
+
+      it('should load a file written from a buffer', () => {
+        const file = getTmpDataFilePath('testRecognizer.xml');
+        fs.writeFileSync(file, recognizer.saveToBuffer());
+        const recognizerNew = new Recognizer();
+        recognizerNew.load(file);
+        expect(recognizerNew.predict(testImg)).to.deep.equal(recognizer.predict(testImg));
+      });
+
+      it('should throw if the buffer contains an untrained model', () => {
+        const buf = new Recognizer().saveToBuffer();
+        expect(() => new Recognizer().loadFromBuffer(buf)).to.throw('the model is empty');
+      });
     });
   });
 };
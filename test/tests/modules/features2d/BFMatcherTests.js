@@ -165,5 +165,57 @@ module.exports = (getTestImg) => {
               });
           });
       });
+
+      describe('radiusMatch', () => {
+          let kazeDesc;
+          const BFMatcher = new cv.BFMatcher(cv.NORM_L2);
+
+          before(() => {
+              const kaze = new cv.KAZEDetector();
+              kazeDesc = kaze.compute(getTestImg(), kaze.detect(getTestImg()));
+          });
+
+          it('sync', () => {
+              const matches = BFMatcher.radiusMatch(kazeDesc, kazeDesc, 0.01);
+              expect(matches).to.be.an('array').lengthOf(kazeDesc.rows);
+              matches.forEach(queryMatches => expect(queryMatches[0]).instanceOf(cv.DescriptorMatch));
+          });
+
+          it('async', () => BFMatcher.radiusMatchAsync(kazeDesc, kazeDesc, 0.01, { filterMatches: { crossCheck: true } })
+              .then((matches) => {
+                  expect(matches).to.be.an('array');
+                  matches.forEach(match => expect(match).instanceOf(cv.DescriptorMatch));
+              }));
+
+          it('knnMatch with filterMatches', () => {
+              const matches = BFMatcher.knnMatch(kazeDesc, kazeDesc, 2, { filterMatches: { ratio: 0.7, maxDistance: 0.01 } });
+              expect(matches).to.be.an('array');
+              matches.forEach(match => expect(match.distance).to.be.at.most(0.01));
+          });
+      });
+
+      describe('knnMatchBatch', () => {
+          let orbDesc;
+
+          before(() => {
+              const orb = new cv.ORBDetector();
+              orbDesc = orb.compute(getTestImg(), orb.detect(getTestImg()));
+          });
+
+          it('sync', () => {
+              const BFMatcher = new cv.BFMatcher(cv.NORM_HAMMING);
+              const scores = BFMatcher.knnMatchBatch(orbDesc, [orbDesc, orbDesc], { topK: 1 });
+              expect(scores).to.be.an('array').lengthOf(1);
+              expect(scores[0]).to.have.property('numInliers').to.be.above(0);
+          });
+
+          it('async', () => {
+              const BFMatcher = new cv.BFMatcher(cv.NORM_HAMMING, true);
+              return BFMatcher.knnMatchBatchAsync(orbDesc, [orbDesc]).then((scores) => {
+                  expect(scores).to.be.an('array').lengthOf(1);
+                  expect(scores[0].matches).to.be.an('array').lengthOf(scores[0].numInliers);
+              });
+          });
+      });
   });
 };
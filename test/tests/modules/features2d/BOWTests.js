@@ -0,0 +1,150 @@
+const cv = global.dut;
+const { assertPropsWithValue } = global.utils;
+const { expect } = require('chai');
+
+module.exports = (getTestImg) => {
+  describe('bag of visual words', () => {
+    const clusterCount = 8;
+    let orb;
+    let orbDesc;
+    let vocabulary;
+
+    before(() => {
+      orb = new cv.ORBDetector();
+      orbDesc = orb.compute(getTestImg(), orb.detect(getTestImg()));
+      const trainer = new cv.BOWKMeansTrainer(clusterCount);
+      trainer.add(orbDesc);
+      vocabulary = trainer.cluster();
+    });
+
+    describe('BOWKMeansTrainer', () => {
+      it('should be constructable with params object', () => {
+        const trainer = new cv.BOWKMeansTrainer(clusterCount, { attempts: 1, flags: cv.KMEANS_RANDOM_CENTERS });
+        assertPropsWithValue(trainer)({ clusterCount, attempts: 1, flags: cv.KMEANS_RANDOM_CENTERS, descriptorsCount: 0 });
+      });
+
+      it('should throw if clusterCount is less than 1', () => {
+        expect(() => new cv.BOWKMeansTrainer(0)).to.throw('expected clusterCount to be at least 1');
+      });
+
+      it('should accumulate and clear descriptors', () => {
+        const trainer = new cv.BOWKMeansTrainer(clusterCount);
+        trainer.add(orbDesc);
+        trainer.add(orbDesc);
+        expect(trainer.descriptorsCount).to.equal(2 * orbDesc.rows);
+        trainer.clear();
+        expect(trainer.descriptorsCount).to.equal(0);
+      });
+
+      it('should cluster binary descriptors into a float vocabulary', () => {
+        assertPropsWithValue(vocabulary)({ rows: clusterCount, cols: orbDesc.cols, type: cv.CV_32F });
+      });
+
+      it('should throw if no descriptors have been added', () => {
+        expect(() => new cv.BOWKMeansTrainer(clusterCount).cluster()).to.throw('no descriptors have been added');
+      });
+
+      it('clusterAsync', () => {
+        const trainer = new cv.BOWKMeansTrainer(clusterCount);
+        trainer.add(orbDesc);
+        return trainer.clusterAsync().then((res) => {
+          assertPropsWithValue(res)({ rows: clusterCount, cols: orbDesc.cols, type: cv.CV_32F });
+        });
+      });
+    });
+
+    describe('BOWImgDescriptorExtractor', () => {
+      it('should throw if detector is not a detector instance', () => {
+        expect(() => new cv.BOWImgDescriptorExtractor(vocabulary)).to.throw('to be a detector instance');
+      });
+
+      it('should throw if vocabulary has not been set', () => {
+        expect(() => new cv.BOWImgDescriptorExtractor(orb).compute(getTestImg())).to.throw('vocabulary has not been set');
+      });
+
+      it('should compute a normalized histogram', () => {
+        const extractor = new cv.BOWImgDescriptorExtractor(orb, vocabulary);
+        expect(extractor.descriptorSize).to.equal(clusterCount);
+        const hist = extractor.compute(getTestImg());
+        assertPropsWithValue(hist)({ rows: 1, cols: clusterCount, type: cv.CV_32F });
+        expect(hist.sum()).to.be.closeTo(1, 0.0001);
+      });
+
+      it('should compute histogram for given keypoints', () => {
+        const extractor = new cv.BOWImgDescriptorExtractor(orb);
+        extractor.setVocabulary(vocabulary);
+        const hist = extractor.compute(getTestImg(), orb.detect(getTestImg()));
+        expect(hist.sum()).to.be.closeTo(1, 0.0001);
+      });
+
+      it('computeFromDescriptors', () => {
+        const extractor = new cv.BOWImgDescriptorExtractor(orb, vocabulary);
+        const hist = extractor.computeFromDescriptors(orbDesc);
+        expect(hist.getDataAsArray()).to.deep.equal(extractor.compute(getTestImg()).getDataAsArray());
+      });
+
+      it('computeAsync', () => {
+        const extractor = new cv.BOWImgDescriptorExtractor(orb, vocabulary);
+        return extractor.computeAsync(getTestImg()).then((hist) => {
+          assertPropsWithValue(hist)({ rows: 1, cols: clusterCount });
+        });
+      });
+    });
+
+    describe('BOWIndex', () => {
+      let hist;
+      const otherHist = new cv.Mat([[1, 0, 0, 0, 0, 0, 0, 0]], cv.CV_32F);
+
+      before(() => {
+        hist = new cv.BOWImgDescriptorExtractor(orb, vocabulary).compute(getTestImg());
+      });
+
+      it('should throw on histogram size mismatch', () => {
+        expect(() => new cv.BOWIndex(clusterCount).add(0, new cv.Mat(1, 4, cv.CV_32F, 0)))
+          .to.throw(`expected histogram with ${clusterCount} entries`);
+      });
+
+      it('should return added image with score 1', () => {
+        const index = new cv.BOWIndex(clusterCount);
+        index.add(1, otherHist);
+        index.add(2, hist);
+        assertPropsWithValue(index)({ vocabularySize: clusterCount, numImages: 2 });
+        const res = index.query(hist);
+        expect(res[0].imageId).to.equal(2);
+        expect(res[0].score).to.be.closeTo(1, 0.0001);
+      });
+
+      it('should replace image with same id', () => {
+        const index = new cv.BOWIndex(clusterCount);
+        index.add(1, otherHist);
+        index.add(1, hist);
+        expect(index.imageIds).to.deep.equal([1]);
+      });
+
+      it('should remove images', () => {
+        const index = new cv.BOWIndex(clusterCount);
+        index.add(1, otherHist);
+        index.add(2, hist);
+        expect(index.remove(2)).to.equal(true);
+        expect(index.remove(2)).to.equal(false);
+        expect(index.imageIds).to.deep.equal([1]);
+        expect(index.query(hist).some(res => res.imageId === 2)).to.equal(false);
+      });
+
+      it('should return at most topK results', () => {
+        const index = new cv.BOWIndex(clusterCount);
+        [1, 2, 3].forEach(imageId => index.add(imageId, hist));
+        expect(index.query(hist, 2)).to.be.an('array').lengthOf(2);
+      });
+
+      it('queryAsync', () => {
+        const index = new cv.BOWIndex(clusterCount);
+        index.add(5, hist);
+        return index.queryAsync(hist).then((res) => {
+          expect(res).to.be.an('array').lengthOf(1);
+          expect(res[0].imageId).to.equal(5);
+        });
+      });
+    });
+  });
+};
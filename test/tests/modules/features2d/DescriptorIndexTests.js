@@ -0,0 +1,224 @@
+const cv = global.dut;
+const { assertPropsWithValue } = global.utils;
+const { expect } = require('chai');
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+
+module.exports = (getTestImg) => {
+  describe('DescriptorIndex', () => {
+    let kazeDesc;
+    let orbDesc;
+
+    before(() => {
+      const kaze = new cv.KAZEDetector();
+      kazeDesc = kaze.compute(getTestImg(), kaze.detect(getTestImg()));
+
+      const orb = new cv.ORBDetector();
+      orbDesc = orb.compute(getTestImg(), orb.detect(getTestImg()));
+    });
+
+    describe('constructor', () => {
+      it('should use kdtree by default', () => {
+        assertPropsWithValue(new cv.DescriptorIndex())({ algorithm: 'kdtree', isTrained: false, numImages: 0 });
+      });
+
+      it('should be constructable with params object', () => {
+        const index = new cv.DescriptorIndex({ algorithm: 'lsh', tableNumber: 6, keySize: 12, multiProbeLevel: 1 });
+        assertPropsWithValue(index)({ algorithm: 'lsh' });
+      });
+
+      it('should throw on unknown algorithm', () => {
+        expect(() => new cv.DescriptorIndex('annoy')).to.throw('expected algorithm');
+      });
+    });
+
+    describe('add', () => {
+      it('should add descriptors of multiple images', () => {
+        const index = new cv.DescriptorIndex();
+        index.add(kazeDesc);
+        index.add([kazeDesc, kazeDesc]);
+        assertPropsWithValue(index)({ numImages: 3, numDescriptors: 3 * kazeDesc.rows });
+        expect(index.imageIds).to.deep.equal([0, 1, 2]);
+      });
+
+      it('should add descriptors with image ids', () => {
+        const index = new cv.DescriptorIndex();
+        index.add(kazeDesc, 10);
+        index.add([kazeDesc, kazeDesc], [20, 30]);
+        expect(index.imageIds).to.deep.equal([10, 20, 30]);
+      });
+
+      it('should throw if number of image ids does not match', () => {
+        expect(() => new cv.DescriptorIndex().add([kazeDesc, kazeDesc], [1])).to.throw('one image id per descriptor Mat');
+      });
+
+      it('should not be affected by later changes to the added Mat', () => {
+        const desc = orbDesc.copy();
+        const index = new cv.DescriptorIndex({ algorithm: 'bruteforce', normType: cv.NORM_HAMMING });
+        index.add(desc);
+        for (let c = 0; c < desc.cols; c++) {
+          desc.set(0, c, 255 - orbDesc.at(0, c));
+        }
+        index.train();
+        expect(index.knnMatch(orbDesc, 1)[0][0].distance).to.equal(0);
+      });
+
+      it('clear should remove all descriptors', () => {
+        const index = new cv.DescriptorIndex();
+        index.add(kazeDesc);
+        index.train();
+        index.clear();
+        assertPropsWithValue(index)({ numImages: 0, isTrained: false });
+      });
+    });
+
+    describe('train', () => {
+      it('should throw if no descriptors have been added', () => {
+        expect(() => new cv.DescriptorIndex().train()).to.throw('no descriptors');
+      });
+
+      it('knnMatch should throw if index has not been trained', () => {
+        const index = new cv.DescriptorIndex();
+        index.add(kazeDesc);
+        expect(() => index.knnMatch(kazeDesc, 2)).to.throw('has not been trained');
+      });
+    });
+
+    const algorithms = [
+      { name: 'kdtree', params: { algorithm: 'kdtree', trees: 2, checks: 64 }, getDesc: () => kazeDesc },
+      { name: 'lsh', params: { algorithm: 'lsh' }, getDesc: () => orbDesc },
+      { name: 'bruteforce', params: { algorithm: 'bruteforce', normType: cv.NORM_HAMMING }, getDesc: () => orbDesc }
+    ];
+
+    algorithms.forEach(({ name, params, getDesc }) => {
+      describe(name, () => {
+        let index;
+        before(() => {
+          index = new cv.DescriptorIndex(params);
+          index.add([getDesc(), getDesc()]);
+          index.train();
+        });
+
+        it('knnMatch', () => {
+          const matches = index.knnMatch(getDesc(), 2);
+          expect(matches).to.be.an('array').lengthOf(getDesc().rows);
+          matches.forEach(m => expect(m[0]).to.be.instanceOf(cv.DescriptorMatch));
+        });
+
+        it('knnMatchAsync with packed results', () => index.knnMatchAsync(getDesc(), 1, { packed: true })
+          .then((matches) => {
+            expect(matches.queryIdx).to.be.instanceOf(Int32Array);
+            expect(matches.imgIdx.every(imgIdx => imgIdx === 0 || imgIdx === 1)).to.be.true;
+          }));
+
+        it('should load saved index', () => {
+          const file = path.join(os.tmpdir(), `ff_descriptor_index_${name}.bin`);
+          index.save(file);
+          const loaded = new cv.DescriptorIndex();
+          loaded.load(file);
+          assertPropsWithValue(loaded)({
+            algorithm: name,
+            isTrained: true,
+            numImages: index.numImages,
+            numDescriptors: index.numDescriptors
+          });
+          expect(loaded.imageIds).to.deep.equal(index.imageIds);
+          if (name !== 'lsh') {
+            // lsh tables are rebuilt with random hash functions, kd-tree and brute force results are reproducible
+            const expected = index.knnMatch(getDesc(), 1, { packed: true });
+            const actual = loaded.knnMatch(getDesc(), 1, { packed: true });
+            expect(Array.from(actual.trainIdx)).to.deep.equal(Array.from(expected.trainIdx));
+          }
+        });
+
+        it('should serve concurrent queries', () => Promise.all([0, 1, 2, 3].map(() => index.knnMatchAsync(getDesc(), 1)))
+          .then((results) => {
+            results.forEach(matches => expect(matches).to.be.an('array').lengthOf(getDesc().rows));
+          }));
+      });
+    });
+
+    describe('save and load', () => {
+      it('save should throw if index has not been trained', () => {
+        const index = new cv.DescriptorIndex();
+        index.add(kazeDesc);
+        expect(() => index.save(path.join(os.tmpdir(), 'ff_descriptor_index_untrained.bin'))).to.throw('has not been trained');
+      });
+
+      it('load should throw on invalid file', () => {
+        const file = path.join(os.tmpdir(), 'ff_descriptor_index_invalid.bin');
+        fs.writeFileSync(file, Buffer.alloc(128, 1));
+        expect(() => new cv.DescriptorIndex().load(file)).to.throw('not a descriptor index file');
+      });
+
+      it('should save over the file of a loaded index', () => {
+        const file = path.join(os.tmpdir(), 'ff_descriptor_index_overwrite.bin');
+        const index = new cv.DescriptorIndex('bruteforce');
+        index.add([kazeDesc, kazeDesc]);
+        index.train();
+        index.save(file);
+        const loaded = new cv.DescriptorIndex();
+        loaded.load(file);
+
+        const smallIndex = new cv.DescriptorIndex('bruteforce');
+        smallIndex.add(kazeDesc.getRegion(new cv.Rect(0, 0, kazeDesc.cols, 1)));
+        smallIndex.train();
+        smallIndex.save(file);
+
+        expect(fs.existsSync(`${file}.tmp`)).to.be.false;
+        expect(loaded.knnMatch(kazeDesc, 1)).to.be.an('array').lengthOf(kazeDesc.rows);
+      });
+
+      it('load should throw if the flann file belongs to another save', () => {
+        const file = path.join(os.tmpdir(), 'ff_descriptor_index_mismatch.bin');
+        const otherFile = path.join(os.tmpdir(), 'ff_descriptor_index_mismatch_other.bin');
+        const index = new cv.DescriptorIndex('kdtree');
+        index.add([kazeDesc, kazeDesc]);
+        index.train();
+        index.save(file);
+
+        const otherIndex = new cv.DescriptorIndex('kdtree');
+        otherIndex.add(kazeDesc);
+        otherIndex.train();
+        otherIndex.save(otherFile);
+        fs.copyFileSync(`${otherFile}.flann`, `${file}.flann`);
+
+        expect(() => new cv.DescriptorIndex().load(file)).to.throw('flann index does not belong to the descriptor index');
+      });
+
+      it('saveAsync and loadAsync', () => {
+        const file = path.join(os.tmpdir(), 'ff_descriptor_index_async.bin');
+        const index = new cv.DescriptorIndex('bruteforce');
+        index.add(kazeDesc, 7);
+        const loaded = new cv.DescriptorIndex();
+        return index.trainAsync()
+          .then(() => index.saveAsync(file))
+          .then(() => loaded.loadAsync(file))
+          .then(() => {
+            assertPropsWithValue(loaded)({ algorithm: 'bruteforce', numImages: 1 });
+            expect(loaded.imageIds).to.deep.equal([7]);
+          });
+      });
+    });
+
+    it('radiusMatch with maxResults', () => {
+      const index = new cv.DescriptorIndex({ algorithm: 'bruteforce', normType: cv.NORM_HAMMING });
+      index.add([orbDesc, orbDesc]);
+      index.train();
+      const matches = index.radiusMatch(orbDesc, 1, { maxResults: 1 });
+      matches.forEach(m => expect(m.length).to.equal(1));
+    });
+
+    it('radiusMatchAsync', () => {
+      const index = new cv.DescriptorIndex({ algorithm: 'bruteforce', normType: cv.NORM_HAMMING });
+      index.add(orbDesc);
+      return index.trainAsync()
+        .then(() => index.radiusMatchAsync(orbDesc, 1))
+        .then((matches) => {
+          expect(matches).to.be.an('array').lengthOf(orbDesc.rows);
+          matches.forEach(m => expect(m.length).to.be.above(0));
+        });
+    });
+  });
+};
@@ -124,5 +124,180 @@ module.exports = (getTestImg) => {
         });
       });
     });
+
+    describe('packed', () => {
+      const expectPackedMatches = (matches, numMatches) => {
+        expect(matches).to.have.property('queryIdx').to.be.instanceOf(Int32Array).lengthOf(numMatches);
+        expect(matches).to.have.property('trainIdx').to.be.instanceOf(Int32Array).lengthOf(numMatches);
+        expect(matches).to.have.property('imgIdx').to.be.instanceOf(Int32Array).lengthOf(numMatches);
+        expect(matches).to.have.property('distance').to.be.instanceOf(Float32Array).lengthOf(numMatches);
+      };
+
+      it('match should return packed matches', () => {
+        const matches = cv.matchBruteForceHamming(orbDesc, orbDesc, { packed: true });
+        expectPackedMatches(matches, orbKps.length);
+        const unpacked = cv.matchBruteForceHamming(orbDesc, orbDesc);
+        expect(Array.from(matches.trainIdx)).to.deep.equal(unpacked.map(m => m.trainIdx));
+      });
+
+      it('matchKnn should return flattened packed matches', () => {
+        const matches = cv.matchKnnBruteForceHamming(orbDesc, orbDesc, 2, { packed: true });
+        expectPackedMatches(matches, 2 * orbKps.length);
+        expect(matches.queryIdx[0]).to.equal(0);
+        expect(matches.queryIdx[1]).to.equal(0);
+      });
+
+      it('drawMatches should accept packed keypoints and matches', () => {
+        const orb = new cv.ORBDetector();
+        const kps = orb.detect(getTestImg(), { packed: true });
+        const matches = cv.matchBruteForceHamming(orbDesc, orbDesc, { packed: true });
+        const img = cv.drawMatches(getTestImg(), getTestImg(), kps, kps, matches);
+        expect(img).to.be.instanceOf(cv.Mat);
+      });
+    });
+
+    describe('radiusMatch', () => {
+      it('radiusMatchBruteForceHamming', () => {
+        const matches = cv.radiusMatchBruteForceHamming(orbDesc, orbDesc, 1);
+        expect(matches).to.be.an('array').lengthOf(orbKps.length);
+        matches.forEach((queryMatches) => {
+          expect(queryMatches.length).to.be.above(0);
+          queryMatches.forEach(match => expect(match.distance).to.be.at.most(1));
+        });
+      });
+
+      it('radiusMatchBruteForceAsync', () => cv.radiusMatchBruteForceAsync(kazeDesc, kazeDesc, 0.01)
+        .then((matches) => {
+          expect(matches).to.be.an('array').lengthOf(kazeKps.length);
+          matches.forEach(queryMatches => expect(queryMatches[0]).instanceOf(cv.DescriptorMatch));
+        }));
+
+      it('radiusMatchFlannBased with packed results', () => {
+        const matches = cv.radiusMatchFlannBased(kazeDesc, kazeDesc, 0.01, { packed: true });
+        expect(matches.queryIdx).to.be.instanceOf(Int32Array);
+        expect(matches.queryIdx.length).to.be.at.least(kazeKps.length);
+      });
+    });
+
+    describe('filterMatches', () => {
+      it('matchKnn should return the surviving best matches', () => {
+        const matches = cv.matchKnnBruteForceHamming(orbDesc, orbDesc, 2, { filterMatches: { ratio: 0.8, crossCheck: true } });
+        expect(matches).to.be.an('array');
+        expect(matches.length).to.be.above(0).and.at.most(orbKps.length);
+        matches.forEach((match) => {
+          expect(match).instanceOf(cv.DescriptorMatch);
+          expect(match.distance).to.equal(0);
+        });
+      });
+
+      it('match should apply maxDistance', () => {
+        const shifted = orbDesc.getRegion(new cv.Rect(0, 1, orbDesc.cols, orbDesc.rows - 1));
+        const all = cv.matchBruteForceHamming(orbDesc, shifted);
+        const filtered = cv.matchBruteForceHamming(orbDesc, shifted, { filterMatches: { maxDistance: 0 } });
+        expect(filtered.length).to.be.below(all.length);
+        filtered.forEach(match => expect(match.distance).to.equal(0));
+      });
+
+      it('match should throw if ratio test is requested', () => {
+        expect(() => cv.matchBruteForceHamming(orbDesc, orbDesc, { filterMatches: { ratio: 0.8 } }))
+          .to.throw('filterMatches.ratio is not supported by match');
+      });
+
+      it('radiusMatch with filter and packed results', () => cv.radiusMatchBruteForceHammingAsync(orbDesc, orbDesc, 50, {
+        filterMatches: { ratio: 0.8 },
+        packed: true
+      }).then((matches) => {
+        expect(matches.queryIdx).to.be.instanceOf(Int32Array);
+        expect(matches.queryIdx.length).to.be.at.most(orbKps.length);
+      }));
+
+      it('should throw if filterMatches is not an object', () => {
+        expect(() => cv.matchKnnBruteForceHamming(orbDesc, orbDesc, 2, { filterMatches: true })).to.throw('expected filterMatches to be an object');
+      });
+    });
+
+    describe('matchKnnBruteForceHammingBlocked', () => {
+      const k = 3;
+      const expectSameDistances = (matches) => {
+        const expected = cv.matchKnnBruteForceHamming(orbDesc, orbDesc, k);
+        expect(matches).to.be.an('array').lengthOf(orbKps.length);
+        matches.forEach((queryMatches, i) => {
+          expect(queryMatches.map(m => m.distance)).to.deep.equal(expected[i].map(m => m.distance));
+          expect(queryMatches[0].distance).to.equal(0);
+        });
+      };
+
+      it('sync', () => {
+        expectSameDistances(cv.matchKnnBruteForceHammingBlocked(orbDesc, orbDesc, k));
+      });
+
+      it('async', () => cv.matchKnnBruteForceHammingBlockedAsync(orbDesc, orbDesc, k)
+        .then(expectSameDistances));
+
+      it('should throw on float descriptors', () => {
+        expect(() => cv.matchKnnBruteForceHammingBlocked(kazeDesc, kazeDesc, k)).to.throw('expected binary descriptors');
+      });
+    });
+
+    describe('matchKnnBatch', () => {
+      let partialDesc;
+      before(() => {
+        partialDesc = orbDesc.getRegion(new cv.Rect(0, 0, orbDesc.cols, 10));
+      });
+
+      const expectScore = (score, imgIdx) => {
+        expect(score).to.have.property('imgIdx').to.equal(imgIdx);
+        expect(score).to.have.property('imageId').to.equal(imgIdx);
+        expect(score).to.have.property('numInliers').to.be.above(0);
+        expect(score.matches).to.be.an('array').lengthOf(score.numInliers);
+        score.matches.forEach(match => expect(match).instanceOf(cv.DescriptorMatch));
+      };
+
+      it('should rank images by number of matches', () => {
+        const scores = cv.matchKnnBatch(orbDesc, [partialDesc, orbDesc]);
+        expect(scores).to.be.an('array').lengthOf(2);
+        expectScore(scores[0], 1);
+        expectScore(scores[1], 0);
+        expect(scores[0].numInliers).to.be.above(scores[1].numInliers);
+      });
+
+      it('should return topK images', () => {
+        const scores = cv.matchKnnBatch(orbDesc, [partialDesc, orbDesc, partialDesc], { topK: 1, crossCheck: true });
+        expect(scores).to.be.an('array').lengthOf(1);
+        expectScore(scores[0], 1);
+      });
+
+      it('should verify matches with homography', () => {
+        const partialKps = orbKps.slice(0, 10);
+        const scores = cv.matchKnnBatch(orbDesc, [partialDesc, orbDesc], {
+          queryKeyPoints: orbKps,
+          trainKeyPoints: [partialKps, orbKps]
+        });
+        expectScore(scores[0], 1);
+        expect(scores[0].homography).to.be.instanceOf(cv.Mat);
+      });
+
+      it('should throw if keypoints do not match descriptors', () => {
+        expect(() => cv.matchKnnBatch(orbDesc, [orbDesc], {
+          queryKeyPoints: orbKps,
+          trainKeyPoints: [orbKps.slice(0, 10)]
+        })).to.throw('expected one keypoint per descriptor');
+      });
+
+      it('should match against DescriptorIndex', () => {
+        const index = new cv.DescriptorIndex('lsh');
+        index.add([partialDesc, orbDesc], [100, 200]);
+        index.train();
+        const scores = cv.matchKnnBatch(orbDesc, index, { packed: true });
+        expect(scores[0]).to.have.property('imageId').to.equal(200);
+        expect(scores[0].matches.queryIdx).to.be.instanceOf(Int32Array);
+      });
+
+      it('matchKnnBatchAsync', () => cv.matchKnnBatchAsync(orbDesc, [partialDesc, orbDesc])
+        .then((scores) => {
+          expect(scores).to.be.an('array').lengthOf(2);
+          expectScore(scores[0], 1);
+        }));
+    });
   });
 };
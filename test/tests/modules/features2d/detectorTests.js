@@ -71,6 +71,66 @@ module.exports = (getTestImg, defaults, customProps, Detector, implementsCompute
         keyPoints.forEach(kp => assert(kp instanceof cv.KeyPoint));
       }
     });
+
+    it('should return packed keypoints', () => {
+      const keyPoints = getDut().detect(testImg);
+      const packed = getDut().detect(testImg, { packed: true });
+      expect(packed).to.be.instanceOf(Float32Array).lengthOf(7 * keyPoints.length);
+      expect(packed[0]).to.be.closeTo(keyPoints[0].pt.x, 0.001);
+      expect(packed[1]).to.be.closeTo(keyPoints[0].pt.y, 0.001);
+      expect(packed[4]).to.be.closeTo(keyPoints[0].response, 0.001);
+    });
+  });
+
+  describe('detectGrid', () => {
+    const opts = { rows: 2, cols: 3, maxPerCell: 5 };
+
+    // cell borders are computed with integer division as in the native implementation
+    const getCellIdx = (coord, size, numCells) => {
+      let idx = 0;
+      while (idx < numCells - 1 && Math.floor(coord) >= Math.floor((idx + 1) * size / numCells)) {
+        idx += 1;
+      }
+      return idx;
+    };
+
+    const getCellCounts = (keyPoints) => {
+      const counts = Array(opts.rows * opts.cols).fill(0);
+      keyPoints.forEach((kp) => {
+        const col = getCellIdx(kp.pt.x, testImg.cols, opts.cols);
+        const row = getCellIdx(kp.pt.y, testImg.rows, opts.rows);
+        counts[row * opts.cols + col] += 1;
+      });
+      return counts;
+    };
+
+    it('should keep at most maxPerCell keypoints per cell', () => {
+      const keyPoints = getDut().detectGrid(testImg, opts);
+      expect(keyPoints).to.be.an('array');
+      assert(keyPoints.length > 0, 'no KeyPoints detected');
+      keyPoints.forEach(kp => assert(kp instanceof cv.KeyPoint));
+      getCellCounts(keyPoints).forEach(count => expect(count).to.be.at.most(opts.maxPerCell));
+    });
+
+    it('should detect over the whole image with a single cell', () => {
+      const keyPoints = getDut().detectGrid(testImg, { rows: 1, cols: 1, dedupRadius: 0 });
+      expect(keyPoints.length).to.equal(getDut().detect(testImg).length);
+    });
+
+    it('should throw on invalid grid', () => {
+      expect(() => getDut().detectGrid(testImg, { rows: 0 })).to.throw('expected rows and cols to be at least 1');
+    });
+
+    it('should throw on empty image', () => {
+      expect(() => getDut().detectGrid(new cv.Mat())).to.throw('expected image to be non empty');
+    });
+
+    it('detectGridAsync with packed keypoints', () => getDut().detectGridAsync(testImg, Object.assign({ packed: true }, opts))
+      .then((packed) => {
+        expect(packed).to.be.instanceOf(Float32Array);
+        expect(packed.length % 7).to.equal(0);
+        expect(packed.length / 7).to.be.at.most(opts.rows * opts.cols * opts.maxPerCell);
+      }));
   });
 
   if (implementsCompute) {
@@ -93,6 +153,46 @@ module.exports = (getTestImg, defaults, customProps, Detector, implementsCompute
           assertPropsWithValue(desc)({ rows: keyPoints.length });
         }
       });
+
+      it('should accept packed keypoints', () => {
+        const packed = dut.detect(testImg, { packed: true });
+        const desc = dut.compute(testImg, packed);
+        expect(desc).to.be.instanceOf(cv.Mat);
+        expect(desc.rows).to.be.above(0);
+      });
+    });
+
+    describe('detectAndCompute', () => {
+      const getMask = () => new cv.Mat(testImg.rows, testImg.cols, cv.CV_8U, 255);
+
+      generateAPITests({
+        getDut,
+        methodName: 'detectAndCompute',
+        methodNameSpace: 'FeatureDetector',
+        getRequiredArgs: () => ([
+          testImg
+        ]),
+        getOptionalArgsMap: () => ([
+          ['mask', getMask()],
+          ['retainBest', 10]
+        ]),
+        expectOutput: (res) => {
+          expect(res).to.have.property('keyPoints').to.be.a('array');
+          expect(res).to.have.property('descriptors').to.be.instanceOf(cv.Mat);
+          assert(res.keyPoints.length > 0, 'no KeyPoints detected');
+          assertPropsWithValue(res.descriptors)({ rows: res.keyPoints.length });
+        }
+      });
+
+      it('should retain the keypoints with the highest response', () => {
+        const { keyPoints: all } = getDut().detectAndCompute(testImg);
+        const { keyPoints, descriptors } = getDut().detectAndCompute(testImg, { retainBest: 5 });
+        expect(keyPoints).to.have.length(Math.min(5, all.length));
+        expect(descriptors.rows).to.equal(keyPoints.length);
+        const minResponse = Math.min(...keyPoints.map(kp => kp.response));
+        const numStronger = all.filter(kp => kp.response > minResponse).length;
+        expect(numStronger).to.be.below(keyPoints.length);
+      });
     });
   }
 };
@@ -6,6 +6,8 @@ const KeyPointTests = require('./KeyPointTests');
 const DescriptorMatchTests = require('./DescriptorMatchTests');
 const descriptorMatchingTests = require('./descriptorMatchingTests');
 const BFMatcherTests = require('./BFMatcherTests');
+const DescriptorIndexTests = require('./DescriptorIndexTests');
+const BOWTests = require('./BOWTests');
 
 describe('features2d', () => {
   let testImg;
@@ -17,6 +19,8 @@ describe('features2d', () => {
   DescriptorMatchTests();
   descriptorMatchingTests(() => testImg);
   BFMatcherTests(() => testImg);
+  DescriptorIndexTests(() => testImg);
+  BOWTests(() => testImg);
 
   describe('AGASTDetector', () => {
     const defaults = {
@@ -150,6 +154,15 @@ describe('features2d', () => {
     };
     const Detector = cv.ORBDetector;
     detectorTests(() => testImg, defaults, customProps, Detector);
+
+    it('detectGridAsync should reject float images', (done) => {
+      new cv.ORBDetector().detectGridAsync(testImg.convertTo(cv.CV_32F))
+        .then(() => done(new Error('expected detectGridAsync to reject')))
+        .catch((err) => {
+          expect(err.message).to.contain('expected image depth to be CV_8U');
+          done();
+        });
+    });
   });
 
   describe('SimpleBlobDetector', () => {
@@ -1,3 +1,4 @@
+const fs = require('fs');
 const { expect } = require('chai');
 
 const cv = global.dut;
@@ -146,6 +147,96 @@ module.exports = () => {
           expectOutput
         });
       });
+
+      describe('trainAutoParallel', () => {
+        const expectResult = (res) => {
+          expect(res).to.have.property('c').to.be.a('number');
+          expect(res).to.have.property('gamma').to.be.a('number');
+          expect(res).to.have.property('p').to.be.a('number');
+          expect(res).to.have.property('nu').to.be.a('number');
+          expect(res).to.have.property('coef0').to.be.a('number');
+          expect(res).to.have.property('degree').to.be.a('number');
+          expect(res).to.have.property('error').to.be.within(0, 1);
+          expect(res).to.have.property('numEvaluated').to.be.a('number');
+          expect(res).to.have.property('numGridPoints').to.be.a('number');
+          expect(res).to.have.property('cancelled').to.be.a('boolean');
+          expect(res).to.have.property('earlyStopped').to.be.a('boolean');
+        };
+
+        it('should evaluate all grid points and train the svm with the best params', () => {
+          const svm = new cv.SVM();
+          const res = svm.trainAutoParallel(trainData);
+          expectResult(res);
+          expect(res.numEvaluated).to.equal(res.numGridPoints);
+          expect(res.cancelled).to.be.false;
+          expect(svm.isTrained).to.be.true;
+          expect(svm.c).to.equal(res.c);
+          expect(svm.gamma).to.equal(res.gamma);
+        });
+
+        it('should only search the params used by the kernel', () => {
+          const svm = new cv.SVM({ kernelType: cv.ml.SVM.LINEAR });
+          const res = svm.trainAutoParallel(trainData, {
+            kFold: 4,
+            cGrid: new cv.ParamGrid(0.1, 100, 10),
+            balanced: true
+          });
+          expect(res.numGridPoints).to.equal(3);
+          expect(res.numEvaluated).to.equal(3);
+        });
+
+        it('should stop early if the target error is reached', () => {
+          const svm = new cv.SVM();
+          const res = svm.trainAutoParallel(trainData, { targetError: 1 });
+          expect(res.earlyStopped).to.be.true;
+          expect(res.error).to.be.at.most(1);
+          expect(svm.isTrained).to.be.true;
+        });
+
+        it('should throw if kFold exceeds the number of samples', () => {
+          expect(() => new cv.SVM().trainAutoParallel(trainData, { kFold: 20 })).to.throw('expected at least kFold samples');
+        });
+
+        it('should throw if onProgress is passed to the sync binding', () => {
+          expect(() => new cv.SVM().trainAutoParallel(trainData, { onProgress: () => {} })).to.throw();
+        });
+
+        it('trainAutoParallelAsync should report the progress', () => {
+          const svm = new cv.SVM();
+          const progress = [];
+          return svm.trainAutoParallelAsync(trainData, { onProgress: p => progress.push(p) }).then((res) => {
+            expectResult(res);
+            expect(res.numEvaluated).to.equal(res.numGridPoints);
+            expect(progress.length).to.be.at.most(res.numGridPoints + 1);
+            expect(progress[0]).to.have.property('numEvaluated').to.equal(0);
+            expect(progress[0]).to.not.have.property('params');
+            expect(progress[0]).to.not.have.property('bestParams');
+            progress.slice(1).forEach((p, i) => {
+              expect(p).to.have.property('numEvaluated').to.equal(i + 1);
+              expect(p).to.have.property('numGridPoints').to.equal(res.numGridPoints);
+              expect(p).to.have.property('params').to.have.property('c');
+              expect(p).to.have.property('bestParams').to.have.property('gamma');
+              expect(p.bestError).to.be.at.most(p.error);
+              if (i > 0) {
+                expect(p.bestError).to.be.at.most(progress[i].bestError);
+              }
+            });
+          });
+        });
+
+        it('trainAutoParallelAsync should be cancelled if onProgress returns false', () => {
+          const svm = new cv.SVM();
+          const onProgress = () => false;
+          return svm.trainAutoParallelAsync(trainData, { onProgress }).then((res) => {
+            expect(res.cancelled).to.be.true;
+            expect(res.numEvaluated).to.equal(0);
+            expect(res.numGridPoints).to.be.above(0);
+            expect(res).to.not.have.property('c');
+            expect(res).to.not.have.property('error');
+            expect(svm.isTrained).to.be.false;
+          });
+        });
+      });
     });
 
     describe('trained model tests', () => {
@@ -178,6 +269,69 @@ module.exports = () => {
         });
       });
 
+      describe('predictAsync', () => {
+        it('should return classification result of predicted sample', () =>
+          svm.predictAsync(predictSample).then((prediction) => {
+            expect(prediction).to.equal(1);
+          })
+        );
+
+        it('should return classification results of predicted samples', () =>
+          svm.predictAsync(predictSamplesMat).then((predictions) => {
+            expect(predictions).to.be.an('array').lengthOf(2);
+            expect(predictions).to.have.ordered.members([1, 0]);
+          })
+        );
+      });
+
+      describe('predictBatch', () => {
+        const manySamples = new cv.Mat(
+          Array(50).fill(0).map((_, i) => (i % 2 ? [100, 200, 200] : [10, 20, 15])),
+          cv.CV_32F
+        );
+        const expectedPredictions = Array(50).fill(0).map((_, i) => (i % 2 ? 0 : 1));
+
+        it('should return a Float32Array of the predictions', () => {
+          const predictions = svm.predictBatch(predictSamplesMat);
+          expect(predictions).to.be.instanceOf(Float32Array).lengthOf(2);
+          expect(Array.from(predictions)).to.deep.equal([1, 0]);
+        });
+
+        it('should predict the same results for any chunk size', () => {
+          const predictions = svm.predictBatch(manySamples, { chunkSize: 7 });
+          expect(Array.from(predictions)).to.deep.equal(expectedPredictions);
+        });
+
+        it('should return a Mat with one row per sample if returnMat is set', () => {
+          const predictions = svm.predictBatch(manySamples, { returnMat: true });
+          expect(predictions).to.be.instanceOf(cv.Mat);
+          expect(predictions.rows).to.equal(50);
+          expect(predictions.type).to.equal(cv.CV_32F);
+        });
+
+        it('should return decision values with rawOutput', () => {
+          const labels = svm.predictBatch(manySamples);
+          const decisionValues = svm.predictBatch(manySamples, { rawOutput: true });
+          expect(decisionValues).to.be.instanceOf(Float32Array).lengthOf(50);
+          // samples of the same class lie on the same side of the decision boundary
+          const signOfClass = label => Math.sign(decisionValues[labels.indexOf(label)]);
+          labels.forEach((label, i) => {
+            expect(Math.sign(decisionValues[i])).to.equal(signOfClass(label));
+          });
+          expect(signOfClass(0)).to.not.equal(signOfClass(1));
+        });
+
+        it('should return an empty Float32Array for an empty samples mat', () => {
+          expect(svm.predictBatch(new cv.Mat())).to.be.instanceOf(Float32Array).lengthOf(0);
+        });
+
+        it('predictBatchAsync', () =>
+          svm.predictBatchAsync(manySamples, { chunkSize: 4 }).then((predictions) => {
+            expect(Array.from(predictions)).to.deep.equal(expectedPredictions);
+          })
+        );
+      });
+
       describe('getSupportVectors', () => {
         it('should return support vectors', () => {
           expect(svm.getSupportVectors()).to.be.instanceOf(cv.Mat);
@@ -219,6 +373,40 @@ module.exports = () => {
           svm2.classWeights = null;
           assertPropsWithValue(svm1)(svm2);
         });
+
+        it('should save to and load from a buffer', () => {
+          const svmNew = new cv.SVM();
+          svmNew.loadFromBuffer(svm.saveToBuffer());
+          expect(svmNew.isTrained).to.be.true;
+          expect(svmNew.c).to.equal(svm.c);
+          expect(svmNew.gamma).to.equal(svm.gamma);
+          expect(Array.from(svmNew.predictBatch(samples))).to.deep.equal(Array.from(svm.predictBatch(samples)));
+        });
+
+        it('should load a buffer read from a saved file', () => {
+          const file = getTmpDataFilePath('testSVM.xml');
+          svm.save(file);
+          const svmNew = new cv.SVM();
+          svmNew.loadFromBuffer(fs.readFileSync(file));
+          expect(Array.from(svmNew.predictBatch(samples))).to.deep.equal(Array.from(svm.predictBatch(samples)));
+        });
+
+        it('should load a file written from a buffer', () => {
+          const file = getTmpDataFilePath('testSVM.xml');
+          fs.writeFileSync(file, svm.saveToBuffer());
+          const svmNew = new cv.SVM();
+          svmNew.load(file);
+          expect(Array.from(svmNew.predictBatch(samples))).to.deep.equal(Array.from(svm.predictBatch(samples)));
+        });
+
+        it('should save to and load from a buffer asynchronously', () => {
+          const svmNew = new cv.SVM();
+          return svm.saveToBufferAsync('yaml')
+            .then(buf => svmNew.loadFromBufferAsync(buf))
+            .then(() => {
+              expect(Array.from(svmNew.predictBatch(samples))).to.deep.equal(Array.from(svm.predictBatch(samples)));
+            });
+        });
       });
     });
   });
@@ -1,12 +1,411 @@
+const fs = require('fs');
 const cv = global.dut;
 const { expect } = require('chai');
+const {
+  assertPropsWithValue,
+  getTmpDataFilePath,
+  clearTmpData
+} = global.utils;
 
 module.exports = () => {
+  const samples = new cv.Mat([
+    [100, 200, 200],
+    [200, 100, 200],
+    [150, 150, 150],
+    [150, 150, 200],
+    [100, 100, 200],
+    [100, 100, 100],
+    [10, 20, 20],
+    [20, 10, 20],
+    [15, 15, 15],
+    [15, 15, 20],
+    [10, 10, 20],
+    [10, 10, 10]
+  ], cv.CV_32F);
+  const labels = [0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1];
+  const intResponses = new cv.Mat([labels], cv.CV_32S);
+  const floatResponses = new cv.Mat(labels.map(l => [l]), cv.CV_32F);
+  const oneHotResponses = new cv.Mat(labels.map(l => (l ? [0, 1] : [1, 0])), cv.CV_32F);
+  const predictSamples = new cv.Mat([[10, 20, 15], [100, 200, 200]], cv.CV_32F);
+
+  const argmax = row => row.indexOf(Math.max(...row));
+
+  // trains a model of each type and runs the train, predict, calcError, save and load tests shared by all models
+  const modelTests = ({ name, Model, params, trainData, getLabels }) => {
+    const getPredictedLabels = model => getLabels(model.predictBatch(samples, { returnMat: true }));
+
+    describe(`${name} StatModel`, () => {
+      it('should be constructable without args', () => {
+        expect(new Model()).to.be.instanceOf(Model);
+      });
+
+      it('should not be trained', () => {
+        expect(new Model(params)).to.have.property('isTrained').to.be.false;
+      });
+
+      describe('trained model tests', () => {
+        let model;
+        before(() => {
+          model = new Model(params);
+          model.train(trainData());
+        });
+
+        it('should be trained', () => {
+          expect(model).to.have.property('isTrained').to.be.true;
+          expect(model).to.have.property('varCount').to.equal(3);
+        });
+
+        it('should predict the training labels', () => {
+          expect(getPredictedLabels(model)).to.deep.equal(labels);
+        });
+
+        it('predictBatch should return one result per sample in a Float32Array', () => {
+          const predictions = model.predictBatch(samples);
+          expect(predictions).to.be.instanceOf(Float32Array);
+          expect(predictions.length % samples.rows).to.equal(0);
+        });
+
+        it('predictBatch should predict the same results for any chunk size', () => {
+          const expected = Array.from(model.predictBatch(samples));
+          expect(Array.from(model.predictBatch(samples, { chunkSize: 1 }))).to.deep.equal(expected);
+          expect(Array.from(model.predictBatch(samples, { chunkSize: 5 }))).to.deep.equal(expected);
+        });
+
+        it('predictAsync should return the same result as predict', () =>
+          model.predictAsync(predictSamples).then((predictions) => {
+            expect(predictions).to.deep.equal(model.predict(predictSamples));
+          })
+        );
+
+        it('predictBatchAsync should predict the training labels', () =>
+          model.predictBatchAsync(samples, { returnMat: true }).then((predictions) => {
+            expect(getLabels(predictions)).to.deep.equal(labels);
+          })
+        );
+
+        it('calcError should return error and responses', () => {
+          const ret = model.calcError(trainData(), false);
+          expect(ret).to.have.property('error').to.be.a('number');
+          expect(ret).to.have.property('responses').to.be.instanceOf(cv.Mat);
+        });
+
+        it('calcErrorAsync should return error and responses', () =>
+          model.calcErrorAsync(trainData(), false).then((ret) => {
+            expect(ret).to.have.property('error').to.be.a('number');
+            expect(ret).to.have.property('responses').to.be.instanceOf(cv.Mat);
+          })
+        );
+
+        describe('save and load', () => {
+          beforeEach(() => { clearTmpData(); });
+          afterEach(() => { clearTmpData(); });
+
+          it('should predict the same results after save and load', () => {
+            const file = getTmpDataFilePath(`test${name}.xml`);
+            model.save(file);
+            const loaded = new Model();
+            loaded.load(file);
+            expect(loaded).to.have.property('isTrained').to.be.true;
+            expect(Array.from(loaded.predictBatch(samples))).to.deep.equal(Array.from(model.predictBatch(samples)));
+          });
+
+          it('should throw if the file does not exist', () => {
+            expect(() => new Model().load(getTmpDataFilePath('doesNotExist.xml'))).to.throw();
+          });
+        });
+
+        describe('saveToBuffer and loadFromBuffer', () => {
+          beforeEach(() => { clearTmpData(); });
+          afterEach(() => { clearTmpData(); });
+
+          it('should predict the same results after saving to and loading from a buffer', () => {
+            const buf = model.saveToBuffer();
+            expect(buf).to.be.instanceOf(Buffer);
+            const loaded = new Model();
+            loaded.loadFromBuffer(buf);
+            expect(loaded).to.have.property('isTrained').to.be.true;
+            expect(Array.from(loaded.predictBatch(samples))).to.deep.equal(Array.from(model.predictBatch(samples)));
+          });
+
+          it('should save to and load from a yaml buffer asynchronously', () => {
+            const loaded = new Model();
+            return model.saveToBufferAsync({ format: 'yaml' })
+              .then(buf => loaded.loadFromBufferAsync(buf))
+              .then(() => {
+                expect(Array.from(loaded.predictBatch(samples))).to.deep.equal(Array.from(model.predictBatch(samples)));
+              });
+          });
+
+          it('should load a buffer read from a saved file', () => {
+            const file = getTmpDataFilePath(`test${name}.xml`);
+            model.save(file);
+            const loaded = new Model();
+            loaded.loadFromBuffer(fs.readFileSync(file));
+            expect(Array.from(loaded.predictBatch(samples))).to.deep.equal(Array.from(model.predictBatch(samples)));
+          });
+
+          it('should load a file written from a buffer', () => {
+            const file = getTmpDataFilePath(`test${name}.xml`);
+            fs.writeFileSync(file, model.saveToBuffer());
+            const loaded = new Model();
+            loaded.load(file);
+            expect(Array.from(loaded.predictBatch(samples))).to.deep.equal(Array.from(model.predictBatch(samples)));
+          });
+
+          it('should throw if the format is unknown', () => {
+            expect(() => model.saveToBuffer('bin')).to.throw('unknown format: bin');
+          });
+
+          it('should throw if arg 0 is not a buffer', () => {
+            expect(() => new Model().loadFromBuffer('model.xml')).to.throw('expected arg 0 to be a Buffer');
+          });
+
+          it('should throw if the buffer does not contain a model', () => {
+            expect(() => new Model().loadFromBuffer(Buffer.from('%YAML:1.0\n'))).to.throw();
+          });
+        });
+      });
+
+      it('trainAsync should train the model', () => {
+        const model = new Model(params);
+        return model.trainAsync(trainData()).then(() => {
+          expect(model).to.have.property('isTrained').to.be.true;
+        });
+      });
+    });
+  };
+
+  const labelsFromCol = predictions => predictions.getDataAsArray().map(row => Math.round(row[0]));
+  const labelsFromArgmax = predictions => predictions.getDataAsArray().map(argmax);
+
   describe('StatModel', () => {
-    describe('constructor', () => {
-      it('should be constructable with default args', () => {
+    it('should not be constructable', () => {
+      expect(() => new cv.StatModel()).to.throw();
+    });
+  });
+
+  describe('RTrees', () => {
+    const params = {
+      maxDepth: 4,
+      minSampleCount: 2,
+      calculateVarImportance: true,
+      activeVarCount: 2
+    };
+
+    it('should be constructable with params', () => {
+      assertPropsWithValue(new cv.RTrees(params))(params);
+    });
+
+    modelTests({
+      name: 'RTrees',
+      Model: cv.RTrees,
+      params,
+      trainData: () => new cv.TrainData(samples, cv.ml.ROW_SAMPLE, intResponses),
+      getLabels: labelsFromCol
+    });
+
+    describe('getVotes', () => {
+      let rtrees;
+      before(() => {
+        rtrees = new cv.RTrees(params);
+        rtrees.train(new cv.TrainData(samples, cv.ml.ROW_SAMPLE, intResponses));
+      });
+
+      (cv.version.minor < 2 ? it.skip : it)('should return the class row followed by one row of votes per sample', () => {
+        const votes = rtrees.getVotes(samples);
+        expect(votes).to.be.instanceOf(cv.Mat);
+        expect(votes.rows).to.equal(samples.rows + 1);
+        expect(votes.cols).to.equal(2);
+      });
+
+      (cv.version.minor < 2 ? it.skip : it)('should return the same votes for any chunk size', () => {
+        const expected = rtrees.getVotes(samples, { chunkSize: samples.rows }).getDataAsArray();
+        expect(rtrees.getVotes(samples, { chunkSize: 5 }).getDataAsArray()).to.deep.equal(expected);
+      });
 
+      (cv.version.minor < 2 ? it.skip : it)('getVotesAsync', () =>
+        rtrees.getVotesAsync(samples).then((votes) => {
+          expect(votes.rows).to.equal(samples.rows + 1);
+        })
+      );
+
+      it('should compute the variable importance', () => {
+        expect(rtrees.varImportance).to.be.instanceOf(cv.Mat);
+        expect(rtrees.varImportance.rows * rtrees.varImportance.cols).to.equal(3);
       });
     });
   });
+
+  describe('Boost', () => {
+    const params = {
+      boostType: cv.ml.Boost.REAL,
+      weakCount: 20,
+      maxDepth: 2,
+      minSampleCount: 2
+    };
+
+    it('should be constructable with params', () => {
+      assertPropsWithValue(new cv.Boost(params))(params);
+    });
+
+    modelTests({
+      name: 'Boost',
+      Model: cv.Boost,
+      params,
+      trainData: () => new cv.TrainData(samples, cv.ml.ROW_SAMPLE, intResponses),
+      getLabels: labelsFromCol
+    });
+  });
+
+  describe('KNearest', () => {
+    const params = {
+      defaultK: 3,
+      isClassifier: true
+    };
+
+    it('should be constructable with params', () => {
+      assertPropsWithValue(new cv.KNearest(params))(params);
+    });
+
+    it('should be constructable with args', () => {
+      assertPropsWithValue(new cv.KNearest(3, true))(params);
+    });
+
+    modelTests({
+      name: 'KNearest',
+      Model: cv.KNearest,
+      params,
+      trainData: () => new cv.TrainData(samples, cv.ml.ROW_SAMPLE, floatResponses),
+      getLabels: labelsFromCol
+    });
+
+    describe('findNearest', () => {
+      let knn;
+      before(() => {
+        knn = new cv.KNearest(params);
+        knn.train(new cv.TrainData(samples, cv.ml.ROW_SAMPLE, floatResponses));
+      });
+
+      it('should return results, neighbor responses and distances', () => {
+        const ret = knn.findNearest(samples, 3);
+        expect(ret).to.have.property('results').to.be.instanceOf(cv.Mat);
+        expect(ret).to.have.property('neighborResponses').to.be.instanceOf(cv.Mat);
+        expect(ret).to.have.property('dists').to.be.instanceOf(cv.Mat);
+        expect(labelsFromCol(ret.results)).to.deep.equal(labels);
+        expect(ret.neighborResponses.rows).to.equal(samples.rows);
+        expect(ret.neighborResponses.cols).to.equal(3);
+        expect(ret.dists.cols).to.equal(3);
+      });
+
+      it('should return the same results for any chunk size', () => {
+        const expected = knn.findNearest(samples, 3, { chunkSize: samples.rows });
+        const chunked = knn.findNearest(samples, 3, { chunkSize: 5 });
+        expect(chunked.results.getDataAsArray()).to.deep.equal(expected.results.getDataAsArray());
+        expect(chunked.dists.getDataAsArray()).to.deep.equal(expected.dists.getDataAsArray());
+      });
+
+      it('should throw if k is less than 1', () => {
+        expect(() => knn.findNearest(samples, 0)).to.throw();
+      });
+
+      it('findNearestAsync', () =>
+        knn.findNearestAsync(samples, 3).then((ret) => {
+          expect(labelsFromCol(ret.results)).to.deep.equal(labels);
+        })
+      );
+    });
+  });
+
+  describe('LogisticRegression', () => {
+    const params = {
+      learningRate: 0.5,
+      iterations: 500,
+      regularization: cv.ml.LogisticRegression.REG_DISABLE,
+      trainMethod: cv.ml.LogisticRegression.BATCH
+    };
+    // logistic regression is trained with gradient descent, which needs scaled features
+    const scaledSamples = samples.div(200);
+
+    it('should be constructable with params', () => {
+      assertPropsWithValue(new cv.LogisticRegression(params))(params);
+    });
+
+    it('should predict the training labels and expose the learnt thetas', () => {
+      const lr = new cv.LogisticRegression(params);
+      lr.train(new cv.TrainData(scaledSamples, cv.ml.ROW_SAMPLE, floatResponses));
+      expect(labelsFromCol(lr.predictBatch(scaledSamples, { returnMat: true }))).to.deep.equal(labels);
+      expect(lr.learntThetas).to.be.instanceOf(cv.Mat);
+    });
+
+    it('trainAsync and predictBatchAsync', () => {
+      const lr = new cv.LogisticRegression(params);
+      return lr.trainAsync(new cv.TrainData(scaledSamples, cv.ml.ROW_SAMPLE, floatResponses))
+        .then(() => lr.predictBatchAsync(scaledSamples))
+        .then((predictions) => {
+          expect(Array.from(predictions)).to.deep.equal(labels);
+        });
+    });
+  });
+
+  describe('NormalBayesClassifier', () => {
+    modelTests({
+      name: 'NormalBayesClassifier',
+      Model: cv.NormalBayesClassifier,
+      trainData: () => new cv.TrainData(samples, cv.ml.ROW_SAMPLE, intResponses),
+      getLabels: labelsFromCol
+    });
+
+    describe('predictProb', () => {
+      let nbc;
+      before(() => {
+        nbc = new cv.NormalBayesClassifier();
+        nbc.train(new cv.TrainData(samples, cv.ml.ROW_SAMPLE, intResponses));
+      });
+
+      it('should return outputs and class probabilities', () => {
+        const ret = nbc.predictProb(samples, { chunkSize: 5 });
+        expect(ret).to.have.property('outputs').to.be.instanceOf(cv.Mat);
+        expect(ret).to.have.property('outputProbs').to.be.instanceOf(cv.Mat);
+        expect(ret.outputProbs.rows).to.equal(samples.rows);
+        expect(ret.outputProbs.cols).to.equal(2);
+        expect(labelsFromCol(ret.outputs)).to.deep.equal(labels);
+      });
+
+      it('predictProbAsync', () =>
+        nbc.predictProbAsync(samples).then((ret) => {
+          expect(labelsFromCol(ret.outputs)).to.deep.equal(labels);
+        })
+      );
+    });
+  });
+
+  describe('ANN_MLP', () => {
+    const params = {
+      layerSizes: [3, 8, 2],
+      activationFunction: cv.ml.ANN_MLP.SIGMOID_SYM,
+      trainMethod: cv.ml.ANN_MLP.RPROP,
+      termCriteria: new cv.TermCriteria(cv.termCriteria.COUNT + cv.termCriteria.EPS, 1000, 0.0001)
+    };
+
+    it('should be constructable with params', () => {
+      const ann = new cv.ANN_MLP(params);
+      expect(ann.layerSizes.getDataAsArray().map(row => row[0])).to.deep.equal(params.layerSizes);
+      expect(ann.trainMethod).to.equal(params.trainMethod);
+    });
+
+    it('should keep the default rprop params if only the train method is set', () => {
+      const defaults = new cv.ANN_MLP();
+      const ann = new cv.ANN_MLP({ trainMethod: cv.ml.ANN_MLP.RPROP });
+      expect(ann.rpropDW0).to.equal(defaults.rpropDW0);
+      expect(ann.rpropDWMin).to.equal(defaults.rpropDWMin);
+    });
+
+    modelTests({
+      name: 'ANN_MLP',
+      Model: cv.ANN_MLP,
+      params,
+      trainData: () => new cv.TrainData(samples, cv.ml.ROW_SAMPLE, oneHotResponses),
+      getLabels: labelsFromArgmax
+    });
+  });
 };
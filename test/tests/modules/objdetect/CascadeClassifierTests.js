@@ -19,6 +19,10 @@ module.exports = () => {
         expect(() => new cv.CascadeClassifier(xmlHaarFile)).to.not.throw();
       });
 
+      it('should throw if cascade file can not be loaded', () => {
+        expect(() => new cv.CascadeClassifier('non_existing.xml')).to.throw('failed to load cascade.xml file');
+      });
+
       it('should implement detectMultiScale', () => {
         const cc = new cv.CascadeClassifier(xmlHaarFile);
         expect(cc).to.have.property('detectMultiScale').to.be.a('function');
@@ -66,6 +70,8 @@ module.exports = () => {
           expect(ret).to.have.property('numDetections').to.be.an('array');
           expect(ret.objects.length).to.be.above(0);
           expect(ret.numDetections.length).to.be.above(0);
+          expect(ret).to.have.property('numScales').to.be.above(0);
+          expect(ret).to.have.property('timeMs').to.be.a('number');
           ret.objects.forEach(obj => expect(obj).instanceOf(cv.Rect));
         };
 
@@ -79,6 +85,28 @@ module.exports = () => {
         });
       });
 
+      describe('concurrent detection', () => {
+        const toArray = rect => [rect.x, rect.y, rect.width, rect.height];
+
+        it('should return the same detections for concurrent async calls on one classifier', () => {
+          const expected = cc.detectMultiScale(testImg).objects.map(toArray);
+          const numCalls = 8;
+          const calls = Array(numCalls).fill(0).map(() => cc.detectMultiScaleAsync(testImg));
+          return Promise.all(calls).then((results) => {
+            results.forEach((ret) => {
+              expect(ret.objects.map(toArray)).to.deep.equal(expected);
+            });
+            expect(cc.numClassifiers).to.be.within(1, numCalls);
+          });
+        });
+
+        it('should count fewer scales for a larger minSize', () => {
+          const all = cc.detectMultiScale(testImg, { scaleFactor: 1.2 });
+          const large = cc.detectMultiScale(testImg, { scaleFactor: 1.2, minSize: new cv.Size(100, 100) });
+          expect(large.numScales).to.be.below(all.numScales);
+        });
+      });
+
       (cv.version.minor === 1 ? describe.skip : describe)('detectMultiScaleWithRejectLevels', () => {
         const expectOutput = (ret) => {
           expect(ret).to.have.property('objects').to.be.an('array');
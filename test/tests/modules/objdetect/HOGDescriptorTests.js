@@ -274,6 +274,63 @@ module.exports = () => {
       });
     });
 
+    describe('computeBatch', () => {
+      const hog = new cv.HOGDescriptor({
+        winSize: new cv.Size(40, 40),
+        blockSize: new cv.Size(20, 20),
+        blockStride: new cv.Size(10, 10),
+        cellSize: new cv.Size(10, 10),
+        nbins: 9
+      });
+      const locations = [new cv.Point(50, 50), new cv.Point(150, 50), new cv.Point(50, 150)];
+      const getWindow = () => getTestImg().getRegion(new cv.Rect(0, 0, 40, 40));
+
+      it('should compute one row per window image', () => {
+        const windows = [getWindow(), getWindow(), getWindow()];
+        const desc = hog.computeBatch(windows);
+        expect(desc).instanceOf(cv.Mat);
+        expect(desc.rows).to.equal(3);
+        expect(desc.cols).to.equal(hog.compute(getWindow()).length);
+        expect(desc.type).to.equal(cv.CV_32F);
+      });
+
+      it('should compute the same descriptors as compute for locations', () => {
+        const desc = hog.computeBatch({ image: getTestImg(), locations });
+        const expected = hog.compute(getTestImg(), { locations });
+        expect(desc.rows).to.equal(locations.length);
+        const data = [].concat(...desc.getDataAsArray());
+        data.forEach((val, i) => expect(val).to.be.closeTo(expected[i], 0.0001));
+      });
+
+      it('should concatenate samples in order', () => {
+        const desc = hog.computeBatch([getWindow(), { image: getTestImg(), locations }]);
+        expect(desc.rows).to.equal(1 + locations.length);
+      });
+
+      it('should throw if an image is smaller than a window', () => {
+        expect(() => hog.computeBatch([new cv.Mat(20, 20, cv.CV_8U, 0)])).to.throw('to be at least of size winSize');
+      });
+
+      it('should throw if a location lies outside of the image', () => {
+        const outside = [new cv.Point(getTestImg().cols, 0)];
+        expect(() => hog.computeBatch({ image: getTestImg(), locations: outside })).to.throw('to lie inside the padded image');
+      });
+
+      it('should throw if the blocks do not tile the window', () => {
+        const badHog = new cv.HOGDescriptor({
+          winSize: new cv.Size(64, 128),
+          blockSize: new cv.Size(16, 16),
+          blockStride: new cv.Size(12, 12),
+          cellSize: new cv.Size(8, 8)
+        });
+        expect(() => badHog.computeBatch([getWindow()])).to.throw('expected blocks to tile winSize with blockStride');
+      });
+
+      it('computeBatchAsync', () => hog.computeBatchAsync([getWindow(), getWindow()]).then((desc) => {
+        expect(desc.rows).to.equal(2);
+      }));
+    });
+
     describe('computeGradient', () => {
       const expectOutput = (result) => {
         expect(result).to.have.property('grad').instanceOf(cv.Mat);
@@ -411,6 +468,106 @@ module.exports = () => {
       });
     });
 
+    describe('detectMultiScaleBatch', () => {
+      const expectOutput = (results) => {
+        expect(results).to.be.an('array').lengthOf(2);
+        const expected = getTestHOG().detectMultiScale(getTestImg());
+        results.forEach((result) => {
+          expect(result).to.have.property('foundLocations').be.an('array').lengthOf(expected.foundLocations.length);
+          expect(result).to.have.property('foundWeights').be.an('array').lengthOf(expected.foundWeights.length);
+          result.foundLocations.forEach(loc => expect(loc).instanceOf(cv.Rect));
+        });
+      };
+
+      generateAPITests({
+        getDut: () => getTestHOG(),
+        methodName: 'detectMultiScaleBatch',
+        methodNameSpace: 'HOGDescriptor',
+        getRequiredArgs: () => ([
+          [getTestImg(), getTestImg()]
+        ]),
+        expectOutput
+      });
+    });
+
+    describe('HOGFeaturePyramid', () => {
+      const winStride = new cv.Size(8, 8);
+      const locations = [new cv.Point(0, 0), new cv.Point(16, 8), new cv.Point(64, 32), new cv.Point(96, 48)];
+      let pyramid;
+
+      before(() => {
+        pyramid = getTestHOG().computeFeaturePyramid(getTestImg(), { scale: 1.2 });
+      });
+
+      it('should compute levels until the image is smaller than a window', () => {
+        expect(pyramid).instanceOf(cv.HOGFeaturePyramid);
+        expect(pyramid.numLevels).to.be.above(1);
+        expect(pyramid.scales[0]).to.equal(1);
+      });
+
+      it('should compute levels for given scales', () => {
+        const custom = getTestHOG().computeFeaturePyramid(getTestImg(), { scales: [1, 2] });
+        expect(custom.scales).to.deep.equal([1, 2]);
+      });
+
+      it('should throw if blockSize is not a multiple of cellSize', () => {
+        const hog = new cv.HOGDescriptor({
+          winSize: new cv.Size(64, 128),
+          blockSize: new cv.Size(24, 24),
+          blockStride: new cv.Size(8, 8),
+          cellSize: new cv.Size(16, 16)
+        });
+        expect(() => hog.computeFeaturePyramid(getTestImg())).to.throw('expected blockSize to be a multiple of cellSize');
+      });
+
+      it('computeFeaturePyramidAsync', () => getTestHOG().computeFeaturePyramidAsync(getTestImg(), 1.2)
+        .then((res) => {
+          expect(res.numLevels).to.equal(pyramid.numLevels);
+        }));
+
+      it('detectROI should return the confidences of HOGDescriptor.detectROI', () => {
+        const expected = getTestHOG().detectROI(getTestImg(), locations, 0, winStride, new cv.Size(0, 0));
+        const result = pyramid.detectROI(locations, { hitThreshold: 0 });
+        expect(result.confidences).to.be.an('array').lengthOf(locations.length);
+        result.confidences.forEach((conf, i) => expect(conf).to.be.closeTo(expected.confidences[i], 0.001));
+      });
+
+      it('detectROI should throw if locations are not on the block stride grid', () => {
+        expect(() => pyramid.detectROI([new cv.Point(3, 0)])).to.throw('expected locations to be multiples of blockStride');
+      });
+
+      it('detect should throw if there is no level for scale', () => {
+        expect(() => pyramid.detect({ scale: 1.1 })).to.throw('no pyramid level for scale');
+      });
+
+      it('detect should find people', () => {
+        const result = pyramid.detect({ hitThreshold: 0.5, winStride });
+        expect(result.foundLocations.length).to.be.above(0);
+        expect(result.weights).to.be.an('array').lengthOf(result.foundLocations.length);
+      });
+
+      it('detectMultiScale should find people', () => {
+        const result = pyramid.detectMultiScale();
+        expect(result.foundLocations.length).to.be.above(0);
+        result.foundLocations.forEach(loc => expect(loc).instanceOf(cv.Rect));
+      });
+
+      it('detectMultiScaleROI', () => {
+        const roi = new cv.DetectionROI();
+        roi.scale = pyramid.scales[1];
+        roi.locations = locations;
+        expect(pyramid.detectMultiScaleROI([roi], 0, 0)).to.be.an('array');
+      });
+
+      it('detectAsync', () => pyramid.detectAsync(0.5, winStride).then((result) => {
+        expect(result.foundLocations.length).to.be.above(0);
+      }));
+
+      it('detectMultiScaleAsync', () => pyramid.detectMultiScaleAsync({ finalThreshold: 1 }).then((result) => {
+        expect(result.foundLocations).to.be.an('array');
+      }));
+    });
+
     describe('groupRectangles', () => {
       const expectOutput = (result) => {
         expect(result).to.be.an('array');
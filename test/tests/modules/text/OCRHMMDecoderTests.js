@@ -54,6 +54,39 @@ module.exports = () => {
       });
     });
 
+    describe('runBatch', () => {
+      let dut;
+      before(() => {
+        dut = new cv.OCRHMMDecoder(classifier, vocabulary, transitionP, emissionP);
+      });
+
+      const expectResult = (ret) => {
+        expect(ret).to.have.property('outputText');
+        expect(ret).to.have.property('rects');
+        expect(ret).to.have.property('words');
+        expect(ret).to.have.property('confidences');
+      };
+
+      it('should return the same text as runWithInfo for each crop', () => {
+        const expected = dut.runWithInfo(testImg).outputText;
+        const res = dut.runBatch([testImg, testImg, testImg]);
+        expect(res).to.be.an('array').lengthOf(3);
+        res.forEach((ret) => {
+          expectResult(ret);
+          expect(ret.outputText).to.equal(expected);
+        });
+      });
+
+      it('should return an empty array for no crops', () => {
+        expect(dut.runBatch([])).to.be.an('array').lengthOf(0);
+      });
+
+      it('runBatchAsync', () => dut.runBatchAsync([testImg, testImg], { concurrency: 2 }).then((res) => {
+        expect(res).to.be.an('array').lengthOf(2);
+        res.forEach(expectResult);
+      }));
+    });
+
     describe('runWithInfo', () => {
       let dut;
       before(() => {